@@ -0,0 +1,134 @@
+#include "AllocTracker.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace AllocTracker {
+
+// ========== STATE ==========
+
+namespace {
+    constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(Phase::COUNT);
+
+    // Plain atomics only: anything that allocates here would recurse
+    // into operator new.
+    std::atomic<int> currentPhase{static_cast<int>(Phase::SETUP)};
+    std::atomic<std::size_t> allocationCounts[PHASE_COUNT];
+    std::atomic<std::size_t> byteCounts[PHASE_COUNT];
+}
+
+// ========== CONTROL ==========
+
+bool isEnabled() {
+#ifdef CAMPUS_QUEST_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void setPhase(Phase phase) {
+    currentPhase.store(static_cast<int>(phase), std::memory_order_relaxed);
+}
+
+Phase getPhase() {
+    return static_cast<Phase>(currentPhase.load(std::memory_order_relaxed));
+}
+
+void resetCounters() {
+    for (std::size_t i = 0; i < PHASE_COUNT; i++) {
+        allocationCounts[i].store(0, std::memory_order_relaxed);
+        byteCounts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+
+// ========== COUNTERS ==========
+
+std::size_t getAllocations(Phase phase) {
+    return allocationCounts[static_cast<std::size_t>(phase)].load(std::memory_order_relaxed);
+}
+
+std::size_t getBytes(Phase phase) {
+    return byteCounts[static_cast<std::size_t>(phase)].load(std::memory_order_relaxed);
+}
+
+std::size_t getTotalAllocations() {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < PHASE_COUNT; i++) {
+        total += allocationCounts[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+const char* getPhaseName(Phase phase) {
+    switch (phase) {
+        case Phase::SETUP:   return "SETUP";
+        case Phase::PLAYER:  return "PLAYER";
+        case Phase::ENEMY:   return "ENEMY";
+        case Phase::CLEANUP: return "CLEANUP";
+        case Phase::DISPLAY: return "DISPLAY";
+        default:             return "UNKNOWN";
+    }
+}
+
+} // namespace AllocTracker
+
+
+// ========== GLOBAL OPERATOR NEW / DELETE HOOKS ==========
+
+#ifdef CAMPUS_QUEST_ALLOC_TRACKING
+
+namespace AllocTracker {
+
+/**
+ * Record one allocation in the current phase
+ * Called from the operator new hooks below.
+ */
+static void recordAllocation(std::size_t size) {
+    int phase = currentPhase.load(std::memory_order_relaxed);
+    allocationCounts[phase].fetch_add(1, std::memory_order_relaxed);
+    byteCounts[phase].fetch_add(size, std::memory_order_relaxed);
+}
+
+} // namespace AllocTracker
+
+/**
+ * Replacement global allocation functions
+ *
+ * Replacing operator new/delete at global scope is allowed by the
+ * standard: the linker picks these over the library versions.
+ * They forward to malloc/free and record every allocation.
+ */
+void* operator new(std::size_t size) {
+    AllocTracker::recordAllocation(size);
+    if (size == 0) {
+        size = 1;  // new must return a unique non-null pointer
+    }
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif // CAMPUS_QUEST_ALLOC_TRACKING
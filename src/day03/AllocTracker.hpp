@@ -0,0 +1,89 @@
+#ifndef ALLOCTRACKER_HPP
+#define ALLOCTRACKER_HPP
+
+#include <cstddef>
+
+/**
+ * AllocTracker - Heap allocation counter for the game loop
+ *
+ * Debug/test mode that hooks the global operator new/delete and counts
+ * every heap allocation, grouped by the turn phase that was active when
+ * it happened.
+ *
+ * Enabled at build time:
+ *   cmake -S . -B build -DCAMPUS_QUEST_ALLOC_TRACKING=ON
+ *
+ * When the option is OFF, the hooks are not compiled at all and every
+ * counter stays at 0 (isEnabled() returns false).
+ *
+ * Used by Game in HEADLESS mode: once the game reaches a steady state,
+ * an automated turn must not allocate at all. Any allocation is a bug
+ * (a string copy, a temporary container, a stringstream...).
+ */
+namespace AllocTracker {
+
+    // ========== TURN PHASES ==========
+
+    /**
+     * Phases of a turn, used to group allocations
+     */
+    enum class Phase {
+        SETUP,      // World creation (allocations expected)
+        PLAYER,     // Player phase
+        ENEMY,      // Enemy phase
+        CLEANUP,    // Removal of dead objects / projectiles
+        DISPLAY,    // Drawing and UI
+        COUNT       // Number of phases (not a real phase)
+    };
+
+
+    // ========== CONTROL ==========
+
+    /**
+     * Check if allocation tracking was compiled in
+     * @return true if built with CAMPUS_QUEST_ALLOC_TRACKING
+     */
+    bool isEnabled();
+
+    /**
+     * Set the phase that receives the next allocations
+     * @param phase Current turn phase
+     */
+    void setPhase(Phase phase);
+
+    /**
+     * Get the currently active phase
+     */
+    Phase getPhase();
+
+    /**
+     * Reset all per-phase counters (called at the start of each turn)
+     */
+    void resetCounters();
+
+
+    // ========== COUNTERS ==========
+
+    /**
+     * Number of allocations made during a phase since the last reset
+     */
+    std::size_t getAllocations(Phase phase);
+
+    /**
+     * Number of bytes allocated during a phase since the last reset
+     */
+    std::size_t getBytes(Phase phase);
+
+    /**
+     * Total allocations of all phases since the last reset
+     */
+    std::size_t getTotalAllocations();
+
+    /**
+     * Get phase name as a C string (no allocation)
+     */
+    const char* getPhaseName(Phase phase);
+
+} // namespace AllocTracker
+
+#endif // ALLOCTRACKER_HPP
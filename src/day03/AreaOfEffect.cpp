@@ -0,0 +1,167 @@
+#include "AreaOfEffect.hpp"
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+    const double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+
+    /**
+     * covers() with the cosine of the ARC half angle already computed
+     */
+    bool inside(const AreaOfEffect::Area& area, double cosHalfAngle, double x, double y, double radius) {
+        const double dx = x - area.originX;
+        const double dy = y - area.originY;
+        const bool aimed = area.dirX != 0.0 || area.dirY != 0.0;
+        switch (area.shape) {
+            case AreaShape::LINE: {
+                if (!aimed) {
+                    return false;
+                }
+                const double along = dx * area.dirX + dy * area.dirY;
+                const double across = std::fabs(dx * area.dirY - dy * area.dirX);
+                return along >= 0.0 && along <= area.reach + radius && across <= area.size + radius;
+            }
+            case AreaShape::ARC: {
+                const double distanceSquared = dx * dx + dy * dy;
+                const double reach = area.reach + radius;
+                if (distanceSquared > reach * reach) {
+                    return false;
+                }
+                if (!aimed || distanceSquared <= radius * radius) {
+                    return true;
+                }
+                return dx * area.dirX + dy * area.dirY >= cosHalfAngle * std::sqrt(distanceSquared);
+            }
+            case AreaShape::BLAST: {
+                const double reach = area.size + radius;
+                return dx * dx + dy * dy <= reach * reach;
+            }
+            default:
+                return false;
+        }
+    }
+}
+
+
+// ========== CONSTRUCTOR ==========
+
+AreaOfEffect::AreaOfEffect()
+    : index(nullptr)
+{
+}
+
+
+// ========== SETUP ==========
+
+void AreaOfEffect::setIndex(const SpatialGrid* grid) {
+    this->index = grid;
+}
+
+void AreaOfEffect::reserve(size_t capacity) {
+    hits.reserve(capacity);
+    targets.reserve(capacity);
+}
+
+
+// ========== QUERIES ==========
+
+const std::vector<Character*>& AreaOfEffect::collect(const Character& attacker, const Character& target,
+                                                     const Weapon& weapon) {
+    Area area = forWeapon(weapon, attacker.getX(), attacker.getY(), target.getX(), target.getY());
+    return collect(area, &attacker, &target);
+}
+
+/**
+ * 1. Broad phase: grid query on the area's box, CHARACTER layer only
+ * 2. Narrow phase: exact shape test on each candidate (alive, not
+ *    skipped)
+ * 3. Nearest first, ties by position: same order whatever the buckets
+ */
+const std::vector<Character*>& AreaOfEffect::collect(const Area& area, const GameObject* skipA,
+                                                     const GameObject* skipB) {
+    hits.clear();
+    targets.clear();
+    if (!index || area.shape == AreaShape::SINGLE) {
+        return targets;
+    }
+
+    const double cosHalfAngle = std::cos(area.size * DEGREES_TO_RADIANS);
+    double minX, minY, maxX, maxY;
+    bounds(area, minX, minY, maxX, maxY);
+    index->query(minX, minY, maxX, maxY, LAYER, HIT_MASK, [&](const SpatialGrid::Entry& entry) {
+        if (entry.object == skipA || entry.object == skipB
+            || !inside(area, cosHalfAngle, entry.x, entry.y, entry.radius)) {
+            return;
+        }
+        // CHARACTER layer: only Character sets it (see Character.hpp)
+        Character* character = static_cast<Character*>(entry.object);
+        if (character->isAlive()) {
+            const double dx = entry.x - area.originX;
+            const double dy = entry.y - area.originY;
+            hits.push_back(Hit{ character, dx * dx + dy * dy });
+        }
+    });
+
+    std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+        if (a.distanceSquared != b.distanceSquared) {
+            return a.distanceSquared < b.distanceSquared;
+        }
+        if (a.target->getX() != b.target->getX()) {
+            return a.target->getX() < b.target->getX();
+        }
+        return a.target->getY() < b.target->getY();
+    });
+    for (const Hit& hit : hits) {
+        targets.push_back(hit.target);
+    }
+    return targets;
+}
+
+bool AreaOfEffect::covers(const Area& area, double x, double y, double radius) {
+    return inside(area, std::cos(area.size * DEGREES_TO_RADIANS), x, y, radius);
+}
+
+AreaOfEffect::Area AreaOfEffect::forWeapon(const Weapon& weapon, double fromX, double fromY,
+                                           double toX, double toY) {
+    const double dx = toX - fromX;
+    const double dy = toY - fromY;
+    const double length = std::sqrt(dx * dx + dy * dy);
+    Area area;
+    area.shape = weapon.getArea();
+    area.dirX = length > 0.0 ? dx / length : 0.0;
+    area.dirY = length > 0.0 ? dy / length : 0.0;
+    area.reach = weapon.getRange();
+    area.size = weapon.getAreaSize();
+    const bool centred = area.shape == AreaShape::BLAST;
+    area.originX = centred ? toX : fromX;
+    area.originY = centred ? toY : fromY;
+    return area;
+}
+
+void AreaOfEffect::bounds(const Area& area, double& minX, double& minY, double& maxX, double& maxY) {
+    switch (area.shape) {
+        case AreaShape::LINE: {
+            const double endX = area.originX + area.dirX * area.reach;
+            const double endY = area.originY + area.dirY * area.reach;
+            minX = std::min(area.originX, endX) - area.size;
+            minY = std::min(area.originY, endY) - area.size;
+            maxX = std::max(area.originX, endX) + area.size;
+            maxY = std::max(area.originY, endY) + area.size;
+            return;
+        }
+        case AreaShape::BLAST:
+            minX = area.originX - area.size;
+            minY = area.originY - area.size;
+            maxX = area.originX + area.size;
+            maxY = area.originY + area.size;
+            return;
+        default:  // ARC (and SINGLE): the whole reach around the origin
+            minX = area.originX - area.reach;
+            minY = area.originY - area.reach;
+            maxX = area.originX + area.reach;
+            maxY = area.originY + area.reach;
+            return;
+    }
+}
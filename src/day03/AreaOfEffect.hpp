@@ -0,0 +1,113 @@
+#ifndef AREAOFEFFECT_HPP
+#define AREAOFEFFECT_HPP
+
+#include "Weapon.hpp"
+#include "CollisionShape.hpp"
+#include <cstddef>
+#include <vector>
+
+class GameObject;
+class SpatialGrid;
+
+/**
+ * AreaOfEffect - Every character caught by an area hit, in one query
+ *
+ * A LINE, ARC or BLAST hit (see AreaShape) is turned into a box around
+ * the shape; the SpatialGrid returns the characters whose circle may
+ * touch that box (layer filtered), and an exact test per shape keeps
+ * the ones really inside:
+ * - LINE: centre projected on the aim between 0 and reach + radius,
+ *   and at most half width + radius from it (a capsule)
+ * - ARC: within reach + radius, and the centre within the half angle
+ *   of the aim (or the circle over the origin)
+ * - BLAST: within size + radius of the centre
+ *
+ * The cost is the characters near the shape, not the level: a swing
+ * into a crowd of hundreds reads a few grid buckets. The hits land in
+ * a buffer reserved at setup (nearest first, ties by position, so the
+ * log does not depend on the grid's bucket order); the caller queues
+ * them all in the CombatBuffer, which applies them in one pass.
+ *
+ * The index is the Game's grid of living characters (not owned); it
+ * must be rebuilt before the query if characters moved.
+ */
+class AreaOfEffect {
+public:
+    /**
+     * One area, in world units
+     */
+    struct Area {
+        AreaShape shape;
+        double originX;      // Attacker (LINE, ARC) or centre (BLAST)
+        double originY;
+        double dirX;         // Unit aim (LINE, ARC; (0, 0) = no aim)
+        double dirY;
+        double reach;        // Length (LINE, ARC)
+        double size;         // Half width, half angle (degrees) or blast radius
+    };
+
+    static const uint8_t LAYER = CollisionLayer::CHARACTER;
+    static const uint8_t HIT_MASK = CollisionLayer::CHARACTER;  // Only characters take damage
+
+private:
+    struct Hit {
+        Character* target;
+        double distanceSquared;  // From the origin (sort key)
+    };
+
+    const SpatialGrid* index;      // Living characters (not owned, may be null)
+    std::vector<Hit> hits;
+    std::vector<Character*> targets;
+
+public:
+    AreaOfEffect();
+
+    // ========== SETUP ==========
+
+    /**
+     * @param grid Living characters, CHARACTER layer (nullptr = areas
+     *        catch nobody)
+     */
+    void setIndex(const SpatialGrid* grid);
+
+    /**
+     * Room for 'capacity' characters per area (collect never allocates
+     * below that)
+     */
+    void reserve(size_t capacity);
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Characters caught by 'weapon' swung by 'attacker' at 'target',
+     * besides the attacker and the target themselves
+     * @return Nearest first (valid until the next collect)
+     */
+    const std::vector<Character*>& collect(const Character& attacker, const Character& target,
+                                           const Weapon& weapon);
+
+    /**
+     * Characters inside 'area', except 'skipA' and 'skipB' (may be null)
+     * @return Nearest first (valid until the next collect)
+     */
+    const std::vector<Character*>& collect(const Area& area, const GameObject* skipA, const GameObject* skipB);
+
+    /**
+     * Exact test: does a circle at (x, y) touch the area?
+     */
+    static bool covers(const Area& area, double x, double y, double radius);
+
+    /**
+     * Area of a weapon aimed from (fromX, fromY) at (toX, toY): the
+     * weapon's range for LINE / ARC, centred on the aim point for BLAST
+     */
+    static Area forWeapon(const Weapon& weapon, double fromX, double fromY, double toX, double toY);
+
+    /**
+     * Box that contains the area (broad phase)
+     */
+    static void bounds(const Area& area, double& minX, double& minY, double& maxX, double& maxY);
+};
+
+#endif // AREAOFEFFECT_HPP
@@ -8,18 +8,20 @@
  * Default constructor
  * Calls GameObject default constructor and sets health to 100
  */
-Character::Character() : GameObject(0.0, 0.0, "Character"), health(100) {
+Character::Character() : GameObject(0.0, 0.0, "Character"), health(100), combat(nullptr) {
     // GameObject constructor sets position to (0, 0) and name
     // health is initialized to 100
+    setCollisionShape(DEFAULT_SHAPE);
 }
 
 /**
  * Parameterized constructor
  */
 Character::Character(double x, double y, const std::string& name, int health)
-    : GameObject(x, y, name), health(health) {
+    : GameObject(x, y, name), health(health), combat(nullptr) {
     // GameObject constructor sets position and name
     // Initialize health to provided value
+    setCollisionShape(DEFAULT_SHAPE);
     
     // Ensure health is not negative
     if (this->health < 0) {
@@ -61,6 +63,21 @@ bool Character::isAlive() const {
 }
 
 
+// ========== COMBAT ==========
+
+void Character::setCombatBuffer(CombatBuffer* buffer) {
+    this->combat = buffer;
+}
+
+void Character::dealDamage(Character& target, int damage, CombatBuffer::Source source, int weapon) {
+    if (combat) {
+        combat->queue(this, target, damage, source, weapon);
+    } else {
+        target.setHealth(target.getHealth() - damage);
+    }
+}
+
+
 // ========== OVERRIDE PURE VIRTUAL METHODS ==========
 
 /**
@@ -72,7 +89,9 @@ void Character::draw() const {
     // JOB 11: Enhanced UI with colors and health bars
     std::cout << "[CHARACTER '" << UI::COLOR_BRIGHT_CYAN << getName() << UI::COLOR_RESET << "'] ";
     std::cout << "Pos:(" << getX() << ", " << getY() << ") ";
-    std::cout << "HP: " << UI::getHealthBar(health, 100, 10, true) << " ";
+    std::cout << "HP: ";
+    UI::drawHealthBar(health, 100, 10, true);
+    std::cout << " ";
     
     if (isAlive()) {
         std::cout << UI::COLOR_BRIGHT_GREEN << "ALIVE" << UI::COLOR_RESET;
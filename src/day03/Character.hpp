@@ -2,6 +2,7 @@
 #define CHARACTER_HPP
 
 #include "GameObject.hpp"
+#include "CombatBuffer.hpp"
 
 /**
  * Character - Concrete class for living entities
@@ -15,12 +16,22 @@
  * - Has health points (points de vie)
  * - Can be alive or dead based on health
  * - Can move and update state
+ * - Hits others through the Game's CombatBuffer (damage is resolved
+ *   in batches, see dealDamage)
  */
 class Character : public GameObject {
 private:
     int health;  // Health points (points de vie)
+    CombatBuffer* combat;  // Shared hit queue (not owned), nullptr = immediate damage
 
 public:
+    /**
+     * CHARACTER layer: blocked by decor and other characters, hit by arrows
+     */
+    static constexpr CollisionShape DEFAULT_SHAPE = CollisionShape::circle(
+        CollisionShape::DEFAULT_RADIUS, CollisionLayer::CHARACTER,
+        CollisionLayer::STATIC | CollisionLayer::CHARACTER | CollisionLayer::PROJECTILE);
+    
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
     
     /**
@@ -66,6 +77,27 @@ public:
     bool isAlive() const;
     
     
+    // ========== COMBAT ==========
+    
+    /**
+     * Share the Game's hit queue
+     * @param buffer Buffer resolved by the Game (nullptr = immediate damage)
+     */
+    void setCombatBuffer(CombatBuffer* buffer);
+    
+    /**
+     * Hit another character
+     * @param target Character being hit
+     * @param damage Health points removed
+     * @param source Kind of attack (for the log)
+     * @param weapon Weapon id, -1 if none
+     * 
+     * With a combat buffer, the hit is queued and applied when the Game
+     * resolves the phase. Without one, health drops right away (no log).
+     */
+    void dealDamage(Character& target, int damage, CombatBuffer::Source source, int weapon = -1);
+    
+    
     // ========== OVERRIDE PURE VIRTUAL METHODS ==========
     
     /**
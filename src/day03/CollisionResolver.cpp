@@ -0,0 +1,152 @@
+#include "CollisionResolver.hpp"
+#include "GameManager.hpp"
+#include "StaticBvh.hpp"
+#include "Geometry.hpp"
+#include "Vector2d.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+    /**
+     * Time (0..1 along the move) at which 'shape' starting at (x, y)
+     * first touches 'blocker': swept circle for two circles, slab test
+     * on the blocker's box grown by the mover's half extents otherwise
+     */
+    double timeOfImpact(const CollisionShape& shape, double x, double y, double moveX, double moveY,
+                        const GameObject& blocker) {
+        const CollisionShape& other = blocker.getCollisionShape();
+        double t = 0.0;
+        bool touched;
+        if (shape.kind == CollisionShape::Kind::CIRCLE && other.kind == CollisionShape::Kind::CIRCLE) {
+            touched = Geometry::sweepCircle(x, y, moveX, moveY, blocker.getX(), blocker.getY(),
+                                            static_cast<double>(shape.halfWidth) + other.halfWidth, t);
+        } else {
+            double halfWidth = static_cast<double>(shape.halfWidth) + other.halfWidth;
+            double halfHeight = static_cast<double>(shape.halfHeight) + other.halfHeight;
+            touched = Geometry::sweepBox(x, y, moveX, moveY, blocker.getX() - halfWidth, blocker.getY() - halfHeight,
+                                         blocker.getX() + halfWidth, blocker.getY() + halfHeight, t);
+        }
+        return touched ? t : 0.0;
+    }
+}
+
+// ========== CONSTRUCTOR ==========
+
+CollisionResolver::CollisionResolver()
+    : grid(GRID_CELL_SIZE, GRID_BUCKET_BITS),
+      staticGeometry(nullptr),
+      slack(0.0)
+{
+}
+
+void CollisionResolver::setStaticGeometry(const StaticBvh* bvh) {
+    staticGeometry = bvh;
+}
+
+void CollisionResolver::reserve(size_t capacity) {
+    grid.reserve(capacity);
+}
+
+
+// ========== PHASE ==========
+
+void CollisionResolver::begin(GameManager& manager) {
+    grid.clear();
+    slack = 0.0;
+    for (size_t i = 0; i < manager.size(); i++) {
+        GameObject* object = manager.getObject(i);
+        const CollisionShape& shape = object->getCollisionShape();
+        if (staticGeometry && (shape.layer & CollisionLayer::STATIC)) {
+            continue;  // In the BVH
+        }
+        grid.insert(object, object->getX(), object->getY(), shape.boundingRadius(), shape.layer, shape.mask);
+    }
+    grid.build();
+}
+
+void CollisionResolver::commit(double fromX, double fromY, double toX, double toY) {
+    slack = std::max(slack, std::hypot(toX - fromX, toY - fromY));
+}
+
+
+// ========== RESOLUTION ==========
+
+CollisionResolver::Result CollisionResolver::resolve(const GameObject* object, double fromX, double fromY,
+                                                     double toX, double toY) const {
+    Result result{ fromX, fromY, nullptr, 0 };
+    const CollisionShape& shape = object->getCollisionShape();
+    // Slide math in double, whatever the position precision (the API is double)
+    BasicVector2d<double> position(fromX, fromY);
+    BasicVector2d<double> move(toX - fromX, toY - fromY);
+
+    while (result.iterations < MAX_ITERATIONS) {
+        double length = std::sqrt(move.lengthSquared());
+        if (length < MIN_MOVE) {
+            break;
+        }
+        result.iterations++;
+        BasicVector2d<double> target = position + move;
+        GameObject* blocker = findBlocker(object, target.getX(), target.getY());
+        if (!blocker) {
+            position = target;
+            break;
+        }
+        if (!result.blocker) {
+            result.blocker = blocker;
+        }
+
+        // Go as far as the contact (minus a skin), if nothing else is there
+        double advance = (timeOfImpact(shape, position.getX(), position.getY(), move.getX(), move.getY(), *blocker)
+                          * length - CONTACT_SKIN) / length;
+        if (advance > 0.0) {
+            BasicVector2d<double> contact = position + move * advance;
+            if (!findBlocker(object, contact.getX(), contact.getY())) {
+                position = contact;
+                move *= 1.0 - advance;
+            }
+        }
+
+        // Keep only the part of the rest along the contact tangent
+        double normalX, normalY;
+        if (!CollisionShape::contactNormal(position.getX(), position.getY(), shape, blocker->getX(), blocker->getY(),
+                                           blocker->getCollisionShape(), normalX, normalY)) {
+            break;  // Right on top of it: no tangent to follow
+        }
+        BasicVector2d<double> normal(normalX, normalY);
+        double into = move.dot(normal);
+        if (into >= 0.0) {
+            break;  // Not moving into it, yet blocked: stay
+        }
+        move -= normal * into;
+    }
+    result.x = position.getX();
+    result.y = position.getY();
+    return result;
+}
+
+GameObject* CollisionResolver::findBlocker(const GameObject* object, double x, double y) const {
+    const CollisionShape& shape = object->getCollisionShape();
+    if (shape.mask == CollisionLayer::NONE) {
+        return nullptr;
+    }
+
+    GameObject* blocker = nullptr;
+    double reach = shape.boundingRadius() + slack;
+    grid.query(x - reach, y - reach, x + reach, y + reach, shape.layer, shape.mask,
+               [&](const SpatialGrid::Entry& entry) {
+                   const GameObject* other = entry.object;
+                   if (blocker || other == object) {
+                       return;
+                   }
+                   // Current position: it may have moved since begin()
+                   if (CollisionShape::overlaps(x, y, shape, other->getX(), other->getY(),
+                                                other->getCollisionShape())) {
+                       blocker = entry.object;
+                   }
+               });
+    if (!blocker && staticGeometry) {
+        blocker = staticGeometry->findOverlap(x, y, shape);
+    }
+    return blocker;
+}
@@ -0,0 +1,98 @@
+#ifndef COLLISIONRESOLVER_HPP
+#define COLLISIONRESOLVER_HPP
+
+#include "SpatialGrid.hpp"
+#include <cstddef>
+
+class GameObject;
+class GameManager;
+class StaticBvh;
+
+/**
+ * CollisionResolver - Movement phase collision response (sliding)
+ *
+ * A blocked move used to be dropped: the mover stayed where it was and
+ * recomputed the same blocked move next turn, so crowds jammed. Here
+ * the blocked part of the move is removed and the rest is tried again:
+ *
+ *   move = target - position
+ *   repeat (at most MAX_ITERATIONS):
+ *     blocker at position + move?  no -> go there, done
+ *     advance to the time of impact with the blocker (if free there)
+ *     n = contact normal of the blocker (CollisionShape::contactNormal)
+ *     move -= (move . n) n          (slide the rest along the tangent)
+ *
+ * A head-on move has no tangent left, but still ends against the
+ * blocker instead of where it started.
+ *
+ * Each try is one broad phase query, never a scan of every object:
+ * - moving objects: a SpatialGrid built once per phase (begin()). It
+ *   stores the positions of that moment; objects moved since then are
+ *   still found because queries are grown by the longest committed move
+ *   (at most one move per object per phase), and the narrow phase reads
+ *   their current position
+ * - static objects: the StaticBvh, if one is set (else they go into the
+ *   grid like the rest)
+ */
+class CollisionResolver {
+public:
+    /**
+     * Outcome of one move
+     */
+    struct Result {
+        double x;              // Where the mover ends up
+        double y;
+        GameObject* blocker;   // First object in the way (nullptr: moved freely)
+        int iterations;        // Slide steps tried
+    };
+
+    static const int MAX_ITERATIONS = 3;
+    static constexpr double MIN_MOVE = 1e-3;   // Shorter slides are dropped
+    static constexpr double CONTACT_SKIN = 1e-3;  // Gap kept at contact
+    static constexpr double GRID_CELL_SIZE = 2.0;   // About a query box (shape + one step)
+    static const int GRID_BUCKET_BITS = 14;         // Crowds of 10k+ movers
+
+private:
+    SpatialGrid grid;
+    const StaticBvh* staticGeometry;   // Not owned, may be null
+    double slack;                      // Longest move committed since begin()
+
+public:
+    CollisionResolver();
+
+    /**
+     * Decor index (nullptr = decor is indexed with the moving objects)
+     */
+    void setStaticGeometry(const StaticBvh* bvh);
+
+    /**
+     * Reserve room for 'capacity' indexed objects
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Start a movement phase: index every object of the manager that
+     * the static geometry does not hold
+     */
+    void begin(GameManager& manager);
+
+    /**
+     * Resolve the move of 'object' from (fromX, fromY) to (toX, toY)
+     *
+     * The object is not moved: the caller sets the position from the
+     * result and reports it with commit().
+     */
+    Result resolve(const GameObject* object, double fromX, double fromY, double toX, double toY) const;
+
+    /**
+     * Record a move made after begin() (keeps later queries exact)
+     */
+    void commit(double fromX, double fromY, double toX, double toY);
+
+    /**
+     * First object blocking 'object' placed at (x, y), nullptr if none
+     */
+    GameObject* findBlocker(const GameObject* object, double x, double y) const;
+};
+
+#endif // COLLISIONRESOLVER_HPP
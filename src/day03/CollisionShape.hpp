@@ -0,0 +1,137 @@
+#ifndef COLLISIONSHAPE_HPP
+#define COLLISIONSHAPE_HPP
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Collision layers - What an object IS (one bit) for the collision code
+ *
+ * Each shape also has a MASK: the layers it interacts with. Two shapes
+ * interact only if each one's mask contains the other's layer, so a
+ * pair is rejected with two byte tests, before any distance math.
+ */
+namespace CollisionLayer {
+    const uint8_t NONE = 0;
+    const uint8_t STATIC = 1 << 0;      // Decor: never moves
+    const uint8_t CHARACTER = 1 << 1;   // Player, enemies
+    const uint8_t PROJECTILE = 1 << 2;  // Arrows (ProjectileSystem)
+    const uint8_t ALL = 0xFF;
+}
+
+/**
+ * CollisionShape - Per-object bounds: a circle or an axis-aligned box
+ *
+ * 12 bytes: two float half extents (circle: radius, radius), the kind,
+ * the layer and the mask. Positions stay in the object (Vector2d); the
+ * shape is centred on it.
+ *
+ * The default shape is a circle of DEFAULT_RADIUS: two default shapes
+ * touch below 2 * DEFAULT_RADIUS = GameManager::COLLISION_RADIUS, the
+ * old global distance.
+ */
+struct CollisionShape {
+    enum class Kind : uint8_t {
+        CIRCLE,
+        BOX
+    };
+
+    static constexpr float DEFAULT_RADIUS = 0.25f;
+
+    float halfWidth;    // Circle: radius
+    float halfHeight;   // Circle: radius
+    Kind kind;
+    uint8_t layer;      // One CollisionLayer bit
+    uint8_t mask;       // CollisionLayer bits this shape interacts with
+
+    static constexpr CollisionShape circle(float radius, uint8_t layer, uint8_t mask) {
+        return CollisionShape{ radius, radius, Kind::CIRCLE, layer, mask };
+    }
+
+    static constexpr CollisionShape box(float halfWidth, float halfHeight, uint8_t layer, uint8_t mask) {
+        return CollisionShape{ halfWidth, halfHeight, Kind::BOX, layer, mask };
+    }
+
+    /**
+     * Layer filter (both directions)
+     */
+    constexpr bool interacts(const CollisionShape& other) const {
+        return (mask & other.layer) != 0 && (other.mask & layer) != 0;
+    }
+
+    /**
+     * Radius of the circle around the shape (broad phase)
+     */
+    double boundingRadius() const {
+        if (kind == Kind::CIRCLE) {
+            return halfWidth;
+        }
+        return std::sqrt(static_cast<double>(halfWidth) * halfWidth + static_cast<double>(halfHeight) * halfHeight);
+    }
+
+    /**
+     * Narrow phase: do shape a at (ax, ay) and shape b at (bx, by)
+     * overlap? (touching is not overlapping)
+     */
+    static bool overlaps(double ax, double ay, const CollisionShape& a,
+                         double bx, double by, const CollisionShape& b) {
+        double dx = bx - ax;
+        double dy = by - ay;
+        if (a.kind == Kind::CIRCLE && b.kind == Kind::CIRCLE) {
+            double reach = static_cast<double>(a.halfWidth) + b.halfWidth;
+            return dx * dx + dy * dy < reach * reach;
+        }
+        if (a.kind == Kind::BOX && b.kind == Kind::BOX) {
+            return std::fabs(dx) < static_cast<double>(a.halfWidth) + b.halfWidth
+                && std::fabs(dy) < static_cast<double>(a.halfHeight) + b.halfHeight;
+        }
+        // Circle / box: distance from the circle's centre to the closest
+        // point of the box
+        const bool aIsBox = a.kind == Kind::BOX;
+        const CollisionShape& boxShape = aIsBox ? a : b;
+        double radius = aIsBox ? b.halfWidth : a.halfWidth;
+        double offsetX = std::fabs(dx) - boxShape.halfWidth;
+        double offsetY = std::fabs(dy) - boxShape.halfHeight;
+        offsetX = offsetX > 0.0 ? offsetX : 0.0;
+        offsetY = offsetY > 0.0 ? offsetY : 0.0;
+        return offsetX * offsetX + offsetY * offsetY < radius * radius;
+    }
+
+    /**
+     * Unit contact normal, pointing from shape b (at bx, by) towards
+     * shape a (at ax, ay): the direction a must not move along
+     *
+     * - b is a box: from the closest point of the box to a's centre; if
+     *   that centre is inside the box, the axis of least penetration
+     * - b is a circle: from centre to centre
+     * @return false if the centres coincide (no direction)
+     */
+    static bool contactNormal(double ax, double ay, const CollisionShape& a,
+                              double bx, double by, const CollisionShape& b,
+                              double& normalX, double& normalY) {
+        double dx = ax - bx;
+        double dy = ay - by;
+        if (b.kind == Kind::BOX) {
+            double offsetX = std::fabs(dx) - b.halfWidth;
+            double offsetY = std::fabs(dy) - b.halfHeight;
+            if (offsetX <= 0.0 && offsetY <= 0.0) {
+                // Centre inside the box: push out along the shallower side
+                bool alongX = offsetX + a.halfWidth > offsetY + a.halfHeight;
+                normalX = alongX ? (dx < 0.0 ? -1.0 : 1.0) : 0.0;
+                normalY = alongX ? 0.0 : (dy < 0.0 ? -1.0 : 1.0);
+                return true;
+            }
+            dx = offsetX > 0.0 ? (dx < 0.0 ? -offsetX : offsetX) : 0.0;
+            dy = offsetY > 0.0 ? (dy < 0.0 ? -offsetY : offsetY) : 0.0;
+        }
+        double length = std::sqrt(dx * dx + dy * dy);
+        if (length == 0.0) {
+            return false;
+        }
+        normalX = dx / length;
+        normalY = dy / length;
+        return true;
+    }
+};
+
+#endif // COLLISIONSHAPE_HPP
@@ -0,0 +1,102 @@
+#include "CombatBuffer.hpp"
+#include "Character.hpp"
+#include "EventBus.hpp"
+#include <algorithm>
+#include <functional>  // std::less (total order on pointers)
+
+// ========== CONSTRUCTOR ==========
+
+CombatBuffer::CombatBuffer()
+    : bus(nullptr)
+{
+}
+
+void CombatBuffer::setEventBus(EventBus* eventBus) {
+    this->bus = eventBus;
+}
+
+
+// ========== QUEUE ==========
+
+void CombatBuffer::reserve(size_t capacity) {
+    commands.reserve(capacity);
+    events.reserve(capacity);
+}
+
+void CombatBuffer::queue(const GameObject* attacker, Character& target, int damage,
+                         Source source, int weapon) {
+    Command command;
+    command.target = &target;
+    command.order = static_cast<uint32_t>(commands.size());
+    command.source = source;
+    command.weapon = weapon;
+    command.attacker = attacker;
+    command.damage = damage;
+    commands.push_back(command);
+}
+
+size_t CombatBuffer::getPendingCount() const {
+    return commands.size();
+}
+
+
+// ========== RESOLUTION ==========
+
+/**
+ * Sort, then walk the commands target by target
+ *
+ * Keys (target, order) are unique, so std::sort (in place, no
+ * allocation, unlike stable_sort) gives the same groups every time.
+ * Within a group the hits land in queue order, exactly as if they had
+ * been applied one by one.
+ */
+const std::vector<CombatBuffer::Event>& CombatBuffer::resolve() {
+    events.resize(commands.size());
+    
+    std::sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+        if (a.target != b.target) {
+            return std::less<Character*>()(a.target, b.target);
+        }
+        return a.order < b.order;
+    });
+    
+    size_t begin = 0;
+    while (begin < commands.size()) {
+        Character* target = commands[begin].target;
+        int health = target->getHealth();
+        
+        size_t end = begin;
+        for (; end < commands.size() && commands[end].target == target; end++) {
+            const Command& command = commands[end];
+            Event& event = events[command.order];
+            event.source = command.source;
+            event.weapon = command.weapon;
+            event.attacker = command.attacker;
+            event.target = target;
+            event.damage = command.damage;
+            event.healthBefore = health;
+            
+            if (health <= 0) {
+                event.outcome = Outcome::ALREADY_DEAD;
+            } else {
+                health = std::max(0, health - command.damage);  // Same clamp as setHealth
+                event.outcome = health == 0 ? Outcome::KILLED : Outcome::DAMAGED;
+            }
+            event.healthAfter = health;
+            
+            if (bus && event.outcome != Outcome::ALREADY_DEAD) {
+                bus->publish(DamagedEvent{ event.attacker, target, event.damage,
+                                           event.healthBefore, event.healthAfter });
+                if (event.outcome == Outcome::KILLED) {
+                    bus->publish(DiedEvent{ target, event.attacker });
+                }
+            }
+        }
+        
+        target->setHealth(health);  // One write per target
+        begin = end;
+    }
+    
+    commands.clear();
+    return events;
+}
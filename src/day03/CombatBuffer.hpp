@@ -0,0 +1,119 @@
+#ifndef COMBATBUFFER_HPP
+#define COMBATBUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+class Character;
+class EventBus;
+
+/**
+ * CombatBuffer - Every hit of a phase, resolved in one batch
+ *
+ * Attacks no longer touch health directly. Each attack appends a
+ * command (attacker, target, damage) to this buffer; at the end of the
+ * phase the Game calls resolve():
+ *
+ * 1. Sort the commands by target (then by the order they were queued)
+ * 2. One pass per target: read its health once, apply every hit,
+ *    detect the killing blow, write the health back once
+ * 3. Emit one Event per command, in the order they were queued, for
+ *    the log (and later systems)
+ *
+ * So the result of a phase does not depend on the order characters
+ * act in: everybody strikes "at the same time", and hits on a target
+ * that died earlier in the batch become ALREADY_DEAD events. Targets
+ * are independent groups, which is what a parallel resolve would need.
+ *
+ * The buffer does not print: the Game turns the events into log lines.
+ * With an EventBus, every hit that lands is also published
+ * (DamagedEvent, then DiedEvent for a killing blow).
+ * Buffers are reserved at setup, so resolving never allocates.
+ */
+class CombatBuffer {
+public:
+    /**
+     * Where a hit comes from (picks the log line)
+     */
+    enum class Source : uint8_t {
+        WEAPON,      // Player weapon (immediate)
+        MELEE,       // Enemy attack
+        PROJECTILE   // Arrow impact
+    };
+
+    enum class Outcome : uint8_t {
+        DAMAGED,      // Hit, target still alive
+        KILLED,       // This hit brought the target to 0
+        ALREADY_DEAD  // Target was dead before this hit (no damage)
+    };
+
+    /**
+     * Result of one command
+     */
+    struct Event {
+        Source source;
+        Outcome outcome;
+        int weapon;                   // Weapon id / projectile kind, -1 = none
+        const GameObject* attacker;
+        Character* target;
+        int damage;
+        int healthBefore;
+        int healthAfter;
+    };
+
+private:
+    struct Command {
+        Character* target;
+        uint32_t order;               // Position in the queue (tie-break, event slot)
+        Source source;
+        int weapon;
+        const GameObject* attacker;
+        int damage;
+    };
+
+    std::vector<Command> commands;
+    std::vector<Event> events;        // Indexed by Command::order
+    EventBus* bus;                    // Damage / death notifications (not owned, may be null)
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    CombatBuffer();
+
+    /**
+     * Publish DamagedEvent / DiedEvent while resolving
+     * @param eventBus Event bus (nullptr = no events)
+     */
+    void setEventBus(EventBus* eventBus);
+
+
+    // ========== QUEUE ==========
+
+    /**
+     * Room for 'capacity' hits per phase without allocating
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Append a hit (applied by the next resolve())
+     * @param weapon Weapon id or projectile kind, -1 if none
+     */
+    void queue(const GameObject* attacker, Character& target, int damage,
+               Source source, int weapon = -1);
+
+    size_t getPendingCount() const;
+
+
+    // ========== RESOLUTION ==========
+
+    /**
+     * Apply every queued hit, grouped by target, and empty the queue
+     * @return One event per command, in queue order (valid until the
+     *         next resolve())
+     */
+    const std::vector<Event>& resolve();
+};
+
+#endif // COMBATBUFFER_HPP
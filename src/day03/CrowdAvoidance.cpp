@@ -0,0 +1,103 @@
+#include "CrowdAvoidance.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// ========== CONSTRUCTOR ==========
+
+CrowdAvoidance::CrowdAvoidance()
+    : grid(NEIGHBOR_RADIUS, GRID_BUCKET_BITS)
+{
+}
+
+
+// ========== FILLING ==========
+
+void CrowdAvoidance::reserve(size_t capacity) {
+    agents.reserve(capacity);
+    posX.reserve(capacity);
+    posY.reserve(capacity);
+    pushX.reserve(capacity);
+    pushY.reserve(capacity);
+    grid.reserve(capacity);
+}
+
+void CrowdAvoidance::clear() {
+    agents.clear();
+    posX.clear();
+    posY.clear();
+    pushX.clear();
+    pushY.clear();
+}
+
+size_t CrowdAvoidance::add(GameObject* agent, double x, double y) {
+    agents.push_back(agent);
+    posX.push_back(x);
+    posY.push_back(y);
+    pushX.push_back(0.0);
+    pushY.push_back(0.0);
+    return agents.size() - 1;
+}
+
+
+// ========== COMPUTE ==========
+
+void CrowdAvoidance::compute(VectorBulk::Execution execution) {
+    grid.clear();
+    for (size_t i = 0; i < agents.size(); i++) {
+        grid.insert(agents[i], posX[i], posY[i], 0.0);
+    }
+    grid.build();
+
+    size_t workers = 1;
+    if (execution == VectorBulk::Execution::PARALLEL && agents.size() >= PARALLEL_MIN_AGENTS) {
+        workers = std::thread::hardware_concurrency();  // 0 if unknown
+        workers = std::max<size_t>(1, std::min(workers, VectorBulk::MAX_WORKERS));
+    }
+    if (workers == 1) {
+        computeRange(0, agents.size());
+        return;
+    }
+    VectorBulk::runChunks(agents.size(), workers, [](void* context, size_t, size_t begin, size_t end) {
+        static_cast<CrowdAvoidance*>(context)->computeRange(begin, end);
+    }, this);
+}
+
+/**
+ * Push of agents [begin, end): reads the grid, writes only their slots
+ */
+void CrowdAvoidance::computeRange(size_t begin, size_t end) {
+    const double radiusSquared = NEIGHBOR_RADIUS * NEIGHBOR_RADIUS;
+    for (size_t i = begin; i < end; i++) {
+        const double x = posX[i];
+        const double y = posY[i];
+        double sumX = 0.0;
+        double sumY = 0.0;
+        int neighbors = 0;
+        grid.query(x - NEIGHBOR_RADIUS, y - NEIGHBOR_RADIUS, x + NEIGHBOR_RADIUS, y + NEIGHBOR_RADIUS,
+                   [&](const SpatialGrid::Entry& entry) {
+                       if (neighbors >= MAX_NEIGHBORS || entry.object == agents[i]) {
+                           return;
+                       }
+                       double dx = x - entry.x;
+                       double dy = y - entry.y;
+                       double distanceSquared = dx * dx + dy * dy;
+                       if (distanceSquared >= radiusSquared || distanceSquared == 0.0) {
+                           return;  // Too far, or no direction to push in
+                       }
+                       double distance = std::sqrt(distanceSquared);
+                       double weight = (1.0 - distance / NEIGHBOR_RADIUS) / distance;
+                       sumX += dx * weight;
+                       sumY += dy * weight;
+                       neighbors++;
+                   });
+
+        double length = std::sqrt(sumX * sumX + sumY * sumY);
+        if (length > MAX_PUSH) {
+            sumX *= MAX_PUSH / length;
+            sumY *= MAX_PUSH / length;
+        }
+        pushX[i] = sumX;
+        pushY[i] = sumY;
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef CROWDAVOIDANCE_HPP
+#define CROWDAVOIDANCE_HPP
+
+#include "SpatialGrid.hpp"
+#include "VectorBulk.hpp"
+#include <cstddef>
+#include <vector>
+
+class GameObject;
+
+/**
+ * CrowdAvoidance - Separation steering for a crowd (boids-style)
+ *
+ * Every enemy beelines at the player, so a crowd ends up single file
+ * behind its leader and the collision response keeps cutting moves
+ * short. Each agent here gets a push away from its close neighbours,
+ * which the Enemy blends into its own direction before moving:
+ *
+ *   push = sum over neighbours closer than NEIGHBOR_RADIUS of
+ *            (away from the neighbour) * (1 - distance / NEIGHBOR_RADIUS)
+ *   then clamped to MAX_PUSH
+ *
+ * Fixed budget per turn: one grid rebuild (counting sort, no
+ * allocation once reserved) and, per agent, one neighbour query that
+ * uses at most MAX_NEIGHBORS neighbours. Agents are independent (they
+ * read the positions of the snapshot, write only their own push), so
+ * large crowds are split into chunks run on worker threads; the result
+ * does not depend on the split.
+ */
+class CrowdAvoidance {
+public:
+    static constexpr double NEIGHBOR_RADIUS = 1.0;  // 2x the collision distance
+    static const int MAX_NEIGHBORS = 8;
+    static constexpr double MAX_PUSH = 1.0;         // Same length as a step direction
+    static const size_t PARALLEL_MIN_AGENTS = 1024;
+    static const int GRID_BUCKET_BITS = 14;  // 16k buckets: ~1 agent per bucket at 10k+
+
+private:
+    std::vector<GameObject*> agents;   // Not owned
+    std::vector<double> posX;
+    std::vector<double> posY;
+    std::vector<double> pushX;
+    std::vector<double> pushY;
+    SpatialGrid grid;                  // Cell = NEIGHBOR_RADIUS
+
+public:
+    CrowdAvoidance();
+
+    /**
+     * Reserve room for 'capacity' agents (no allocation below that)
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Remove every agent (keeps the buffers)
+     */
+    void clear();
+
+    /**
+     * Add an agent at its current position
+     * @return Index of the agent
+     */
+    size_t add(GameObject* agent, double x, double y);
+
+    /**
+     * Compute every push (parallel over chunks of agents if asked and
+     * the crowd is large enough)
+     */
+    void compute(VectorBulk::Execution execution = VectorBulk::Execution::SEQUENTIAL);
+
+    size_t size() const { return agents.size(); }
+    double getPushX(size_t i) const { return pushX[i]; }
+    double getPushY(size_t i) const { return pushY[i]; }
+
+private:
+    void computeRange(size_t begin, size_t end);
+};
+
+#endif // CROWDAVOIDANCE_HPP
@@ -10,6 +10,7 @@
  */
 Decor::Decor() : GameObject(0.0, 0.0, "Decor") {
     // GameObject constructor sets position to (0, 0) and name to "Decor"
+    setCollisionShape(DEFAULT_SHAPE);
 }
 
 /**
@@ -18,7 +19,8 @@ Decor::Decor() : GameObject(0.0, 0.0, "Decor") {
 Decor::Decor(double x, double y, const std::string& name)
     : GameObject(x, y, name) {
     // GameObject constructor sets position and name
-    // Decor has no additional properties to initialize
+    // Decor is static scenery: it blocks characters (arrows fly over it)
+    setCollisionShape(DEFAULT_SHAPE);
 }
 
 /**
@@ -15,6 +15,12 @@
  */
 class Decor : public GameObject {
 public:
+    /**
+     * STATIC layer, blocks characters only (arrows fly over decor)
+     */
+    static constexpr CollisionShape DEFAULT_SHAPE = CollisionShape::circle(
+        CollisionShape::DEFAULT_RADIUS, CollisionLayer::STATIC, CollisionLayer::CHARACTER);
+    
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
     
     /**
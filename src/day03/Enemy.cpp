@@ -1,5 +1,10 @@
 #include "Enemy.hpp"
 #include "UIHelper.hpp"  // JOB 11 - Enhanced UI
+#include "FlowField.hpp"
+#include "Pathfinder.hpp"
+#include "InfluenceMap.hpp"
+#include "SteeringBatch.hpp"
+#include "Visibility.hpp"
 #include <iostream>
 #include <cmath>
 
@@ -11,7 +16,15 @@ Enemy::Enemy(double x, double y, const std::string& name, int health,
       targetPlayer(targetPlayer),
       attackDamage(attackDamage),
       attackRange(1.0),    // Melee range
-      moveSpeed(1.0)       // 1 unit per turn
+      moveSpeed(1.0),      // 1 unit per turn
+      flowField(nullptr),  // Straight-line movement until the Game shares a field
+      pathfinder(nullptr),
+      influenceMap(nullptr),
+      visibility(nullptr),
+      influenceSource(-1),
+      lastTactic(Tactic::APPROACH),
+      avoidX(0.0),
+      avoidY(0.0)
 {
     // Character constructor called first (position, name, health)
     // Then initialize Enemy-specific members
@@ -41,6 +54,38 @@ void Enemy::setTarget(Character* player) {
     this->targetPlayer = player;
 }
 
+Character* Enemy::getTarget() const {
+    return targetPlayer;
+}
+
+void Enemy::setFlowField(const FlowField* field) {
+    this->flowField = field;
+}
+
+void Enemy::setPathfinder(Pathfinder* service) {
+    this->pathfinder = service;
+}
+
+void Enemy::setInfluenceMap(const InfluenceMap* map) {
+    this->influenceMap = map;
+}
+
+void Enemy::setVisibility(const VisibilityField* field) {
+    this->visibility = field;
+}
+
+int Enemy::getInfluenceSource() const {
+    return influenceSource;
+}
+
+void Enemy::setInfluenceSource(int handle) {
+    this->influenceSource = handle;
+}
+
+Enemy::Tactic Enemy::getLastTactic() const {
+    return lastTactic;
+}
+
 
 // ========== OVERRIDE METHODS ==========
 
@@ -48,7 +93,9 @@ void Enemy::draw() const {
     // JOB 11: Enhanced UI with colors and health bars
     std::cout << "[ENEMY '" << UI::COLOR_BRIGHT_RED << getName() << UI::COLOR_RESET << "'] ";
     std::cout << "Pos:(" << getX() << ", " << getY() << ") ";
-    std::cout << "HP: " << UI::getHealthBar(getHealth(), 100, 10, true) << " ";
+    std::cout << "HP: ";
+    UI::drawHealthBar(getHealth(), 100, 10, true);
+    std::cout << " ";
     std::cout << "Dmg:" << UI::COLOR_RED << attackDamage << UI::COLOR_RESET << " ";
     
     if (isAlive()) {
@@ -64,83 +111,148 @@ void Enemy::draw() const {
  * 
  * This implements a simple but effective AI:
  * - Calculate distance to player
- * - If too far: pathfind towards player
  * - If in range: attack player
+ * - If too far: approach or flank, depending on the influence map
  * 
  * This is exactly how real game AI works (Unity, Unreal, etc.)
  */
 void Enemy::update() {
+    if (!canAct()) {
+        return;
+    }
+    
+    // Range test on the squared distance, then one sqrt for the
+    // distance and the direction
+    double distSquared = distanceSquared(*targetPlayer);
+    bool inRange = distSquared <= attackRange * attackRange;
+    double dist = std::sqrt(distSquared);
+    double dirX = 0.0, dirY = 0.0;
+    if (dist > SteeringBatch::MIN_DISTANCE) {
+        dirX = (targetPlayer->getX() - getX()) / dist;
+        dirY = (targetPlayer->getY() - getY()) / dist;
+    }
+    
+    act(dist, dirX, dirY, inRange);
+}
+
+/**
+ * Batched update - same decisions as update(), but the distance,
+ * direction and range test come from the Game's SteeringBatch
+ */
+void Enemy::updateSteered(double dist, double dirX, double dirY, bool inRange,
+                          double pushX, double pushY) {
+    if (!canAct()) {
+        return;
+    }
+    avoidX = pushX;
+    avoidY = pushY;
+    act(dist, dirX, dirY, inRange);
+    avoidX = 0.0;
+    avoidY = 0.0;
+}
+
+
+// ========== PRIVATE HELPER METHODS ==========
+
+bool Enemy::canAct() const {
     // Safety checks
     if (!isAlive()) {
         std::cout << "  > " << getName() << " is dead (no AI)" << std::endl;
-        return;
+        return false;
     }
     
     if (!targetPlayer || !targetPlayer->isAlive()) {
         std::cout << "  > " << getName() << " has no valid target" << std::endl;
-        return;
+        return false;
     }
-    
-    // Calculate distance to target using inherited Vector2d method!
-    double dist = distance(*targetPlayer);
-    
+    return true;
+}
+
+void Enemy::act(double dist, double dirX, double dirY, bool inRange) {
     std::cout << "  > " << getName() << " AI: ";
     std::cout << "Distance to target = " << dist;
     
-    // Decision making: Move or Attack?
-    if (dist <= attackRange) {
-        // In attack range - ATTACK!
-        std::cout << " [IN RANGE - ATTACKING!]" << std::endl;
-        attackTarget();
-    } else {
-        // Too far - MOVE CLOSER
-        std::cout << " [MOVING CLOSER]" << std::endl;
-        moveTowardsTarget();
+    // Decision making: Attack, approach or flank?
+    lastTactic = chooseTactic(inRange);
+    switch (lastTactic) {
+        case Tactic::ATTACK:
+            // In attack range - ATTACK!
+            std::cout << " [IN RANGE - ATTACKING!]" << std::endl;
+            attackTarget();
+            break;
+        case Tactic::APPROACH:
+            // Too far - MOVE CLOSER
+            std::cout << " [MOVING CLOSER]" << std::endl;
+            moveTowardsTarget(dirX, dirY);
+            break;
+        case Tactic::FLANK:
+            // Too far and exposed - MOVE CLOSER THROUGH COVER
+            std::cout << " [FLANKING]" << std::endl;
+            flankTarget(dist, dirX, dirY);
+            break;
     }
 }
 
-
-// ========== PRIVATE HELPER METHODS ==========
-
 /**
  * Pathfinding: Move towards target
  * 
- * This is basic vector math pathfinding:
- * 1. Calculate direction vector (dx, dy)
- * 2. Normalize it (make length = 1)
- * 3. Scale by moveSpeed
- * 4. Add to current position
+ * Shared flow field (preferred):
+ * - The Game builds one field per turn towards the player
+ * - We just read the direction stored in our cell (O(1))
+ * - The field already goes around Decor obstacles
  * 
- * This is REAL game AI pathfinding!
+ * A* service (target is not the field's target):
+ * - Cached path from our cell to the target's cell
+ * - Next turns reuse the same cached path
+ * 
+ * Fallback - basic vector math:
+ * 1-2. Normalized direction (dx, dy) / distance, already computed by
+ *      update() or by the Game's SteeringBatch
+ * 
+ * Then in both cases:
+ * 3. Crowd push (if any): direction + AVOIDANCE_WEIGHT * push,
+ *    normalized again. The push is at most 1 long, so the move still
+ *    closes in: it only bends around the neighbours
+ * 4. Scale by moveSpeed
+ * 5. Add to current position
  */
-void Enemy::moveTowardsTarget() {
+void Enemy::moveTowardsTarget(double straightX, double straightY) {
     // Get target position
     double targetX = targetPlayer->getX();
     double targetY = targetPlayer->getY();
     
-    // Calculate direction vector
-    double dx = targetX - getX();
-    double dy = targetY - getY();
+    double ndx, ndy;
     
-    // Calculate distance (for normalization)
-    double dist = std::sqrt(dx * dx + dy * dy);
+    // Follow the shared field only if it leads to OUR target
+    bool onField = flowField
+        && flowField->isTargetCell(targetX, targetY)
+        && flowField->getDirection(getX(), getY(), ndx, ndy);
     
-    // Edge case: already at target (shouldn't happen, but safe)
-    if (dist < 0.0001) {
-        return;
-    }
+    bool onPath = !onField && pathfinder
+        && pathfinder->getNextStep(getX(), getY(), targetX, targetY, ndx, ndy);
     
-    // Normalize direction vector (make it length = 1)
-    double ndx = dx / dist;
-    double ndy = dy / dist;
+    if (!onField && !onPath) {
+        // Edge case: already at target (shouldn't happen, but safe)
+        if (straightX == 0.0 && straightY == 0.0) {
+            return;
+        }
+        
+        // Straight line: normalized direction computed by the caller
+        ndx = straightX;
+        ndy = straightY;
+    }
     
-    // Move moveSpeed units in that direction
-    double newX = getX() + ndx * moveSpeed;
-    double newY = getY() + ndy * moveSpeed;
+    if (avoidX != 0.0 || avoidY != 0.0) {
+        double blendX = ndx + AVOIDANCE_WEIGHT * avoidX;
+        double blendY = ndy + AVOIDANCE_WEIGHT * avoidY;
+        double length = std::sqrt(blendX * blendX + blendY * blendY);
+        ndx = blendX / length;
+        ndy = blendY / length;
+    }
     
-    // Update position
-    setX(newX);
-    setY(newY);
+    // Move moveSpeed units in that direction (one fused expression,
+    // validated once)
+    *this += Vector2d(ndx, ndy) * moveSpeed;
     
     std::cout << "    → Moved from (" << getX() - ndx * moveSpeed 
               << ", " << getY() - ndy * moveSpeed << ") to ("
@@ -148,25 +260,116 @@ void Enemy::moveTowardsTarget() {
 }
 
 /**
- * Attack the target player
+ * Tactical decision from the influence map
+ * 
+ * - threat: how deep we are inside the player's weapon range
+ * - allies: enemy density around us, minus our own stamp (1.0 at our cell)
+ * 
+ * Outside the danger zone, or with friends around, the shortest path
+ * is the best one. Alone under fire, we flank.
  * 
- * Simple melee attack:
- * - Reduce target's health by attackDamage
- * - Provide feedback
+ * Line of sight: no attack through decor (even in range), and out of
+ * the target's view there is no fire to avoid, so we approach.
  */
-void Enemy::attackTarget() {
-    int currentHealth = targetPlayer->getHealth();
-    int newHealth = currentHealth - attackDamage;
-    targetPlayer->setHealth(newHealth);
+Enemy::Tactic Enemy::chooseTactic(bool inRange) const {
+    bool seen = inTargetView();
+    if (inRange && seen) {
+        return Tactic::ATTACK;
+    }
+    if (!influenceMap || !seen) {
+        return Tactic::APPROACH;
+    }
     
-    std::cout << "    💥 " << getName() << " attacks " << targetPlayer->getName();
-    std::cout << " for " << attackDamage << " damage! ";
-    std::cout << "(HP: " << currentHealth << " → " << targetPlayer->getHealth() << ")";
+    double threat = influenceMap->sample(InfluenceLayer::THREAT, getX(), getY());
+    double allies = influenceMap->sample(InfluenceLayer::DENSITY, getX(), getY());
+    if (influenceSource >= 0) {
+        allies -= 1.0;
+    }
     
-    if (!targetPlayer->isAlive()) {
-        std::cout << " [PLAYER DEFEATED!]";
+    if (threat < THREAT_CAUTION || allies >= GROUP_COURAGE) {
+        return Tactic::APPROACH;
+    }
+    return Tactic::FLANK;
+}
+
+bool Enemy::inTargetView() const {
+    if (!visibility || !visibility->isOriginCell(targetPlayer->getX(), targetPlayer->getY())) {
+        return true;
+    }
+    return visibility->isVisible(getX(), getY());
+}
+
+/**
+ * Flanking move
+ * 
+ * Look at the 8 neighbouring cells; keep those we can step to and
+ * that are closer to the target than we are; score each one:
+ *   score = threat - COVER_WEIGHT * cover + CROWD_WEIGHT * density
+ * and move moveSpeed units towards the lowest score.
+ */
+void Enemy::flankTarget(double currentDist, double straightX, double straightY) {
+    const NavGrid* grid = influenceMap ? influenceMap->getGrid() : nullptr;
+    int cx, cy;
+    if (!grid || !grid->worldToCell(getX(), getY(), cx, cy)) {
+        moveTowardsTarget(straightX, straightY);
+        return;
     }
     
-    std::cout << std::endl;
+    const double currentDistSquared = currentDist * currentDist;
+    bool found = false;
+    double bestScore = 0.0;
+    double bestX = 0.0, bestY = 0.0;
+    
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            if ((dx == 0 && dy == 0) || !grid->canStep(cx, cy, dx, dy)) {
+                continue;
+            }
+            double candidateX = grid->cellCenterX(cx + dx);
+            double candidateY = grid->cellCenterY(cy + dy);
+            if (targetPlayer->distanceSquared(Vector2d(candidateX, candidateY)) >= currentDistSquared) {
+                continue;  // Flanking still has to close in
+            }
+            
+            double score = influenceMap->sampleCell(InfluenceLayer::THREAT, cx + dx, cy + dy)
+                         - COVER_WEIGHT * influenceMap->sampleCell(InfluenceLayer::COVER, cx + dx, cy + dy)
+                         + CROWD_WEIGHT * influenceMap->sampleCell(InfluenceLayer::DENSITY, cx + dx, cy + dy);
+            if (!found || score < bestScore) {
+                found = true;
+                bestScore = score;
+                bestX = candidateX;
+                bestY = candidateY;
+            }
+        }
+    }
+    
+    if (!found) {
+        moveTowardsTarget(straightX, straightY);
+        return;
+    }
+    
+    double dx = bestX - getX();
+    double dy = bestY - getY();
+    double len = std::sqrt(dx * dx + dy * dy);
+    if (len < 0.0001) {
+        return;
+    }
+    double oldX = getX();
+    double oldY = getY();
+    *this += Vector2d(dx / len, dy / len) * moveSpeed;
+    
+    std::cout << "    ↪ Flanked from (" << oldX << ", " << oldY << ") to ("
+              << getX() << ", " << getY() << ")" << std::endl;
+}
+
+/**
+ * Attack the target player
+ * 
+ * Simple melee attack: queue attackDamage on the target. Every enemy
+ * of the phase strikes at the same time; the Game applies the hits
+ * and logs them when it resolves the combat buffer.
+ */
+void Enemy::attackTarget() {
+    dealDamage(*targetPlayer, attackDamage, CombatBuffer::Source::MELEE);
 }
 
@@ -3,8 +3,12 @@
 
 #include "Character.hpp"
 
-// Forward declaration to avoid circular dependency
+// Forward declarations to avoid circular dependency
 class Player;
+class FlowField;
+class Pathfinder;
+class InfluenceMap;
+class VisibilityField;
 
 /**
  * Enemy - AI-controlled hostile character
@@ -13,8 +17,13 @@ class Player;
  * 
  * AI Behavior (update method):
  * 1. Calculate distance to target player
- * 2. If distance > 1.0: Move progressively towards player (pathfinding)
- * 3. If distance ≤ 1.0: Attack player with melee damage
+ * 2. If distance ≤ 1.0: Attack player with melee damage
+ * 3. Otherwise read the influence map and pick a tactic:
+ *    - APPROACH: not threatened yet, or backed by allies
+ *      -> move progressively towards player (pathfinding)
+ *    - FLANK: alone inside the player's weapon range
+ *      -> close in through the safest neighbouring cell (cover, low
+ *         threat, away from other enemies)
  * 
  * This demonstrates:
  * - AI pathfinding (movement towards target)
@@ -24,11 +33,39 @@ class Player;
  * Inheritance: Enemy -> Character -> GameObject -> Vector2d
  */
 class Enemy : public Character {
+public:
+    /**
+     * Decision taken by the AI this turn
+     */
+    enum class Tactic {
+        ATTACK,     // Target in range
+        APPROACH,   // Straight to the target (path / flow field)
+        FLANK       // Close in through cover, spreading out
+    };
+
+    static constexpr int INFLUENCE_RADIUS = 3;  // Cells covered by our density stamp
+
 private:
+    // ========== TACTICAL TUNING ==========
+    static constexpr double THREAT_CAUTION = 0.25;   // Threat above this: be careful
+    static constexpr double GROUP_COURAGE = 0.75;    // Allied density that makes us charge
+    static constexpr double COVER_WEIGHT = 0.5;      // Cover bonus when flanking
+    static constexpr double CROWD_WEIGHT = 0.5;      // Crowding penalty when flanking
+    static constexpr double AVOIDANCE_WEIGHT = 0.5;  // Crowd push vs path direction
+
+
     Character* targetPlayer;  // Reference to player to attack
     int attackDamage;         // Melee attack damage
     double attackRange;       // Attack range (1.0 for melee)
     double moveSpeed;         // Movement speed (units per turn)
+    const FlowField* flowField;  // Shared pathfinding field (not owned, may be null)
+    Pathfinder* pathfinder;      // A* service for other targets (not owned, may be null)
+    const InfluenceMap* influenceMap;  // Tactical layers (not owned, may be null)
+    const VisibilityField* visibility; // Target's field of view (not owned, may be null)
+    int influenceSource;         // Our density source in the map, or -1
+    Tactic lastTactic;           // Decision of the last update
+    double avoidX;               // Crowd push for the move in progress (CrowdAvoidance)
+    double avoidY;
 
 public:
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
@@ -77,6 +114,50 @@ public:
      */
     void setTarget(Character* player);
     
+    /**
+     * Set the shared flow field used for pathfinding
+     * @param field Field built by the Game once per turn (nullptr = straight line)
+     * 
+     * The field is only followed when it flows towards this enemy's target.
+     */
+    void setFlowField(const FlowField* field);
+    
+    /**
+     * Set the A* service used when the flow field does not lead to our target
+     * @param service Shared pathfinder (nullptr = straight line)
+     */
+    void setPathfinder(Pathfinder* service);
+    
+    /**
+     * Set the influence map read by the tactical decision
+     * @param map Shared map updated by the Game each turn (nullptr = always approach)
+     */
+    void setInfluenceMap(const InfluenceMap* map);
+    
+    /**
+     * Set the field of view the Game builds from the player's cell
+     * @param field nullptr = the target always sees us
+     * 
+     * Only used while the field's viewer is our target.
+     */
+    void setVisibility(const VisibilityField* field);
+    
+    /**
+     * Handle of the density source the Game stamps for this enemy
+     * @return Source handle, or -1 if none
+     */
+    int getInfluenceSource() const;
+    
+    /**
+     * Set the handle of our density source (-1 = none)
+     */
+    void setInfluenceSource(int handle);
+    
+    /**
+     * Get the tactic chosen by the last update
+     */
+    Tactic getLastTactic() const;
+    
     
     // ========== OVERRIDE METHODS ==========
     
@@ -91,25 +172,87 @@ public:
      * Implements enemy AI behavior:
      * 1. Check if alive and has valid target
      * 2. Calculate distance to target
-     * 3. If far: Move towards target (pathfinding)
-     * 4. If close: Attack target
+     * 3. Choose a tactic (chooseTactic)
+     * 4. Attack, approach or flank
      * 
      * This is the CORE of enemy AI!
      */
     void update() override;
+    
+    /**
+     * AI Update with precomputed steering (batched enemy phase)
+     * @param dist Distance to the target
+     * @param dirX Unit direction to the target x (0 if on the target)
+     * @param dirY Unit direction to the target y
+     * @param inRange true if dist <= attack range
+     * @param pushX Separation from nearby enemies (CrowdAvoidance), blended
+     * @param pushY into the direction of an approach move
+     * 
+     * Same behavior as update(), without recomputing distance/direction.
+     */
+    void updateSteered(double dist, double dirX, double dirY, bool inRange,
+                       double pushX = 0.0, double pushY = 0.0);
+    
+    /**
+     * Get the current target
+     * @return Target character (may be null)
+     */
+    Character* getTarget() const;
 
 private:
     // ========== PRIVATE HELPER METHODS ==========
     
+    /**
+     * Check that we are alive and have a living target (prints why not)
+     */
+    bool canAct() const;
+    
+    /**
+     * Decide and perform this turn's action
+     * @param dist Distance to the target
+     * @param dirX Unit direction to the target x
+     * @param dirY Unit direction to the target y
+     * @param inRange true if the target is within attack range
+     */
+    void act(double dist, double dirX, double dirY, bool inRange);
+    
     /**
      * Move towards target player
-     * Uses normalized direction vector to move exactly moveSpeed units
+     * @param straightX Straight-line unit direction x (fallback)
+     * @param straightY Straight-line unit direction y
+     * Follows the shared flow field around obstacles when available,
+     * then the cached A* path to our own target, otherwise uses the
+     * straight-line normalized direction.
+     * Moves exactly moveSpeed units either way.
+     */
+    void moveTowardsTarget(double straightX, double straightY);
+    
+    /**
+     * Pick attack, approach or flank from range, line of sight and
+     * influence layers
+     * @param inRange true if the target is within attack range
+     */
+    Tactic chooseTactic(bool inRange) const;
+    
+    /**
+     * Does our target see us? (O(1) lookup in the shared field of view;
+     * true without a field, or if it was built for someone else)
+     */
+    bool inTargetView() const;
+    
+    /**
+     * Flank: step to the neighbouring cell that gets closer to the target
+     * with the best cover / threat / crowding score
+     * @param currentDist Distance to the target
+     * @param straightX Fallback direction x (see moveTowardsTarget)
+     * @param straightY Fallback direction y
+     * Falls back to moveTowardsTarget() if no neighbour gets closer.
      */
-    void moveTowardsTarget();
+    void flankTarget(double currentDist, double straightX, double straightY);
     
     /**
      * Attack the target player
-     * Deals attackDamage to target
+     * Queues attackDamage on the target (resolved by the Game)
      */
     void attackTarget();
 };
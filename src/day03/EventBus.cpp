@@ -0,0 +1,32 @@
+#include "EventBus.hpp"
+
+// ========== CONSTRUCTOR ==========
+
+EventBus::EventBus()
+    : dropped(0)
+{
+    reserve(DEFAULT_CAPACITY);
+}
+
+void EventBus::reserve(size_t capacityPerChannel) {
+    spawned.queue.reserve(capacityPerChannel);
+    damaged.queue.reserve(capacityPerChannel);
+    died.queue.reserve(capacityPerChannel);
+    projectileExpired.queue.reserve(capacityPerChannel);
+}
+
+
+// ========== DRAIN ==========
+
+size_t EventBus::drain() {
+    size_t delivered = 0;
+    delivered += spawned.drain();
+    delivered += damaged.drain();
+    delivered += died.drain();
+    delivered += projectileExpired.drain();
+    return delivered;
+}
+
+size_t EventBus::getDroppedCount() const {
+    return dropped.load(std::memory_order_relaxed);
+}
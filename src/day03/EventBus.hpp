@@ -0,0 +1,175 @@
+#ifndef EVENTBUS_HPP
+#define EVENTBUS_HPP
+
+#include "MpscQueue.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+class Character;
+
+// ========== EVENT TYPES ==========
+
+/**
+ * A character lost health (one per resolved hit)
+ */
+struct DamagedEvent {
+    const GameObject* attacker;
+    Character* target;
+    int damage;
+    int healthBefore;
+    int healthAfter;
+};
+
+/**
+ * A character reached 0 health (after its DamagedEvent)
+ */
+struct DiedEvent {
+    Character* victim;
+    const GameObject* killer;
+};
+
+/**
+ * An object was added to the world
+ */
+struct SpawnedEvent {
+    GameObject* object;
+};
+
+/**
+ * A projectile left the world (hit something or reached its range)
+ */
+struct ProjectileExpiredEvent {
+    uint8_t kind;            // ProjectileSystem::Kind
+    bool hit;                // false = dropped at max range
+    double x;                // Where it stopped
+    double y;
+};
+
+
+/**
+ * EventBus - Typed notifications from the engine to whoever listens
+ *
+ * Producers (combat resolution, projectiles, the manager...) publish
+ * events instead of the UI and stats polling every object. Each event
+ * type has its own channel:
+ *
+ *   publish(event)  any thread, lock-free (MpscQueue), never allocates
+ *   drain()         the Game's thread, once per turn: every queued event
+ *                   goes to the channel's subscribers, in publish order
+ *
+ * Subscribers are plain function pointers + context (same shape as the
+ * VectorBulk chunk tasks): no std::function, no allocation on delivery.
+ * Subscribe and reserve() at setup, before any producer runs.
+ *
+ * Pointers in events are valid until the end of the turn's drain: the
+ * Game drains before it removes dead objects.
+ *
+ * Ordering: FIFO per channel; drain() delivers the channels in a fixed
+ * order (Spawned, Damaged, Died, ProjectileExpired), so a Died always
+ * comes after the Damaged that caused it.
+ * Full channel: the event is dropped and counted (getDroppedCount), so
+ * size the channels for the worst turn (the Game does it for its world).
+ */
+class EventBus {
+public:
+    template<typename Event>
+    struct Subscriber {
+        void (*handler)(void* context, const Event& event);
+        void* context;
+    };
+
+private:
+    /**
+     * One event type: its queue and its subscribers
+     */
+    template<typename Event>
+    struct Channel {
+        MpscQueue<Event> queue;
+        std::vector<Subscriber<Event>> subscribers;
+
+        size_t drain() {
+            size_t delivered = 0;
+            Event event;
+            while (queue.pop(event)) {
+                for (const Subscriber<Event>& subscriber : subscribers) {
+                    subscriber.handler(subscriber.context, event);
+                }
+                delivered++;
+            }
+            return delivered;
+        }
+    };
+
+    Channel<SpawnedEvent> spawned;
+    Channel<DamagedEvent> damaged;
+    Channel<DiedEvent> died;
+    Channel<ProjectileExpiredEvent> projectileExpired;
+    std::atomic<size_t> dropped;
+
+    Channel<SpawnedEvent>& channel(const SpawnedEvent*) { return spawned; }
+    Channel<DamagedEvent>& channel(const DamagedEvent*) { return damaged; }
+    Channel<DiedEvent>& channel(const DiedEvent*) { return died; }
+    Channel<ProjectileExpiredEvent>& channel(const ProjectileExpiredEvent*) { return projectileExpired; }
+
+public:
+    static const size_t DEFAULT_CAPACITY = 1024;  // Events per channel per turn
+
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * Every channel gets DEFAULT_CAPACITY slots
+     */
+    EventBus();
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    /**
+     * Resize every channel (setup only, drops queued events)
+     */
+    void reserve(size_t capacityPerChannel);
+
+
+    // ========== SUBSCRIBE (setup) ==========
+
+    /**
+     * handler(context, event) is called by drain() for every event of
+     * this type
+     */
+    template<typename Event>
+    void subscribe(void (*handler)(void* context, const Event& event), void* context) {
+        channel(static_cast<const Event*>(nullptr)).subscribers.push_back(Subscriber<Event>{ handler, context });
+    }
+
+
+    // ========== PUBLISH (any thread) ==========
+
+    /**
+     * Queue an event for the next drain()
+     * @return false if the channel is full (event dropped)
+     */
+    template<typename Event>
+    bool publish(const Event& event) {
+        if (channel(&event).queue.push(event)) {
+            return true;
+        }
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+
+    // ========== DRAIN (Game thread, once per turn) ==========
+
+    /**
+     * Deliver every queued event to its subscribers
+     * @return Number of events delivered
+     */
+    size_t drain();
+
+    size_t getDroppedCount() const;
+};
+
+#endif // EVENTBUS_HPP
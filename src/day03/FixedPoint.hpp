@@ -0,0 +1,106 @@
+#ifndef FIXEDPOINT_HPP
+#define FIXEDPOINT_HPP
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Fixed32x32 - Signed 32.32 fixed-point number
+ *
+ * Stored in one int64_t: 32 integer bits (sign included) and 32
+ * fraction bits, so:
+ * - Range: about -2147483648 .. 2147483647
+ * - Step: 2^-32 (about 2.3e-10), the SAME everywhere in the range
+ *   (a float at x = 10000 only has a step of about 0.001)
+ * - Addition / subtraction are exact integer operations: positions
+ *   never drift and results are identical on every CPU
+ *
+ * Multiplication and division go through a 128-bit intermediate when
+ * the compiler has one, otherwise through double.
+ * sqrt() goes through double (53 bits are enough for distances).
+ *
+ * Note: a product overflows if its result leaves the range, e.g. the
+ * squared length of a vector longer than ~46340 units.
+ */
+class Fixed32x32 {
+public:
+    static constexpr int FRACTION_BITS = 32;
+    static constexpr double ONE = 4294967296.0;          // 2^32
+    static constexpr double MAX_VALUE = 2147483647.0;    // Largest integer part
+
+private:
+    int64_t raw;    // value * 2^32
+
+public:
+    // ========== CONSTRUCTORS & CONVERSIONS ==========
+
+    constexpr Fixed32x32() : raw(0) {}
+
+    /**
+     * Build from the raw representation (value * 2^32)
+     */
+    static constexpr Fixed32x32 fromRaw(int64_t value) {
+        Fixed32x32 result;
+        result.raw = value;
+        return result;
+    }
+
+    /**
+     * Build from a double (rounded to the nearest step, halves away from 0)
+     * @param value Must be finite and within +/- MAX_VALUE
+     */
+    static constexpr Fixed32x32 fromDouble(double value) {
+        return fromRaw(static_cast<int64_t>(value * ONE + (value < 0.0 ? -0.5 : 0.5)));
+    }
+
+    constexpr int64_t getRaw() const { return raw; }
+
+    constexpr double toDouble() const { return static_cast<double>(raw) / ONE; }
+
+
+    // ========== ARITHMETIC ==========
+
+    constexpr Fixed32x32 operator+(Fixed32x32 other) const { return fromRaw(raw + other.raw); }
+    constexpr Fixed32x32 operator-(Fixed32x32 other) const { return fromRaw(raw - other.raw); }
+    constexpr Fixed32x32 operator-() const { return fromRaw(-raw); }
+
+    constexpr Fixed32x32 operator*(Fixed32x32 other) const {
+#ifdef __SIZEOF_INT128__
+        __int128 product = static_cast<__int128>(raw) * other.raw;
+        return fromRaw(static_cast<int64_t>(product >> FRACTION_BITS));
+#else
+        return fromDouble(toDouble() * other.toDouble());
+#endif
+    }
+
+    constexpr Fixed32x32 operator/(Fixed32x32 other) const {
+#ifdef __SIZEOF_INT128__
+        __int128 numerator = static_cast<__int128>(raw) * (static_cast<int64_t>(1) << FRACTION_BITS);
+        return fromRaw(static_cast<int64_t>(numerator / other.raw));
+#else
+        return fromDouble(toDouble() / other.toDouble());
+#endif
+    }
+
+    constexpr Fixed32x32& operator+=(Fixed32x32 other) { raw += other.raw; return *this; }
+    constexpr Fixed32x32& operator-=(Fixed32x32 other) { raw -= other.raw; return *this; }
+
+
+    // ========== COMPARISONS ==========
+
+    constexpr bool operator==(Fixed32x32 other) const { return raw == other.raw; }
+    constexpr bool operator!=(Fixed32x32 other) const { return raw != other.raw; }
+    constexpr bool operator<(Fixed32x32 other) const { return raw < other.raw; }
+    constexpr bool operator<=(Fixed32x32 other) const { return raw <= other.raw; }
+    constexpr bool operator>(Fixed32x32 other) const { return raw > other.raw; }
+    constexpr bool operator>=(Fixed32x32 other) const { return raw >= other.raw; }
+};
+
+/**
+ * Square root (through double)
+ */
+inline Fixed32x32 sqrt(Fixed32x32 value) {
+    return Fixed32x32::fromDouble(std::sqrt(value.toDouble()));
+}
+
+#endif // FIXEDPOINT_HPP
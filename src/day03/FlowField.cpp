@@ -0,0 +1,182 @@
+#include "FlowField.hpp"
+#include <cmath>
+
+namespace {
+    // 8 neighbours: 4 straight then 4 diagonal
+    const int NEIGHBOUR_DX[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+    const int NEIGHBOUR_DY[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+}
+
+// ========== CONSTRUCTOR ==========
+
+FlowField::FlowField()
+    : grid(nullptr),
+      targetCellX(0),
+      targetCellY(0),
+      gridVersion(0),
+      valid(false)
+{
+}
+
+
+// ========== BUILDING ==========
+
+void FlowField::reserve(const NavGrid& navGrid) {
+    const size_t cellCount = navGrid.getCellCount();
+    steps.reserve(cellCount);
+    dirX.reserve(cellCount);
+    dirY.reserve(cellCount);
+    queue.reserve(cellCount);
+}
+
+/**
+ * Build integration + flow fields
+ *
+ * BFS from the target: every walkable cell receives its distance in
+ * steps. Then each cell points to the neighbour closest to the target.
+ * Complexity: O(cells) once per turn, shared by all enemies.
+ */
+bool FlowField::build(const NavGrid& navGrid, double targetX, double targetY) {
+    int tx, ty;
+    if (!navGrid.worldToCell(targetX, targetY, tx, ty)) {
+        invalidate();
+        return false;  // Target outside the grid
+    }
+
+    // Same grid, same target cell: last build is still correct
+    if (valid && grid == &navGrid && gridVersion == navGrid.getVersion()
+        && tx == targetCellX && ty == targetCellY) {
+        return true;
+    }
+
+    grid = &navGrid;
+    targetCellX = tx;
+    targetCellY = ty;
+    gridVersion = navGrid.getVersion();
+
+    const size_t cellCount = navGrid.getCellCount();
+    steps.assign(cellCount, UNREACHABLE);  // Only allocates if the grid outgrew reserve()
+    dirX.assign(cellCount, 0.0f);
+    dirY.assign(cellCount, 0.0f);
+    queue.resize(cellCount);
+
+    // ---- Integration field (BFS) ----
+    // The target cell is always a seed, even if a decor overlaps it
+    int head = 0, tail = 0;
+    steps[navGrid.index(tx, ty)] = 0;
+    queue[tail++] = navGrid.index(tx, ty);
+
+    const int width = navGrid.getWidth();
+    while (head < tail) {
+        int current = queue[head++];
+        int cx = current % width;
+        int cy = current / width;
+        int nextSteps = steps[current] + 1;
+
+        for (int n = 0; n < 8; n++) {
+            if (!navGrid.canStep(cx, cy, NEIGHBOUR_DX[n], NEIGHBOUR_DY[n])) {
+                continue;
+            }
+            int neighbour = navGrid.index(cx + NEIGHBOUR_DX[n], cy + NEIGHBOUR_DY[n]);
+            if (steps[neighbour] == UNREACHABLE) {
+                steps[neighbour] = nextSteps;
+                queue[tail++] = neighbour;
+            }
+        }
+    }
+
+    // ---- Flow field (best neighbour per cell) ----
+    for (int cy = 0; cy < navGrid.getHeight(); cy++) {
+        for (int cx = 0; cx < width; cx++) {
+            int cell = navGrid.index(cx, cy);
+            if (steps[cell] <= 0) {
+                continue;  // Unreachable or the target itself
+            }
+
+            bool found = false;
+            int bestSteps = 0;
+            int bestDx = 0, bestDy = 0;
+            double bestDistance = 0.0;
+
+            for (int n = 0; n < 8; n++) {
+                int dx = NEIGHBOUR_DX[n];
+                int dy = NEIGHBOUR_DY[n];
+                if (!navGrid.canStep(cx, cy, dx, dy)) {
+                    continue;
+                }
+                int neighbourSteps = steps[navGrid.index(cx + dx, cy + dy)];
+                if (neighbourSteps == UNREACHABLE || neighbourSteps >= steps[cell]) {
+                    continue;  // Only step closer to the target
+                }
+                // Tie-break: straight-line distance to the target (smoother paths)
+                double ex = (cx + dx) - tx;
+                double ey = (cy + dy) - ty;
+                double distance = ex * ex + ey * ey;
+                if (!found || neighbourSteps < bestSteps
+                    || (neighbourSteps == bestSteps && distance < bestDistance)) {
+                    found = true;
+                    bestSteps = neighbourSteps;
+                    bestDistance = distance;
+                    bestDx = dx;
+                    bestDy = dy;
+                }
+            }
+
+            double length = std::sqrt(static_cast<double>(bestDx * bestDx + bestDy * bestDy));
+            if (length > 0.0) {
+                dirX[cell] = static_cast<float>(bestDx / length);
+                dirY[cell] = static_cast<float>(bestDy / length);
+            }
+        }
+    }
+
+    valid = true;
+    return true;
+}
+
+void FlowField::invalidate() {
+    valid = false;
+}
+
+
+// ========== QUERIES ==========
+
+bool FlowField::isValid() const {
+    return valid && grid && grid->getVersion() == gridVersion;
+}
+
+bool FlowField::isTargetCell(double x, double y) const {
+    if (!isValid()) {
+        return false;
+    }
+    int cx, cy;
+    return grid->worldToCell(x, y, cx, cy) && cx == targetCellX && cy == targetCellY;
+}
+
+bool FlowField::getDirection(double x, double y, double& outX, double& outY) const {
+    if (!isValid()) {
+        return false;
+    }
+    int cx, cy;
+    if (!grid->worldToCell(x, y, cx, cy)) {
+        return false;
+    }
+    int cell = grid->index(cx, cy);
+    if (steps[cell] <= 0) {
+        return false;  // Unreachable, or already in the target cell
+    }
+    outX = dirX[cell];
+    outY = dirY[cell];
+    return true;
+}
+
+int FlowField::getSteps(double x, double y) const {
+    if (!isValid()) {
+        return UNREACHABLE;
+    }
+    int cx, cy;
+    if (!grid->worldToCell(x, y, cx, cy)) {
+        return UNREACHABLE;
+    }
+    return steps[grid->index(cx, cy)];
+}
@@ -0,0 +1,109 @@
+#ifndef FLOWFIELD_HPP
+#define FLOWFIELD_HPP
+
+#include "NavGrid.hpp"
+#include <vector>
+
+/**
+ * FlowField - Shared pathfinding towards one target (the player)
+ *
+ * Instead of every enemy searching its own path, the game builds ONE
+ * field per turn:
+ * 1. Integration field: BFS from the target cell over the NavGrid,
+ *    storing the number of steps from each cell to the target
+ *    (8 neighbours, no corner cutting past obstacles)
+ * 2. Flow field: for every cell, a unit direction towards its best
+ *    neighbour (lowest step count, ties broken by straight-line distance
+ *    to the target)
+ *
+ * Each enemy then does a single O(1) lookup to know where to step.
+ * The cost of pathing is paid once per turn, no matter how many enemies
+ * chase the same hero.
+ *
+ * Buffers are kept between builds: rebuilding for a grid of the same
+ * size does not allocate.
+ */
+class FlowField {
+private:
+    static constexpr int UNREACHABLE = -1;
+
+    const NavGrid* grid;          // Grid the field was built on (not owned)
+    int targetCellX;              // Local cell of the target
+    int targetCellY;
+    unsigned int gridVersion;     // NavGrid version used for the last build
+    bool valid;                   // false until a successful build
+
+    std::vector<int> steps;       // Integration field: steps to target, or UNREACHABLE
+    std::vector<float> dirX;      // Flow field: unit direction per cell
+    std::vector<float> dirY;
+    std::vector<int> queue;       // BFS queue (one slot per cell)
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * Default constructor - empty, invalid field
+     */
+    FlowField();
+
+
+    // ========== BUILDING ==========
+
+    /**
+     * Size the buffers for a grid now (level load), so that no build
+     * on that grid allocates
+     */
+    void reserve(const NavGrid& navGrid);
+
+    /**
+     * Build the field towards a world position
+     * @param navGrid Occupancy grid (must outlive the field)
+     * @param targetX Target world x (usually the player)
+     * @param targetY Target world y
+     * @return true if the target is on the grid and the field is valid
+     *
+     * Skips the work if the target cell and the grid did not change
+     * since the last build.
+     */
+    bool build(const NavGrid& navGrid, double targetX, double targetY);
+
+    /**
+     * Mark the field as invalid (lookups fail until the next build)
+     */
+    void invalidate();
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Check if the field is usable
+     */
+    bool isValid() const;
+
+    /**
+     * Check if a world position lies in the field's target cell
+     * @return true if (x, y) is in the cell the field flows to
+     *
+     * Lets an enemy verify that the shared field leads to ITS target.
+     */
+    bool isTargetCell(double x, double y) const;
+
+    /**
+     * Get the step direction for a world position (O(1))
+     * @param x World x of the mover
+     * @param y World y of the mover
+     * @param outX Output unit direction x
+     * @param outY Output unit direction y
+     * @return false if there is no useful direction (off grid, unreachable,
+     *         or already in the target cell)
+     */
+    bool getDirection(double x, double y, double& outX, double& outY) const;
+
+    /**
+     * Get the number of steps from a world position to the target
+     * @return Steps, or -1 if unreachable / off grid
+     */
+    int getSteps(double x, double y) const;
+};
+
+#endif // FLOWFIELD_HPP
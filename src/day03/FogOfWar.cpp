@@ -0,0 +1,140 @@
+#include "FogOfWar.hpp"
+#include "Visibility.hpp"
+#include <algorithm>
+
+namespace {
+
+    int countBits(uint64_t word) {
+        return __builtin_popcountll(word);
+    }
+}
+
+
+// ========== CONSTRUCTOR ==========
+
+FogOfWar::FogOfWar()
+    : grid(nullptr),
+      width(0),
+      height(0),
+      rowWords(0),
+      boxMinX(1), boxMinY(1),
+      boxMaxX(0), boxMaxY(0),
+      lastField(nullptr),
+      lastGeneration(0),
+      lastValid(false),
+      exploredCells(0),
+      changedWords(0)
+{
+}
+
+
+// ========== BUILDING ==========
+
+void FogOfWar::reset(const NavGrid& navGrid) {
+    grid = &navGrid;
+    width = navGrid.getWidth();
+    height = navGrid.getHeight();
+    rowWords = (width + 63) / 64;
+    visible.assign(static_cast<size_t>(rowWords) * height, 0);
+    explored.assign(static_cast<size_t>(rowWords) * height, 0);
+    boxMinX = boxMinY = 1;
+    boxMaxX = boxMaxY = 0;
+    lastField = nullptr;
+    lastGeneration = 0;
+    lastValid = false;
+    exploredCells = 0;
+    changedWords = 0;
+}
+
+/**
+ * Word-at-a-time update
+ *
+ * 1. Skip if the field did not change (same build, or still invalid)
+ * 2. New view box: the field's radius around its origin, clipped
+ * 3. For every word of the old box and of the new one: rebuild it from
+ *    the field (0 outside the new box), and if it differs from the
+ *    stored word, write it and OR it into 'explored'
+ *
+ * The old box is what the previous update may have set: every word
+ * outside both boxes is already 0 in 'visible' and stays 0.
+ */
+void FogOfWar::update(const VisibilityField& field) {
+    changedWords = 0;
+    const bool valid = field.isValid();
+    if (valid == lastValid
+        && (!valid || (&field == lastField && field.getGeneration() == lastGeneration))) {
+        return;
+    }
+    lastField = &field;
+    lastGeneration = field.getGeneration();
+    lastValid = valid;
+
+    int minX = 1, minY = 1, maxX = 0, maxY = 0;
+    if (valid) {
+        const int radius = field.getRadius();
+        minX = std::max(0, field.getOriginCellX() - radius);
+        minY = std::max(0, field.getOriginCellY() - radius);
+        maxX = std::min(width - 1, field.getOriginCellX() + radius);
+        maxY = std::min(height - 1, field.getOriginCellY() + radius);
+    }
+
+    const bool oldBox = boxMinX <= boxMaxX;
+    const bool newBox = minX <= maxX;
+    if (oldBox || newBox) {
+        const int firstRow = !oldBox ? minY : !newBox ? boxMinY : std::min(minY, boxMinY);
+        const int lastRow = !oldBox ? maxY : !newBox ? boxMaxY : std::max(maxY, boxMaxY);
+        const int firstWord = (!oldBox ? minX : !newBox ? boxMinX : std::min(minX, boxMinX)) >> 6;
+        const int lastWord = (!oldBox ? maxX : !newBox ? boxMaxX : std::max(maxX, boxMaxX)) >> 6;
+
+        for (int cy = firstRow; cy <= lastRow; cy++) {
+            const bool inView = newBox && cy >= minY && cy <= maxY;
+            uint64_t* visibleRow = visible.data() + static_cast<size_t>(cy) * rowWords;
+            uint64_t* exploredRow = explored.data() + static_cast<size_t>(cy) * rowWords;
+            for (int word = firstWord; word <= lastWord; word++) {
+                const uint64_t bits = inView ? packWord(field, cy, word, minX, maxX) : 0;
+                if (bits == visibleRow[word]) {
+                    continue;
+                }
+                visibleRow[word] = bits;
+                const uint64_t discovered = bits & ~exploredRow[word];
+                if (discovered) {
+                    exploredRow[word] |= discovered;
+                    exploredCells += countBits(discovered);
+                }
+                changedWords++;
+            }
+        }
+    }
+
+    boxMinX = minX;
+    boxMinY = minY;
+    boxMaxX = maxX;
+    boxMaxY = maxY;
+}
+
+uint64_t FogOfWar::packWord(const VisibilityField& field, int cy, int word, int minX, int maxX) {
+    const int first = std::max(word << 6, minX);
+    const int last = std::min((word << 6) + 63, maxX);
+    uint64_t bits = 0;
+    for (int cx = first; cx <= last; cx++) {
+        bits |= static_cast<uint64_t>(field.isCellVisible(cx, cy)) << (cx & 63);
+    }
+    return bits;
+}
+
+
+// ========== QUERIES ==========
+
+bool FogOfWar::isVisible(double x, double y) const {
+    int cx, cy;
+    return grid && grid->worldToCell(x, y, cx, cy) && isCellVisible(cx, cy);
+}
+
+bool FogOfWar::isExplored(double x, double y) const {
+    int cx, cy;
+    return grid && grid->worldToCell(x, y, cx, cy) && isCellExplored(cx, cy);
+}
+
+size_t FogOfWar::getMemoryBytes() const {
+    return (visible.capacity() + explored.capacity()) * sizeof(uint64_t);
+}
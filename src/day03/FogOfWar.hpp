@@ -0,0 +1,107 @@
+#ifndef FOGOFWAR_HPP
+#define FOGOFWAR_HPP
+
+#include "NavGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class VisibilityField;
+
+/**
+ * FogOfWar - What the hero sees now, and what it has ever seen
+ *
+ * Two bit planes over the NavGrid cells, one bit per cell:
+ * - visible: in the current field of view
+ * - explored: seen at least once (never cleared during a level)
+ * Each row is a run of 64-bit words (rowWords of them, the last one
+ * padded), so a 4096 x 4096 map costs 2 x 2 MB.
+ *
+ * Incremental update from the VisibilityField:
+ * - the field only lights cells within its radius of the viewer, so
+ *   only the words of the old and the new view boxes can change
+ * - each of those words is rebuilt in a register (64 cells), compared
+ *   with the stored one and written back only if it differs; the
+ *   explored plane is OR-ed with the same word
+ * - nothing is done if the field was not rebuilt since the last update
+ *
+ * Queries are one shift and one mask. The renderer (GameManager::drawAll)
+ * hides what is outside the fog.
+ */
+class FogOfWar {
+private:
+    const NavGrid* grid;        // Grid of the last reset (not owned)
+    int width;                  // Cells
+    int height;
+    int rowWords;               // 64-bit words per row
+    std::vector<uint64_t> visible;
+    std::vector<uint64_t> explored;
+
+    // View box of the last update (cells, inclusive); empty if
+    // boxMinX > boxMaxX
+    int boxMinX, boxMinY;
+    int boxMaxX, boxMaxY;
+    const VisibilityField* lastField;
+    uint32_t lastGeneration;
+    bool lastValid;
+
+    size_t exploredCells;       // Bits set in 'explored'
+    size_t changedWords;        // Words written by the last update
+
+public:
+    FogOfWar();
+
+    // ========== BUILDING ==========
+
+    /**
+     * Size both planes for the grid, everything unexplored
+     * (allocates: call at level load)
+     */
+    void reset(const NavGrid& navGrid);
+
+    /**
+     * Take the current field of view (field invalid: nothing visible,
+     * explored cells stay explored)
+     * @pre reset() was called with the field's grid
+     */
+    void update(const VisibilityField& field);
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Is the cell of (x, y) visible / explored? (false off grid)
+     */
+    bool isVisible(double x, double y) const;
+    bool isExplored(double x, double y) const;
+
+    bool isCellVisible(int cx, int cy) const {
+        return testBit(visible, cx, cy);
+    }
+
+    bool isCellExplored(int cx, int cy) const {
+        return testBit(explored, cx, cy);
+    }
+
+    size_t getExploredCount() const { return exploredCells; }
+    size_t getChangedWords() const { return changedWords; }
+    size_t getWordCount() const { return visible.size(); }
+
+    /**
+     * Heap size of both planes
+     */
+    size_t getMemoryBytes() const;
+
+private:
+    bool testBit(const std::vector<uint64_t>& plane, int cx, int cy) const {
+        return (plane[static_cast<size_t>(cy) * rowWords + (cx >> 6)] >> (cx & 63)) & 1u;
+    }
+
+    /**
+     * The 64 cells of word 'word' in row 'cy' as seen by the field,
+     * limited to columns [minX, maxX]
+     */
+    static uint64_t packWord(const VisibilityField& field, int cy, int word, int minX, int maxX);
+};
+
+#endif // FOGOFWAR_HPP
@@ -5,17 +5,29 @@
 #include <algorithm>
 #include <cctype>
 #include <sstream>  // For string stream in UI
+#include <cstdio>   // For snprintf (allocation-free formatting)
+#include <stdexcept>
 
 // ========== CONSTRUCTOR & DESTRUCTOR ==========
 
-Game::Game(bool interactive) 
+Game::Game(bool interactive, bool headless, const std::string& scenario) 
     : state(GameState::SETUP),
       player(nullptr),
+      pathfinder(navGrid),
+      hierarchy(navGrid),
+      playerThreatSource(-1),
       currentTurn(0),
-      interactiveMode(interactive)
+      maxTurns(DEFAULT_MAX_TURNS),
+      arrowSpeed(DEFAULT_ARROW_SPEED),
+      scenarioPath(scenario),
+      interactiveMode(interactive && !headless),
+      headlessMode(headless)
 {
     std::cout << "[Game] Game instance created" << std::endl;
-    if (interactiveMode) {
+    if (headlessMode) {
+        std::cout << "[Game] Headless mode (allocation tracking: "
+                  << (AllocTracker::isEnabled() ? "ON" : "OFF") << ")" << std::endl;
+    } else if (interactiveMode) {
         std::cout << "[Game] Interactive mode ENABLED" << std::endl;
     } else {
         std::cout << "[Game] Automated mode" << std::endl;
@@ -30,14 +42,36 @@ Game::~Game() {
 // ========== MAIN GAME INTERFACE ==========
 
 void Game::run() {
-    displayIntro();
-    
-    setup();
+    // Headless: mute std::cout for the whole game (a stream in a bad
+    // state skips all formatting), restore it even if a check throws
+    struct OutputMute {
+        bool active;
+        explicit OutputMute(bool active) : active(active) {
+            if (active) std::cout.setstate(std::ios::badbit);
+        }
+        ~OutputMute() {
+            if (active) std::cout.clear();
+        }
+    };
     
-    state = GameState::PLAYING;
-    gameLoop();
+    {
+        OutputMute mute(headlessMode);
+        
+        displayIntro();
+        
+        AllocTracker::setPhase(AllocTracker::Phase::SETUP);
+        setup();
+        
+        state = GameState::PLAYING;
+        gameLoop();
+        
+        displayResult();
+    }
     
-    displayResult();
+    if (headlessMode) {
+        std::cout << "[Game] Headless run finished: " << currentTurn << " turns, state "
+                  << getStateName(state) << std::endl;
+    }
 }
 
 
@@ -46,33 +80,77 @@ void Game::run() {
 void Game::setup() {
     std::cout << "\n[SETUP] Initializing game world..." << std::endl;
     
-    // Create player at origin
-    player = manager.createObject<Player>(0.0, 0.0, "Hero", 80);
-    std::cout << "  ✓ Created player: " << player->getName() 
-              << " (HP: " << player->getHealth() << ")" << std::endl;
+    loadWeapons();
     
-    // Create enemies at various distances
-    Enemy* enemy1 = manager.createObject<Enemy>(5.0, 0.0, "Goblin", 25, player, 6);
-    std::cout << "  ✓ Created enemy: " << enemy1->getName() 
-              << " (HP: " << enemy1->getHealth() << ", Distance: " << player->distance(*enemy1) << ")" << std::endl;
+    // Event producers and listeners (before the first object spawns)
+    manager.setEventBus(&events);
+    combat.setEventBus(&events);
+    projectiles.setEventBus(&events);
+    stats.subscribe(events);
     
-    Enemy* enemy2 = manager.createObject<Enemy>(10.0, 0.0, "Orc", 35, player, 8);
-    std::cout << "  ✓ Created enemy: " << enemy2->getName() 
-              << " (HP: " << enemy2->getHealth() << ", Distance: " << player->distance(*enemy2) << ")" << std::endl;
+    // World content: player, enemies, decor (and maybe weapons, rules)
+    loadScenario();
     
-    Enemy* enemy3 = manager.createObject<Enemy>(8.0, 6.0, "Troll", 40, player, 10);
-    std::cout << "  ✓ Created enemy: " << enemy3->getName() 
-              << " (HP: " << enemy3->getHealth() << ", Distance: " << player->distance(*enemy3) << ")" << std::endl;
+    // Static collision: decor leaves the per-move scan for a BVH
+    staticGeometry.build(manager);
+    manager.setStaticGeometry(&staticGeometry);
+    collisionResolver.setStaticGeometry(&staticGeometry);
+    std::cout << "  ✓ Static geometry: " << staticGeometry.size() << " shapes, "
+              << staticGeometry.getNodeCount() << " BVH nodes" << std::endl;
     
-    // Set player's initial target
-    player->setTarget(enemy1);
-    std::cout << "  ✓ Player targeting: " << enemy1->getName() << std::endl;
+    // Navigation: obstacle grid + shared flow field for every enemy
+    navGrid.buildFrom(manager, NAV_GRID_MARGIN);
+    std::cout << "  ✓ Navigation grid: " << navGrid.getWidth() << "x" << navGrid.getHeight()
+              << " cells" << std::endl;
+    flowField.reserve(navGrid);
+    pathfinder.reserve();  // Node pools and path cache: A* fallbacks never allocate
     
-    // Create decorative objects
-    manager.createObject<Decor>(3.0, 3.0, "Ancient Tree");
-    manager.createObject<Decor>(-2.0, 4.0, "Boulder");
-    manager.createObject<Decor>(7.0, -3.0, "Ruins");
-    std::cout << "  ✓ Created 3 decorative objects" << std::endl;
+    // Fog of war: what the display shows, from the first turn on
+    fog.reset(navGrid);
+    manager.setFogOfWar(&fog);
+    updateVisibility();
+    std::cout << "  ✓ Fog of war: " << fog.getMemoryBytes() << " bytes for "
+              << navGrid.getCellCount() << " cells" << std::endl;
+    
+    // Tactical layers: static cover now, moving sources every turn
+    influenceMap.build(navGrid);
+    playerThreatSource = influenceMap.addSource(InfluenceLayer::THREAT, 1);
+    for (size_t i = 0; i < manager.size(); i++) {
+        if (Enemy* enemy = dynamic_cast<Enemy*>(manager.getObject(i))) {
+            enemy->setInfluenceMap(&influenceMap);
+            enemy->setInfluenceSource(influenceMap.addSource(InfluenceLayer::DENSITY, 1));
+        }
+    }
+    updateInfluence();
+    
+    // Enemy phase batch: room for every object, so turns never allocate
+    steering.reserve(manager.size());
+    steeredEnemies.reserve(manager.size());
+    crowd.reserve(manager.size());
+    collisionGrid.reserve(manager.size());
+    areaOfEffect.setIndex(&collisionGrid);
+    areaOfEffect.reserve(manager.size());
+    collisionResolver.reserve(manager.size());
+    projectiles.reserve(PROJECTILE_POOL);
+    const size_t combatCapacity = 2 * manager.size() + PROJECTILE_POOL;
+    combat.reserve(combatCapacity);  // Room for a swing or a blast over everyone
+    
+    // Big levels: JPS for grid searches, HPA* for long-distance queries
+    // (the HPA* build takes ~0.3 s at 2048x2048; clusters connect on demand)
+    if (navGrid.getCellCount() >= LARGE_MAP_CELLS) {
+        hierarchy.build();
+        pathfinder.setSearchMode(Pathfinder::SearchMode::JUMP_POINT);
+        pathfinder.setHierarchy(&hierarchy, HIERARCHY_MIN_DISTANCE);
+        std::cout << "  ✓ Path hierarchy: " << hierarchy.getNodeCount() << " nodes, "
+                  << hierarchy.getEdgeCount() << " edges in "
+                  << static_cast<int>(hierarchy.getBuildMicros() / 1000.0) << " ms" << std::endl;
+    }
+    
+    // Events: one drain per turn, after two combat passes (player and
+    // enemy phase). Sized to the world so no Died is ever dropped: the
+    // victory check counts them (reserve() drops the queue: drain first)
+    events.drain();
+    events.reserve(std::max(size_t(EventBus::DEFAULT_CAPACITY), 2 * combatCapacity));
     
     std::cout << "\n[SETUP] World initialized with " << manager.size() << " objects" << std::endl;
     
@@ -80,7 +158,192 @@ void Game::setup() {
         std::cout << "\n💡 TIP: Type 'h' during game for help!" << std::endl;
     }
     
-    waitForEnter();
+    if (!headlessMode) {
+        waitForEnter();
+    }
+}
+
+// ========== SCENARIO ==========
+
+/**
+ * Built-in scenario: the original campus fight (used when the scenario
+ * file is missing)
+ */
+static const char* const DEFAULT_SCENARIO =
+    "player Hero 0 0 80\n"
+    "enemy Goblin 5 0 25 6\n"
+    "enemy Orc 10 0 35 8\n"
+    "enemy Troll 8 6 40 10\n"
+    "decor \"Ancient Tree\" 3 3\n"
+    "decor Boulder -2 4\n"
+    "decor Ruins 7 -3\n";
+
+/**
+ * WorldBuilder - Creates the game's objects while the scenario streams in
+ * 
+ * Every statement becomes an object as soon as it is parsed: no list
+ * of entities in between. Shared services that do not depend on the
+ * whole world (combat buffer, flow field, A*) are plugged in here;
+ * the influence map needs the nav grid, so it comes after the load.
+ */
+class Game::WorldBuilder : public ScenarioSink {
+private:
+    Game& game;
+    Enemy* firstEnemy;       // Player's first target
+    size_t enemyCount;
+    size_t decorCount;
+    size_t spawnsSinceDrain; // Spawn events waiting in the bus
+    bool weaponsReplaced;
+    static const size_t DRAIN_EVERY = 256;  // Keep the spawn channel from filling up
+    static const size_t MAX_RESERVE_HINT = 1 << 20;  // Bigger worlds grow past it as they load
+
+public:
+    explicit WorldBuilder(Game& game)
+        : game(game), firstEnemy(nullptr), enemyCount(0), decorCount(0),
+          spawnsSinceDrain(0), weaponsReplaced(false) {}
+    
+    void onReserve(size_t entities) override {
+        // The hint comes from the file: a huge count must not turn into
+        // a huge allocation before a single object exists
+        game.manager.reserve(game.manager.size() + std::min(entities, size_t(MAX_RESERVE_HINT)));
+    }
+    
+    void onRule(ScenarioRule rule, double value) override {
+        switch (rule) {
+            case ScenarioRule::MAX_TURNS:
+                // Written this way round so NaN fails too: the cast
+                // below is undefined outside the int range
+                if (!(value >= 1.0 && value <= std::numeric_limits<int>::max())) {
+                    throw std::runtime_error("scenario: max_turns must be between 1 and "
+                                             + std::to_string(std::numeric_limits<int>::max()));
+                }
+                game.maxTurns = static_cast<int>(value);
+                break;
+            case ScenarioRule::ARROW_SPEED:
+                if (value <= 0.0) {
+                    throw std::runtime_error("scenario: arrow_speed must be positive");
+                }
+                game.arrowSpeed = value;
+                break;
+        }
+        std::cout << "  ✓ Rule: " << Scenario::getRuleName(rule) << " = " << value << std::endl;
+    }
+    
+    void onWeapon(const std::string& name, int range, int power, AttackStyle style) override {
+        if (!weaponsReplaced) {
+            game.weapons.clear();  // Scenario weapons replace weapons.cfg
+            weaponsReplaced = true;
+        }
+        game.weapons.add(name, range, power, style);
+    }
+    
+    void onPlayer(const std::string& name, double x, double y, int health) override {
+        if (game.player) {
+            throw std::runtime_error("scenario: more than one player");
+        }
+        game.player = game.manager.createObject<Player>(x, y, name, health, &game.weapons);
+        game.player->setCombatBuffer(&game.combat);
+        game.player->setNavGrid(&game.navGrid);
+        game.player->setAreaOfEffect(&game.areaOfEffect);
+        game.stats.setPlayer(game.player);
+        spawned();
+        std::cout << "  ✓ Created player: " << game.player->getName() 
+                  << " (HP: " << game.player->getHealth() << ")" << std::endl;
+    }
+    
+    void onEnemy(const std::string& name, double x, double y, int health, int damage) override {
+        if (!game.player) {
+            throw std::runtime_error("scenario: enemies must come after the player");
+        }
+        Enemy* enemy = game.manager.createObject<Enemy>(x, y, name, health, game.player, damage);
+        enemy->setCombatBuffer(&game.combat);
+        enemy->setFlowField(&game.flowField);
+        enemy->setVisibility(&game.visibility);
+        enemy->setPathfinder(&game.pathfinder);
+        if (!firstEnemy) {
+            firstEnemy = enemy;
+        }
+        if (++enemyCount <= SETUP_LOG_ENEMIES) {
+            std::cout << "  ✓ Created enemy: " << enemy->getName() 
+                      << " (HP: " << enemy->getHealth() << ", Distance: "
+                      << game.player->distance(*enemy) << ")" << std::endl;
+        }
+        spawned();
+    }
+    
+    void onDecor(const std::string& name, double x, double y) override {
+        game.manager.createObject<Decor>(x, y, name);
+        decorCount++;
+        spawned();
+    }
+    
+    /**
+     * After the last statement: checks and summary
+     */
+    void finish() {
+        if (!game.player) {
+            throw std::runtime_error("scenario: no player");
+        }
+        if (game.weapons.size() == 0) {
+            game.weapons.loadBuiltin();
+        }
+        game.player->equipWeapon(0);
+        
+        if (enemyCount > SETUP_LOG_ENEMIES) {
+            std::cout << "  ✓ ... and " << enemyCount - SETUP_LOG_ENEMIES << " more enemies" << std::endl;
+        }
+        if (firstEnemy) {
+            game.player->setTarget(firstEnemy);
+            std::cout << "  ✓ Player targeting: " << firstEnemy->getName() << std::endl;
+        }
+        std::cout << "  ✓ Created " << decorCount << " decorative objects" << std::endl;
+    }
+    
+private:
+    void spawned() {
+        if (++spawnsSinceDrain == DRAIN_EVERY) {
+            game.events.drain();
+            spawnsSinceDrain = 0;
+        }
+    }
+};
+
+void Game::loadScenario() {
+#ifdef CAMPUS_QUEST_DATA_DIR
+    const std::string defaultPath = std::string(CAMPUS_QUEST_DATA_DIR) + "/campus.scenario";
+#else
+    const std::string defaultPath = "data/campus.scenario";
+#endif
+    const std::string& path = scenarioPath.empty() ? defaultPath : scenarioPath;
+    
+    WorldBuilder builder(*this);
+    if (!Scenario::loadFile(path, builder)) {
+        if (!scenarioPath.empty()) {
+            throw std::runtime_error("scenario: cannot open " + scenarioPath);
+        }
+        std::cout << "  ⚠️  " << path << " not found, using built-in scenario" << std::endl;
+        std::istringstream builtin(DEFAULT_SCENARIO);
+        Scenario::readText(builtin, builder);
+    }
+    builder.finish();
+}
+
+void Game::loadWeapons() {
+#ifdef CAMPUS_QUEST_DATA_DIR
+    const std::string path = std::string(CAMPUS_QUEST_DATA_DIR) + "/weapons.cfg";
+#else
+    const std::string path = "data/weapons.cfg";
+#endif
+    try {
+        if (weapons.loadFromFile(path)) {
+            std::cout << "  ✓ Loaded " << weapons.size() << " weapon types" << std::endl;
+            return;
+        }
+        std::cout << "  ⚠️  " << path << " not found, using built-in weapons" << std::endl;
+    } catch (const std::runtime_error& e) {
+        std::cout << "  ⚠️  " << e.what() << ", using built-in weapons" << std::endl;
+    }
+    weapons.loadBuiltin();
 }
 
 void Game::gameLoop() {
@@ -90,7 +353,11 @@ void Game::gameLoop() {
     
     while (state == GameState::PLAYING) {
         currentTurn++;
+        AllocTracker::resetCounters();
         
+        // Headless too: output is muted, but the display code runs (and
+        // is allocation-checked like the rest of the turn)
+        AllocTracker::setPhase(AllocTracker::Phase::DISPLAY);
         displayTurnHeader();
         
         if (interactiveMode) {
@@ -101,7 +368,11 @@ void Game::gameLoop() {
         
         checkGameOver();
         
-        if (currentTurn >= MAX_TURNS && state == GameState::PLAYING) {
+        if (headlessMode && currentTurn > ALLOC_WARMUP_TURNS) {
+            checkTurnAllocations();
+        }
+        
+        if (currentTurn >= maxTurns && state == GameState::PLAYING) {
             std::cout << "\n⏰ Turn limit reached! Game ends in a draw." << std::endl;
             state = GameState::DRAW;
         }
@@ -134,6 +405,10 @@ void Game::processTurn() {
         }
     }
     
+    // Arrows in flight (including one fired this turn)
+    updateProjectiles();
+    resolveCombat();
+    
     // Check if player's target is dead and switch to next enemy
     if (player && player->getTarget() && !player->getTarget()->isAlive()) {
         std::cout << "\n  ℹ️  Current target defeated, looking for new target..." << std::endl;
@@ -154,11 +429,13 @@ void Game::processTurn() {
     std::cout << "│         ENEMY TURN                  │" << std::endl;
     std::cout << "└─────────────────────────────────────┘" << std::endl;
     
-    for (size_t i = 0; i < manager.size(); i++) {
-        if (Enemy* enemy = dynamic_cast<Enemy*>(manager.getObject(i))) {
-            enemy->update();
-        }
-    }
+    updateNavigation();
+    updateInfluence();
+    updateEnemies(false);
+    resolveCombat();
+    
+    // Listeners catch up on the turn (before dead objects go away)
+    events.drain();
     
     // Cleanup phase
     std::cout << "\n[CLEANUP PHASE]" << std::endl;
@@ -169,13 +446,8 @@ void Game::processTurn() {
         std::cout << "  🗑️  Removed " << removedDead << " dead object(s)" << std::endl;
     }
     
-    // Remove expired projectiles (JOB 10)
-    size_t removedProjectiles = manager.removeExpiredProjectiles();
-    if (removedProjectiles > 0) {
-        std::cout << "  🏹 Removed " << removedProjectiles << " expired projectile(s)" << std::endl;
-    }
-    
-    if (removedDead == 0 && removedProjectiles == 0) {
+    // (Expired projectiles are recycled by the ProjectileSystem itself)
+    if (removedDead == 0) {
         std::cout << "  ✓ No objects to remove" << std::endl;
     }
     
@@ -185,15 +457,22 @@ void Game::processTurn() {
 }
 
 void Game::processAutomatedTurn() {
+    AllocTracker::setPhase(AllocTracker::Phase::DISPLAY);
     displayState();
     
     std::cout << "\n┌─────────────────────────────────────┐" << std::endl;
     std::cout << "│         ACTIONS THIS TURN           │" << std::endl;
     std::cout << "└─────────────────────────────────────┘" << std::endl;
     
+    AllocTracker::setPhase(AllocTracker::Phase::PLAYER);
     std::cout << "\n[PLAYER PHASE]" << std::endl;
     if (player && player->isAlive()) {
+        if (player->getCurrentWeapon()->getArea() != AreaShape::SINGLE) {
+            indexCharacters();  // Area hits query the characters' current positions
+        }
         player->update();
+        updateProjectiles();
+        resolveCombat();
         
         if (player->getTarget() && !player->getTarget()->isAlive()) {
             std::cout << "  ℹ️  Current target defeated, looking for new target..." << std::endl;
@@ -210,37 +489,17 @@ void Game::processAutomatedTurn() {
         }
     }
     
+    AllocTracker::setPhase(AllocTracker::Phase::ENEMY);
     std::cout << "\n[ENEMY PHASE]" << std::endl;
-    for (size_t i = 0; i < manager.size(); i++) {
-        if (Enemy* enemy = dynamic_cast<Enemy*>(manager.getObject(i))) {
-            // Store old position in case we need to revert due to collision
-            double oldX = enemy->getX();
-            double oldY = enemy->getY();
-            
-            // Enemy AI determines new position
-            enemy->update();
-            
-            // Check if new position causes collision (JOB 09)
-            double newX = enemy->getX();
-            double newY = enemy->getY();
-            
-            // If position changed, check for collision
-            if (oldX != newX || oldY != newY) {
-                // Temporarily move back to check collision from old position
-                enemy->setX(oldX);
-                enemy->setY(oldY);
-                
-                if (!manager.canMoveTo(enemy, newX, newY)) {
-                    // Collision detected! Stay at old position
-                    std::cout << "    ⚠️  " << enemy->getName() << " blocked by collision" << std::endl;
-                } else {
-                    // No collision, move to new position
-                    enemy->setX(newX);
-                    enemy->setY(newY);
-                }
-            }
-        }
-    }
+    updateNavigation();
+    updateInfluence();
+    updateEnemies(true);
+    resolveCombat();
+    
+    AllocTracker::setPhase(AllocTracker::Phase::CLEANUP);
+    
+    // Listeners catch up on the turn (before dead objects go away)
+    events.drain();
     
     std::cout << "\n[CLEANUP PHASE]" << std::endl;
     
@@ -250,19 +509,285 @@ void Game::processAutomatedTurn() {
         std::cout << "  🗑️  Removed " << removedDead << " dead object(s)" << std::endl;
     }
     
-    // Remove expired projectiles (JOB 10)
-    size_t removedProjectiles = manager.removeExpiredProjectiles();
-    if (removedProjectiles > 0) {
-        std::cout << "  🏹 Removed " << removedProjectiles << " expired projectile(s)" << std::endl;
-    }
-    
-    if (removedDead == 0 && removedProjectiles == 0) {
+    // (Expired projectiles are recycled by the ProjectileSystem itself)
+    if (removedDead == 0) {
         std::cout << "  ✓ No objects to remove" << std::endl;
     }
     
     std::cout << std::endl;
 }
 
+/**
+ * Shared pathfinding for the enemy phase
+ * 
+ * One BFS over the grid per turn (skipped if the player stayed in the
+ * same cell), then each enemy reads its direction in O(1).
+ */
+void Game::updateNavigation() {
+    if (player && player->isAlive()) {
+        flowField.build(navGrid, player->getX(), player->getY());
+    } else {
+        flowField.invalidate();
+    }
+    updateVisibility();
+}
+
+/**
+ * Player's field of view (shadowcast from its cell), shared by every
+ * enemy's tactics, and the fog of war that follows it (no work if the
+ * field was not rebuilt). Ranged attacks do not use it: they check
+ * LineOfSight::isClear between the exact positions.
+ */
+void Game::updateVisibility() {
+    if (player && player->isAlive()) {
+        visibility.build(navGrid, player->getX(), player->getY());
+    } else {
+        visibility.invalidate();
+    }
+    fog.update(visibility);
+}
+
+/**
+ * Broad phase: index every living character in the spatial grid with
+ * its shape and layer (counting sort into reserved buffers, no
+ * allocation). Used by projectiles and area hits.
+ */
+void Game::indexCharacters() {
+    collisionGrid.clear();
+    for (size_t i = 0; i < manager.size(); i++) {
+        if (Character* character = dynamic_cast<Character*>(manager.getObject(i))) {
+            if (character->isAlive()) {
+                const CollisionShape& shape = character->getCollisionShape();
+                collisionGrid.insert(character, character->getX(), character->getY(),
+                                     shape.boundingRadius(), shape.layer, shape.mask);
+            }
+        }
+    }
+    collisionGrid.build();
+}
+
+/**
+ * Projectile flight
+ * 
+ * 1. Index every living character (indexCharacters)
+ * 2. The ProjectileSystem flies every arrow in one loop, each one
+ *    testing only the characters near its segment
+ * 3. Queue the hits in the combat buffer (resolved with the rest of
+ *    the phase), plus everyone caught by a blast where an explosive
+ *    arrow stopped; log the drops and the arrows still flying
+ */
+void Game::updateProjectiles() {
+    if (projectiles.getLiveCount() == 0) {
+        return;
+    }
+    
+    indexCharacters();
+    
+    std::cout << "\n[PROJECTILES]" << std::endl;
+    const std::vector<ProjectileSystem::Impact>& impacts = projectiles.update(collisionGrid);
+    for (const ProjectileSystem::Impact& impact : impacts) {
+        const char* name = ProjectileSystem::getKindName(impact.kind);
+        if (Character* victim = dynamic_cast<Character*>(impact.victim)) {
+            combat.queue(impact.owner, *victim, impact.damage, CombatBuffer::Source::PROJECTILE,
+                         static_cast<int>(impact.kind));
+        } else {
+            std::cout << "    💨 " << name << " drops at (" << impact.x << ", " << impact.y
+                      << ") without hitting anything" << std::endl;
+        }
+        if (impact.blast > 0.0) {
+            AreaOfEffect::Area blast{ AreaShape::BLAST, impact.x, impact.y, 0.0, 0.0, 0.0, impact.blast };
+            const std::vector<Character*>& caught = areaOfEffect.collect(blast, impact.owner, impact.victim);
+            if (!caught.empty()) {
+                std::cout << "    💥 " << name << " blast catches " << caught.size() << " more!" << std::endl;
+            }
+            for (Character* character : caught) {
+                combat.queue(impact.owner, *character, impact.damage, CombatBuffer::Source::PROJECTILE,
+                             static_cast<int>(impact.kind));
+            }
+        }
+    }
+    
+    for (uint32_t slot = 0; slot < projectiles.getSlotCount(); slot++) {
+        if (projectiles.isLive(slot)) {
+            std::cout << "    💨 " << ProjectileSystem::getKindName(projectiles.getKind(slot))
+                      << " flies to (" << projectiles.getX(slot) << ", " << projectiles.getY(slot)
+                      << ")" << std::endl;
+        }
+    }
+}
+
+/**
+ * Combat resolution
+ * 
+ * The buffer applies the hits target by target; the log then follows
+ * the order the hits were queued (who acted first), so it reads the
+ * same whatever the sort did.
+ */
+void Game::resolveCombat() {
+    if (combat.getPendingCount() == 0) {
+        return;
+    }
+    
+    for (const CombatBuffer::Event& event : combat.resolve()) {
+        const Character* target = event.target;
+        const bool dead = event.outcome == CombatBuffer::Outcome::ALREADY_DEAD;
+        
+        switch (event.source) {
+            case CombatBuffer::Source::WEAPON:
+                if (dead) {
+                    std::cout << "    " << target->getName() << " is already dead!" << std::endl;
+                    continue;
+                }
+                std::cout << "    Deals " << event.damage << " damage to " << target->getName();
+                break;
+            case CombatBuffer::Source::MELEE:
+                if (dead) {
+                    std::cout << "    💥 " << event.attacker->getName() << " strikes the body of "
+                              << target->getName() << std::endl;
+                    continue;
+                }
+                std::cout << "    💥 " << event.attacker->getName() << " attacks " << target->getName()
+                          << " for " << event.damage << " damage!";
+                break;
+            case CombatBuffer::Source::PROJECTILE: {
+                const char* name = ProjectileSystem::getKindName(
+                    static_cast<ProjectileSystem::Kind>(event.weapon));
+                if (dead) {
+                    // Killed earlier in the same phase
+                    std::cout << "    💨 " << name << " hits the body of " << target->getName() << std::endl;
+                    continue;
+                }
+                std::cout << "    🎯 " << name << " HITS " << target->getName() << "! ";
+                std::cout << "Deals " << event.damage << " damage";
+                break;
+            }
+        }
+        
+        std::cout << " (HP: " << event.healthBefore << " → " << event.healthAfter << ")";
+        if (event.outcome == CombatBuffer::Outcome::KILLED) {
+            std::cout << (target == player ? " [PLAYER DEFEATED!]" : " [DEFEATED!]");
+        }
+        std::cout << std::endl;
+    }
+}
+
+/**
+ * Batched enemy phase
+ * 
+ * 1. Gather every living enemy chasing the player into the SoA batch
+ * 2. One SIMD pass computes distances, range masks and directions, and
+ *    one (chunk-parallel) pass the separation push of every enemy
+ * 3. Each enemy acts on its precomputed values (in manager order, so
+ *    collisions resolve exactly as before)
+ * 4. A blocked move slides along what is in the way (CollisionResolver,
+ *    one broad phase query per try) instead of being dropped
+ * Enemies with another target (or none) use the per-enemy update().
+ */
+void Game::updateEnemies(bool resolveCollisions) {
+    steering.clear();
+    steeredEnemies.clear();
+    crowd.clear();
+    for (size_t i = 0; i < manager.size(); i++) {
+        if (Enemy* enemy = dynamic_cast<Enemy*>(manager.getObject(i))) {
+            if (player && enemy->isAlive() && enemy->getTarget() == player) {
+                steering.add(enemy->getX(), enemy->getY(), enemy->getAttackRange());
+                steeredEnemies.push_back(enemy);
+                crowd.add(enemy, enemy->getX(), enemy->getY());
+            }
+        }
+    }
+    if (player) {
+        steering.compute(player->getX(), player->getY());
+        crowd.compute(VectorBulk::Execution::PARALLEL);
+    }
+    if (resolveCollisions) {
+        collisionResolver.begin(manager);
+    }
+    
+    size_t next = 0;  // Next batched enemy (same order as the manager)
+    for (size_t i = 0; i < manager.size(); i++) {
+        Enemy* enemy = dynamic_cast<Enemy*>(manager.getObject(i));
+        if (!enemy) {
+            continue;
+        }
+        
+        // Store old position in case we need to revert due to collision
+        double oldX = enemy->getX();
+        double oldY = enemy->getY();
+        
+        // Enemy AI determines new position
+        if (next < steeredEnemies.size() && steeredEnemies[next] == enemy) {
+            enemy->updateSteered(steering.getDistance(next), steering.getDirX(next),
+                                 steering.getDirY(next), steering.isInRange(next),
+                                 crowd.getPushX(next), crowd.getPushY(next));
+            next++;
+        } else {
+            enemy->update();
+        }
+        
+        if (!resolveCollisions) {
+            continue;
+        }
+        
+        // Check if new position causes collision (JOB 09)
+        double newX = enemy->getX();
+        double newY = enemy->getY();
+        
+        // If position changed, check for collision
+        if (oldX != newX || oldY != newY) {
+            // Temporarily move back to check collision from old position
+            enemy->setX(oldX);
+            enemy->setY(oldY);
+            
+            CollisionResolver::Result move = collisionResolver.resolve(enemy, oldX, oldY, newX, newY);
+            if (move.x == oldX && move.y == oldY) {
+                // Nothing left of the move: stay at old position
+                std::cout << "    ⚠️  " << enemy->getName() << " blocked by collision" << std::endl;
+                continue;
+            }
+            if (move.blocker) {
+                std::cout << "    ↪ " << enemy->getName() << " slides around " << move.blocker->getName()
+                          << " to (" << move.x << ", " << move.y << ")" << std::endl;
+            }
+            enemy->setX(move.x);
+            enemy->setY(move.y);
+            collisionResolver.commit(oldX, oldY, move.x, move.y);
+        }
+    }
+}
+
+/**
+ * Influence map upkeep
+ * 
+ * - Player: threat radius = range of the weapon in hand
+ * - Enemies: density stamp while alive, removed as soon as they die
+ *   (before the cleanup phase destroys them)
+ */
+void Game::updateInfluence() {
+    if (player && player->isAlive() && player->getCurrentWeapon()) {
+        influenceMap.moveSource(playerThreatSource, player->getX(), player->getY(),
+                                player->getCurrentWeapon()->getRange());
+    } else if (playerThreatSource >= 0) {
+        influenceMap.removeSource(playerThreatSource);
+        playerThreatSource = -1;
+    }
+    
+    for (size_t i = 0; i < manager.size(); i++) {
+        if (Enemy* enemy = dynamic_cast<Enemy*>(manager.getObject(i))) {
+            int source = enemy->getInfluenceSource();
+            if (source < 0) {
+                continue;
+            }
+            if (enemy->isAlive()) {
+                influenceMap.moveSource(source, enemy->getX(), enemy->getY(), Enemy::INFLUENCE_RADIUS);
+            } else {
+                influenceMap.removeSource(source);
+                enemy->setInfluenceSource(-1);
+            }
+        }
+    }
+}
+
 void Game::checkGameOver() {
     if (!player || !player->isAlive()) {
         state = GameState::DEFEAT;
@@ -278,6 +803,33 @@ void Game::checkGameOver() {
     state = GameState::PLAYING;
 }
 
+/**
+ * Steady-state allocation check (headless mode)
+ * 
+ * After the warm-up turns, an automated turn must run entirely on
+ * memory that already exists: no new objects, no string copies, no
+ * temporary containers. The per-phase counters tell where a
+ * regression comes from.
+ */
+void Game::checkTurnAllocations() {
+    if (!AllocTracker::isEnabled() || AllocTracker::getTotalAllocations() == 0) {
+        return;
+    }
+    
+    // Building the message allocates, but the game is failing anyway
+    std::ostringstream message;
+    message << "Turn " << currentTurn << " allocated in steady state:";
+    for (int i = 0; i < static_cast<int>(AllocTracker::Phase::COUNT); i++) {
+        AllocTracker::Phase phase = static_cast<AllocTracker::Phase>(i);
+        if (AllocTracker::getAllocations(phase) > 0) {
+            message << " " << AllocTracker::getPhaseName(phase) << "="
+                    << AllocTracker::getAllocations(phase) << " ("
+                    << AllocTracker::getBytes(phase) << " bytes)";
+        }
+    }
+    throw std::runtime_error(message.str());
+}
+
 
 // ========== INTERACTIVE INPUT SYSTEM ==========
 
@@ -286,12 +838,18 @@ void Game::displayPlayerMenu() {
     std::cout << "║       CHOOSE YOUR ACTION          ║" << std::endl;
     std::cout << "╠═══════════════════════════════════╣" << std::endl;
     std::cout << "║ [1] Move (WASD)                   ║" << std::endl;
-    std::cout << "║ [2] Attack " << std::left << std::setw(23);
+    std::cout << "║ [2] Attack ";
+    // Pad "(name)" to 23 columns by hand (no temporary string)
+    size_t labelLength;
     if (player->getTarget()) {
-        std::cout << ("(" + player->getTarget()->getName() + ")");
+        const std::string& targetName = player->getTarget()->getName();
+        std::cout << "(" << targetName << ")";
+        labelLength = targetName.length() + 2;
     } else {
         std::cout << "(No target)";
+        labelLength = 11;
     }
+    for (size_t i = labelLength; i < 23; i++) std::cout << " ";
     std::cout << " ║" << std::endl;
     std::cout << "║ [3] Change Weapon ";
     std::cout << "(" << player->getCurrentWeapon()->getName() << ")";
@@ -327,14 +885,11 @@ std::string Game::getValidatedStringInput(const std::vector<std::string>& validO
         std::cin >> input;
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         
-        // Convert to lowercase for comparison
-        std::transform(input.begin(), input.end(), input.begin(), ::tolower);
-        
-        // Check if input is valid
+        // Check if input is valid (case-insensitive, no copies)
         for (const auto& option : validOptions) {
-            std::string lowerOption = option;
-            std::transform(lowerOption.begin(), lowerOption.end(), lowerOption.begin(), ::tolower);
-            if (input == lowerOption) {
+            if (equalsIgnoreCase(input, option)) {
+                // Normalize the input buffer in place
+                std::transform(input.begin(), input.end(), input.begin(), ::tolower);
                 return input;
             }
         }
@@ -348,6 +903,19 @@ std::string Game::getValidatedStringInput(const std::vector<std::string>& validO
     }
 }
 
+bool Game::equalsIgnoreCase(const std::string& a, const std::string& b) {
+    if (a.length() != b.length()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.length(); i++) {
+        if (std::tolower(static_cast<unsigned char>(a[i])) !=
+            std::tolower(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Game::handlePlayerAction(int choice) {
     switch (choice) {
         case 1:
@@ -443,34 +1011,50 @@ void Game::handlePlayerAttack() {
     
     std::cout << "\n⚔️  ATTACK" << std::endl;
     
-    // JOB 10: Special handling for Bow (creates projectile)
-    if (player->getCurrentWeapon()->getName() == "Bow") {
+    // JOB 10: Special handling for shooting weapons (creates projectile)
+    if (player->getCurrentWeapon()->getStyle() == AttackStyle::SHOT
+        && !LineOfSight::isClear(navGrid, player->getX(), player->getY(),
+                                 player->getTarget()->getX(), player->getTarget()->getY())) {
+        // Same rule as the automated shot (Player::update): exact ray
+        std::cout << "🚫 No line of sight to " << player->getTarget()->getName()
+                  << ": decor in the way!" << std::endl;
+        return;
+    }
+    
+    if (player->getCurrentWeapon()->getStyle() == AttackStyle::SHOT) {
         std::cout << "🏹 Firing arrow at " << player->getTarget()->getName() << "!" << std::endl;
         
-        // Create arrow projectile at player's position
-        Projectile* arrow = manager.createObject<Projectile>(
+        // Fire an arrow from the player's position; it flies
+        // arrowSpeed units per turn, up to the bow's range (a blast
+        // weapon fires explosive arrows)
+        const bool explosive = player->getCurrentWeapon()->getArea() == AreaShape::BLAST;
+        projectiles.spawn(
+            explosive ? ProjectileSystem::Kind::EXPLOSIVE_ARROW : ProjectileSystem::Kind::ARROW,
             player->getX(),
             player->getY(),
-            "Arrow",
-            player->getCurrentWeapon()->getPower(),  // Bow power = 1
+            player->getTarget()->getX(),
+            player->getTarget()->getY(),
+            arrowSpeed,
+            static_cast<double>(player->getCurrentWeapon()->getRange()),
+            player->getCurrentWeapon()->getPower(),
             player,
-            player->getTarget()
+            explosive ? player->getCurrentWeapon()->getAreaSize() : 0.0
         );
         
         std::cout << "    💨 Arrow flies through the air..." << std::endl;
         
-        // Immediately process the arrow (instant hit model)
-        arrow->update();
-        
-        // Note: Arrow will be cleaned up automatically by smart pointer
-        // We could remove it immediately or let cleanup phase handle it
+        // Flight and hit happen in the projectile phase (updateProjectiles),
+        // right after the player's action
         
     } else {
-        // Melee weapons (Spear, Sword) use direct attack
+        // Melee weapons (thrust, slash) use direct attack
         std::cout << "Attacking " << player->getTarget()->getName() 
                   << " with " << player->getCurrentWeapon()->getName() << "!" << std::endl;
         std::cout << "    ";
-        player->getCurrentWeapon()->attack(*player->getTarget());
+        if (player->getCurrentWeapon()->getArea() != AreaShape::SINGLE) {
+            indexCharacters();  // The player may have moved this turn
+        }
+        player->getCurrentWeapon()->attack(*player, *player->getTarget(), &areaOfEffect);
     }
 }
 
@@ -478,27 +1062,18 @@ void Game::handleWeaponChange() {
     std::cout << "\n🗡️  CHANGE WEAPON" << std::endl;
     std::cout << "Current weapon: " << player->getCurrentWeapon()->getName() << std::endl;
     std::cout << "\nAvailable weapons:" << std::endl;
-    std::cout << "  [1] Bow    (Range: 4, Power: 1)" << std::endl;
-    std::cout << "  [2] Spear  (Range: 2, Power: 2)" << std::endl;
-    std::cout << "  [3] Sword  (Range: 1, Power: 4)" << std::endl;
+    for (int id = 0; id < weapons.size(); id++) {
+        const Weapon& weapon = weapons.get(id);
+        std::cout << "  [" << id + 1 << "] " << std::left << std::setw(6) << weapon.getName()
+                  << std::right << " (Range: " << weapon.getRange()
+                  << ", Power: " << weapon.getPower() << ")" << std::endl;
+    }
     std::cout << "Choice: ";
     
-    int weaponChoice = getValidatedInput(1, 3);
+    int weaponChoice = getValidatedInput(1, weapons.size());
     
-    switch (weaponChoice) {
-        case 1:
-            player->equipWeapon("Bow");
-            std::cout << "→ Equipped Bow" << std::endl;
-            break;
-        case 2:
-            player->equipWeapon("Spear");
-            std::cout << "→ Equipped Spear" << std::endl;
-            break;
-        case 3:
-            player->equipWeapon("Sword");
-            std::cout << "→ Equipped Sword" << std::endl;
-            break;
-    }
+    player->equipWeapon(weaponChoice - 1);
+    std::cout << "→ Equipped " << player->getCurrentWeapon()->getName() << std::endl;
 }
 
 void Game::displayPlayerStatus() {
@@ -528,11 +1103,22 @@ void Game::displayHelp() {
     std::cout << "\nACTIONS:" << std::endl;
     std::cout << "  Move: Change position (WASD + distance)" << std::endl;
     std::cout << "  Attack: Deal damage with current weapon" << std::endl;
-    std::cout << "  Weapon: Switch between Bow/Spear/Sword" << std::endl;
+    std::cout << "  Weapon: Switch to another weapon" << std::endl;
     std::cout << "\nWEAPONS:" << std::endl;
-    std::cout << "  Bow:   Long range (4), low power (1)" << std::endl;
-    std::cout << "  Spear: Medium range (2), medium power (2)" << std::endl;
-    std::cout << "  Sword: Melee (1), high power (4)" << std::endl;
+    for (int id = 0; id < weapons.size(); id++) {
+        const Weapon& weapon = weapons.get(id);
+        // Name and colon padded to 6 columns, without a concatenated temporary
+        std::cout << "  " << weapon.getName() << ":";
+        for (size_t column = weapon.getName().size() + 1; column < 6; column++) {
+            std::cout << ' ';
+        }
+        std::cout << " range " << weapon.getRange() << ", power " << weapon.getPower()
+                  << " (" << WeaponTable::getStyleName(weapon.getStyle());
+        if (weapon.getArea() != AreaShape::SINGLE) {
+            std::cout << ", " << WeaponTable::getAreaName(weapon.getArea()) << " " << weapon.getAreaSize();
+        }
+        std::cout << ")" << std::endl;
+    }
     std::cout << "\nSTRATEGY:" << std::endl;
     std::cout << "  - Keep distance and use Bow (safe but slow)" << std::endl;
     std::cout << "  - Close combat with Sword (risky but powerful)" << std::endl;
@@ -562,28 +1148,30 @@ void Game::displayIntro() {
     std::cout << "Objective: Defeat all enemies before you fall!" << std::endl;
     std::cout << "Victory: All enemies defeated" << std::endl;
     std::cout << "Defeat: Player health reaches 0" << std::endl;
-    std::cout << "Turn Limit: " << MAX_TURNS << " turns" << std::endl;
+    std::cout << "Turn Limit: " << maxTurns << " turns" << std::endl;
     std::cout << "\n";
 }
 
 void Game::displayTurnHeader() {
-    // Use enhanced UI (JOB 11)
-    std::stringstream title;
-    title << UI::COLOR_BRIGHT_CYAN << "TURN " << currentTurn << " / " << MAX_TURNS << UI::COLOR_RESET;
-    UI::drawTitleBox(title.str(), 52);
+    // Use enhanced UI (JOB 11) - formatted in a stack buffer (no allocation)
+    char title[64];
+    std::snprintf(title, sizeof(title), "%sTURN %d / %d%s",
+                  UI::COLOR_BRIGHT_CYAN.c_str(), currentTurn, maxTurns, UI::COLOR_RESET.c_str());
+    UI::drawTitleBox(title, 52);
 }
 
 void Game::displayState() {
     // JOB 11: Enhanced UI with Status Dashboard
     
-    // Gather info for dashboard
-    std::string targetName = "";
+    // Gather info for dashboard (the name by reference: no copy)
+    static const std::string NO_TARGET;
+    const std::string* targetName = &NO_TARGET;
     int targetHealth = 0;
     int targetMaxHealth = 0;
     double targetDistance = 0.0;
     
     if (player && player->getTarget() && player->getTarget()->isAlive()) {
-        targetName = player->getTarget()->getName();
+        targetName = &player->getTarget()->getName();
         targetHealth = player->getTarget()->getHealth();
         targetMaxHealth = 100;  // Approximate
         targetDistance = player->distance(*player->getTarget());
@@ -600,13 +1188,13 @@ void Game::displayState() {
             player->getCurrentWeapon()->getName(),
             player->getCurrentWeapon()->getRange(),
             player->getCurrentWeapon()->getPower(),
-            targetName,
+            *targetName,
             targetHealth,
             targetMaxHealth,
             targetDistance,
             countLivingEnemies(),
             currentTurn,
-            MAX_TURNS
+            maxTurns
         );
     }
     
@@ -614,6 +1202,7 @@ void Game::displayState() {
     std::cout << "\n";
     UI::drawSectionHeader("ALL OBJECTS", 52);
     manager.drawAll();
+    projectiles.drawAll();
 }
 
 void Game::displayResult() {
@@ -657,7 +1246,7 @@ void Game::displayStats() {
     std::cout << "│          GAME STATISTICS            │" << std::endl;
     std::cout << "└─────────────────────────────────────┘" << std::endl;
     
-    std::cout << "Total turns: " << currentTurn << " / " << MAX_TURNS << std::endl;
+    std::cout << "Total turns: " << currentTurn << " / " << maxTurns << std::endl;
     
     if (player) {
         std::cout << "Player final health: " << player->getHealth() << std::endl;
@@ -666,9 +1255,23 @@ void Game::displayStats() {
     
     int livingEnemies = countLivingEnemies();
     std::cout << "Enemies remaining: " << livingEnemies << std::endl;
+    std::cout << "Enemies defeated: " << stats.getEnemiesKilled() << " / "
+              << stats.getEnemiesSpawned() << std::endl;
+    std::cout << "Damage dealt: " << stats.getDamageDealt()
+              << ", taken: " << stats.getDamageTaken()
+              << " (" << stats.getHitsLanded() << " hits)" << std::endl;
+    std::cout << "Arrows: " << stats.getProjectilesHit() << " hit, "
+              << stats.getProjectilesDropped() << " dropped" << std::endl;
+    if (events.getDroppedCount() > 0) {
+        std::cout << "⚠️  Events lost (full channel): " << events.getDroppedCount() << std::endl;
+    }
     
     std::cout << "\nFinal game state:" << std::endl;
     manager.printStats();
+    pathfinder.printStats();
+    std::cout << "Position precision: " << POSITION_TYPE_NAME << std::endl;
+    std::cout << "Enemy steering kernel: "
+              << SteeringBatch::getBackendName(SteeringBatch::getBestBackend()) << std::endl;
     
     std::cout << "\n";
 }
@@ -677,17 +1280,7 @@ void Game::displayStats() {
 // ========== HELPER METHODS ==========
 
 int Game::countLivingEnemies() const {
-    int count = 0;
-    
-    for (size_t i = 0; i < manager.size(); i++) {
-        if (const Enemy* enemy = dynamic_cast<const Enemy*>(manager.getObject(i))) {
-            if (enemy->isAlive()) {
-                count++;
-            }
-        }
-    }
-    
-    return count;
+    return stats.getLivingEnemies();
 }
 
 std::string Game::getStateName(GameState state) const {
@@ -3,10 +3,28 @@
 
 #include "GameManager.hpp"
 #include "Player.hpp"
+#include "WeaponTable.hpp"
+#include "EventBus.hpp"
+#include "GameStats.hpp"
+#include "Scenario.hpp"
 #include "Enemy.hpp"
 #include "Decor.hpp"
-#include "Projectile.hpp"
+#include "ProjectileSystem.hpp"
 #include "UIHelper.hpp"  // JOB 11 - Enhanced UI
+#include "AllocTracker.hpp"
+#include "NavGrid.hpp"
+#include "FlowField.hpp"
+#include "Pathfinder.hpp"
+#include "HierarchicalPathfinder.hpp"
+#include "InfluenceMap.hpp"
+#include "SteeringBatch.hpp"
+#include "SpatialGrid.hpp"
+#include "StaticBvh.hpp"
+#include "CollisionResolver.hpp"
+#include "CrowdAvoidance.hpp"
+#include "Visibility.hpp"
+#include "FogOfWar.hpp"
+#include "AreaOfEffect.hpp"
 #include <string>
 #include <vector>
 
@@ -45,19 +63,56 @@ enum class GameState {
 
 class Game {
 private:
+    class WorldBuilder;      // ScenarioSink creating this game's objects (Game.cpp)
+    
     // ========== GAME COMPONENTS ==========
+    WeaponTable weapons;     // Weapon types (data/weapons.cfg), outlives the player
+    EventBus events;         // Spawn / damage / death / projectile notifications
+    GameStats stats;         // Incremental counters fed by the event bus
     GameManager manager;     // Manages all game objects
     GameState state;         // Current game state
     
     // ========== GAME OBJECTS ==========
     Player* player;          // Player character
     
+    // ========== NAVIGATION ==========
+    NavGrid navGrid;         // Decor obstacles, built once at setup
+    FlowField flowField;     // Shared path to the player, rebuilt once per turn
+    VisibilityField visibility;  // Player's field of view, rebuilt when the player changes cell
+    FogOfWar fog;            // Visible / explored cells (bit planes), follows the field of view
+    Pathfinder pathfinder;   // Cached A* for enemies with other targets
+    HierarchicalPathfinder hierarchy;  // HPA* abstraction, only on large maps
+    InfluenceMap influenceMap;  // Threat / density / cover layers for enemy tactics
+    int playerThreatSource;  // Player's threat source in the influence map
+    SteeringBatch steering;  // SoA distance/direction batch for the enemy phase
+    std::vector<Enemy*> steeredEnemies;  // Enemy of each batch slot
+    CrowdAvoidance crowd;    // Separation pushes, same slots as the steering batch
+    StaticBvh staticGeometry;  // Decor shapes, built once at setup (movement tests)
+    CollisionResolver collisionResolver;  // Sliding moves of the enemy phase
+    SpatialGrid collisionGrid;  // Living characters, rebuilt before projectiles fly / area hits
+    AreaOfEffect areaOfEffect;  // Line / arc / blast hits, queried on collisionGrid
+    ProjectileSystem projectiles;  // Arrows in flight (pooled records, not GameObjects)
+    CombatBuffer combat;     // Hits of the current phase, resolved in one batch
+    static const int PROJECTILE_POOL = 64;  // Arrows reserved at setup
+    static const int NAV_GRID_MARGIN = 16;  // Walkable cells around the level
+    static const size_t LARGE_MAP_CELLS = 256 * 256;  // JPS + HPA* from this size
+    static const int HIERARCHY_MIN_DISTANCE = 64;  // Cells, for HPA* queries
+    
     // ========== GAME PARAMETERS ==========
     int currentTurn;         // Current turn number
-    static const int MAX_TURNS = 50;  // Turn limit
+    int maxTurns;            // Turn limit (scenario rule max_turns)
+    double arrowSpeed;       // Units per turn (scenario rule arrow_speed)
+    std::string scenarioPath;  // Scenario file (text or compiled)
+    static const int DEFAULT_MAX_TURNS = 50;
+    static constexpr double DEFAULT_ARROW_SPEED = 2.0;  // Bow range 4 = 2 turns
+    static const size_t SETUP_LOG_ENEMIES = 10;  // Enemies listed one by one at setup
     
     // ========== INTERACTIVE MODE ==========
     bool interactiveMode;    // True = player controlled, False = automated
+    
+    // ========== HEADLESS MODE ==========
+    bool headlessMode;       // True = automated, no console output, no pauses
+    static const int ALLOC_WARMUP_TURNS = 1;  // Turns allowed to allocate before steady state
 
 public:
     // ========== CONSTRUCTOR & DESTRUCTOR ==========
@@ -65,8 +120,14 @@ public:
     /**
      * Constructor
      * @param interactive Enable interactive mode (default: true)
+     * @param headless Run automated with console output muted (default: false)
+     * @param scenario Scenario file to play (default: data/campus.scenario)
+     * 
+     * Headless mode ignores 'interactive'. When built with
+     * CAMPUS_QUEST_ALLOC_TRACKING, every steady-state headless turn is
+     * checked for heap allocations (see AllocTracker).
      */
-    Game(bool interactive = true);
+    Game(bool interactive = true, bool headless = false, const std::string& scenario = "");
     
     /**
      * Destructor
@@ -89,6 +150,20 @@ private:
      */
     void setup();
     
+    /**
+     * Create the world described by the scenario file (streamed: each
+     * statement creates its object right away, see WorldBuilder)
+     * Falls back to the built-in scenario if the file does not exist.
+     * @throws std::runtime_error on a malformed scenario
+     */
+    void loadScenario();
+    
+    /**
+     * Load the weapon table from data/weapons.cfg
+     * Falls back to the built-in Bow / Spear / Sword on any problem
+     */
+    void loadWeapons();
+    
     /**
      * Main game loop
      */
@@ -104,11 +179,62 @@ private:
      */
     void processAutomatedTurn();
     
+    /**
+     * Build the shared flow field towards the player (and the field of view)
+     * Called once per turn, before the enemy phase.
+     */
+    void updateNavigation();
+    
+    /**
+     * Rebuild the player's field of view (skipped if its cell did not change)
+     */
+    void updateVisibility();
+    
+    /**
+     * Restamp the moving influence sources (player threat, enemy density)
+     * Called once per turn, before the enemy phase. Sources that did not
+     * change cell cost nothing.
+     */
+    void updateInfluence();
+    
+    /**
+     * Fly every projectile one turn (swept hits against collisionGrid)
+     * and queue the hits in the combat buffer
+     * Does nothing (no output) when no projectile is in flight.
+     */
+    void updateProjectiles();
+    
+    /**
+     * Rebuild collisionGrid from the living characters (projectiles,
+     * area hits)
+     */
+    void indexCharacters();
+    
+    /**
+     * Apply every hit queued during the phase (sorted by target, one
+     * pass), then log the results in the order the hits were queued
+     */
+    void resolveCombat();
+    
+    /**
+     * Run every enemy's AI (batched steering towards the player)
+     * @param resolveCollisions Revert moves that collide (automated mode)
+     */
+    void updateEnemies(bool resolveCollisions);
+    
     /**
      * Check victory/defeat conditions
      */
     void checkGameOver();
     
+    /**
+     * Verify that a steady-state headless turn did not allocate
+     * @throws std::runtime_error if any heap allocation was recorded
+     * 
+     * Only active when AllocTracker is compiled in.
+     */
+    void checkTurnAllocations();
+    
     
     // ========== INTERACTIVE INPUT SYSTEM ==========
     
@@ -135,6 +261,12 @@ private:
      */
     std::string getValidatedStringInput(const std::vector<std::string>& validOptions);
     
+    /**
+     * Case-insensitive string comparison (no lowercase copies)
+     * @return true if both strings are equal ignoring case
+     */
+    static bool equalsIgnoreCase(const std::string& a, const std::string& b);
+    
     /**
      * Handle player's chosen action
      * @param choice Menu choice number
@@ -212,7 +344,7 @@ private:
     // ========== HELPER METHODS ==========
     
     /**
-     * Count living enemies
+     * Count living enemies (incremental, as of the last event drain)
      */
     int countLivingEnemies() const;
     
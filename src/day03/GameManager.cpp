@@ -1,13 +1,13 @@
 #include "GameManager.hpp"
 #include "Character.hpp"
-#include "Projectile.hpp"  // For projectile cleanup (Job 10)
+#include "StaticBvh.hpp"
+#include "FogOfWar.hpp"
 #include <iostream>
 #include <algorithm>
-#include <cmath>  // For sqrt() in collision detection
 
 // ========== CONSTRUCTORS & DESTRUCTOR ==========
 
-GameManager::GameManager() {
+GameManager::GameManager() : events(nullptr), staticGeometry(nullptr), fog(nullptr) {
     // Vector automatically initialized as empty
     std::cout << "[GameManager] Created" << std::endl;
 }
@@ -53,6 +53,39 @@ void GameManager::addObject(std::unique_ptr<GameObject> obj) {
     // Move into vector (ownership transfer)
     // After this, 'obj' parameter becomes nullptr
     objects.push_back(std::move(obj));
+    if (staticGeometry) {
+        movers.push_back(objects.back().get());  // Not in the static index
+    }
+    
+    if (events) {
+        events->publish(SpawnedEvent{ objects.back().get() });
+    }
+}
+
+void GameManager::setEventBus(EventBus* bus) {
+    this->events = bus;
+}
+
+/**
+ * Every object the index holds (STATIC layer, see StaticBvh::build)
+ * leaves the linear scan; the rest becomes the movers list
+ */
+void GameManager::setStaticGeometry(const StaticBvh* bvh) {
+    staticGeometry = bvh;
+    movers.clear();
+    if (!bvh) {
+        return;
+    }
+    movers.reserve(objects.size() - bvh->size());
+    for (const auto& obj : objects) {
+        if (!(obj->getCollisionShape().layer & CollisionLayer::STATIC)) {
+            movers.push_back(obj.get());
+        }
+    }
+}
+
+void GameManager::setFogOfWar(const FogOfWar* fogOfWar) {
+    this->fog = fogOfWar;
 }
 
 
@@ -80,10 +113,23 @@ void GameManager::updateAll() {
  * Renders all game objects to screen.
  */
 void GameManager::drawAll() {
+    size_t hidden = 0;
     for (const auto& obj : objects) {  // const auto& for read-only
-        if (obj) {
-            obj->draw();  // Polymorphic call - correct draw() for each type!
+        if (!obj) {
+            continue;
         }
+        if (fog) {
+            bool isStatic = (obj->getCollisionShape().layer & CollisionLayer::STATIC) != 0;
+            if (isStatic ? !fog->isExplored(obj->getX(), obj->getY())
+                         : !fog->isVisible(obj->getX(), obj->getY())) {
+                hidden++;
+                continue;
+            }
+        }
+        obj->draw();  // Polymorphic call - correct draw() for each type!
+    }
+    if (hidden > 0) {
+        std::cout << "  🌫️  " << hidden << " object(s) hidden in the fog" << std::endl;
     }
 }
 
@@ -94,6 +140,10 @@ size_t GameManager::size() const {
     return objects.size();
 }
 
+void GameManager::reserve(size_t count) {
+    objects.reserve(count);
+}
+
 bool GameManager::empty() const {
     return objects.empty();
 }
@@ -110,6 +160,8 @@ bool GameManager::empty() const {
 void GameManager::clear() {
     std::cout << "[GameManager] Clearing " << objects.size() << " objects" << std::endl;
     objects.clear();  // Automatic deletion of all objects!
+    movers.clear();
+    staticGeometry = nullptr;  // Pointed into the old objects
 }
 
 /**
@@ -151,6 +203,17 @@ const GameObject* GameManager::getObject(size_t index) const {
 size_t GameManager::removeDeadObjects() {
     size_t originalSize = objects.size();
     
+    if (staticGeometry) {
+        // Same rule, before the objects are deleted (only characters
+        // die: the static index is untouched)
+        movers.erase(std::remove_if(movers.begin(), movers.end(),
+                                    [](const GameObject* obj) {
+                                        const Character* character = dynamic_cast<const Character*>(obj);
+                                        return character && !character->isAlive();
+                                    }),
+                     movers.end());
+    }
+    
     // Erase-remove idiom
     objects.erase(
         std::remove_if(
@@ -176,42 +239,6 @@ size_t GameManager::removeDeadObjects() {
     return removed;
 }
 
-/**
- * Remove expired projectiles (JOB 10)
- * 
- * Removes projectiles that have already hit their target.
- * Uses the same erase-remove idiom as removeDeadObjects.
- * 
- * This is called after processing projectiles to clean them up.
- */
-size_t GameManager::removeExpiredProjectiles() {
-    size_t originalSize = objects.size();
-    
-    // Erase-remove idiom with dynamic_cast
-    objects.erase(
-        std::remove_if(
-            objects.begin(),
-            objects.end(),
-            [](const std::unique_ptr<GameObject>& obj) {
-                // Try to cast to Projectile
-                if (const Projectile* projectile = dynamic_cast<const Projectile*>(obj.get())) {
-                    // Check if projectile has expired (already hit)
-                    if (projectile->isExpired()) {
-                        std::cout << "[GameManager] Removing expired projectile: " 
-                                  << projectile->getName() << std::endl;
-                        return true;  // Mark for removal
-                    }
-                }
-                return false;  // Keep this object
-            }
-        ),
-        objects.end()
-    );
-    
-    size_t removed = originalSize - objects.size();
-    return removed;
-}
-
 /**
  * Find object by name
  * 
@@ -278,11 +305,11 @@ void GameManager::printStats() const {
 /**
  * Check if two objects are colliding
  * 
- * Uses distance-based collision detection:
- * - Calculate distance between objects
- * - If distance < COLLISION_RADIUS, they're colliding
+ * 1. Layer filter: two byte tests (CollisionShape::interacts)
+ * 2. Shape overlap: circles, boxes or one of each
  * 
- * This is the STANDARD 2D collision detection for circular bounds!
+ * Two default shapes (circles of CollisionShape::DEFAULT_RADIUS)
+ * collide below COLLISION_RADIUS, as before per-object shapes.
  */
 bool GameManager::checkCollision(const GameObject* a, const GameObject* b) const {
     if (!a || !b) {
@@ -293,61 +320,40 @@ bool GameManager::checkCollision(const GameObject* a, const GameObject* b) const
         return false;  // Object doesn't collide with itself
     }
     
-    // Calculate distance between objects
-    double dist = a->distance(*b);
-    
-    // Collision if distance is less than collision radius
-    return dist < COLLISION_RADIUS;
+    const CollisionShape& shapeA = a->getCollisionShape();
+    const CollisionShape& shapeB = b->getCollisionShape();
+    if (!shapeA.interacts(shapeB)) {
+        return false;
+    }
+    return CollisionShape::overlaps(a->getX(), a->getY(), shapeA, b->getX(), b->getY(), shapeB);
 }
 
 /**
  * Check if object can move to position without colliding
  * 
- * Algorithm:
- * 1. Create temporary position at (newX, newY)
- * 2. Check distance from (newX, newY) to all other objects
- * 3. If any distance < COLLISION_RADIUS, movement blocked
- * 4. Otherwise, movement is valid
- * 
- * This is preventive collision detection - we check BEFORE moving!
+ * Preventive collision detection - we check BEFORE moving!
+ * (see getBlockingObject)
  */
 bool GameManager::canMoveTo(const GameObject* obj, double newX, double newY) const {
     if (!obj) {
         return false;  // Null object can't move
     }
-    
-    // Check collision with all other objects
-    for (const auto& other : objects) {
-        // Skip if checking against self
-        if (other.get() == obj) {
-            continue;
-        }
-        
-        // Skip if other object is null
-        if (!other) {
-            continue;
-        }
-        
-        // Calculate distance from new position to other object
-        double dx = newX - other->getX();
-        double dy = newY - other->getY();
-        double distance = std::sqrt(dx * dx + dy * dy);
-        
-        // Check for collision
-        if (distance < COLLISION_RADIUS) {
-            // Would collide! Movement blocked
-            return false;
-        }
-    }
-    
-    // No collisions detected, movement is valid
-    return true;
+    return getBlockingObject(obj, newX, newY) == nullptr;
 }
 
 /**
  * Get the object that would block movement
  * 
- * Similar to canMoveTo, but returns WHICH object is blocking.
+ * For every other object:
+ * 1. Layer filter first: objects the mover does not interact with
+ *    (e.g. decor for a ghost, anything for a NONE mask) cost two byte
+ *    tests, no distance math
+ * 2. Then the shape of obj placed at (newX, newY) against the other
+ *    object's shape
+ * 
+ * With static geometry, a moving blocker is reported before a static
+ * one (the old scan reported the first in creation order).
+ * 
  * Useful for providing feedback to player:
  * "Can't move there - Goblin in the way!"
  */
@@ -356,25 +362,29 @@ GameObject* GameManager::getBlockingObject(const GameObject* obj, double newX, d
         return nullptr;
     }
     
-    // Check collision with all other objects
-    for (const auto& other : objects) {
-        // Skip if checking against self
-        if (other.get() == obj) {
-            continue;
+    const CollisionShape& shape = obj->getCollisionShape();
+    if (shape.mask == CollisionLayer::NONE) {
+        return nullptr;  // Collides with nothing
+    }
+    
+    // (A static object itself is in the index: plain scan for it)
+    if (staticGeometry && !(shape.layer & CollisionLayer::STATIC)) {
+        // Moving objects one by one, then one BVH query for the decor
+        for (GameObject* other : movers) {
+            if (other != obj && blocks(shape, newX, newY, other)) {
+                return other;
+            }
         }
-        
-        // Skip if other object is null
-        if (!other) {
+        return staticGeometry->findOverlap(newX, newY, shape);
+    }
+    
+    for (const auto& other : objects) {
+        // Skip if checking against self, or if other object is null
+        if (other.get() == obj || !other) {
             continue;
         }
         
-        // Calculate distance from new position to other object
-        double dx = newX - other->getX();
-        double dy = newY - other->getY();
-        double distance = std::sqrt(dx * dx + dy * dy);
-        
-        // Check for collision
-        if (distance < COLLISION_RADIUS) {
+        if (blocks(shape, newX, newY, other.get())) {
             // Found the blocking object!
             return other.get();  // Return raw pointer
         }
@@ -384,3 +394,11 @@ GameObject* GameManager::getBlockingObject(const GameObject* obj, double newX, d
     return nullptr;
 }
 
+/**
+ * Layer filter, then narrow phase: does 'other' block 'shape' at (x, y)?
+ */
+bool GameManager::blocks(const CollisionShape& shape, double x, double y, const GameObject* other) {
+    const CollisionShape& otherShape = other->getCollisionShape();
+    return shape.interacts(otherShape)
+        && CollisionShape::overlaps(x, y, shape, other->getX(), other->getY(), otherShape);
+}
@@ -2,10 +2,14 @@
 #define GAMEMANAGER_HPP
 
 #include "GameObject.hpp"
+#include "EventBus.hpp"
 #include <vector>
 #include <memory>  // For smart pointers
 #include <string>
 
+class StaticBvh;
+class FogOfWar;
+
 /**
  * GameManager - Container and manager for all game objects
  * 
@@ -34,6 +38,15 @@ private:
     // - No memory leaks possible
     // - Exception safety
     std::vector<std::unique_ptr<GameObject>> objects;
+    
+    EventBus* events;  // Spawn notifications (not owned, may be null)
+    
+    // Static geometry index (not owned, may be null) and every object
+    // NOT in it: the only ones movement tests scan one by one
+    const StaticBvh* staticGeometry;
+    std::vector<GameObject*> movers;
+    
+    const FogOfWar* fog;  // Hero's vision for drawAll (not owned, may be null)
 
 public:
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
@@ -107,12 +120,41 @@ public:
         
         // Move into container (ownership transfer)
         objects.push_back(std::move(obj));
+        if (staticGeometry) {
+            movers.push_back(rawPtr);  // Not in the static index
+        }
+        
+        if (events) {
+            events->publish(SpawnedEvent{ rawPtr });
+        }
         
         // Return raw pointer for immediate use
         return rawPtr;
     }
     
     
+    /**
+     * Publish a SpawnedEvent for every object added from now on
+     * @param bus Event bus (nullptr = no events)
+     */
+    void setEventBus(EventBus* bus);
+    
+    /**
+     * Hand the static objects over to an index built from this manager
+     * (StaticBvh::build): movement tests then scan only the other
+     * objects one by one and ask the index for the static ones.
+     * Static objects must stay alive while the index is in use.
+     * @param bvh Index (nullptr = scan every object again)
+     */
+    void setStaticGeometry(const StaticBvh* bvh);
+    
+    /**
+     * Draw only what the hero can see
+     * @param fogOfWar Vision (nullptr = draw everything)
+     */
+    void setFogOfWar(const FogOfWar* fogOfWar);
+    
+    
     // ========== GAME LOOP OPERATIONS ==========
     
     /**
@@ -133,6 +175,9 @@ public:
      * Calls draw() on every object in the game.
      * This renders all visible entities.
      * 
+     * With a fog of war: static objects (decor) are drawn once explored,
+     * everything else only while in view.
+     * 
      * Demonstrates POLYMORPHISM:
      * - Each object's correct draw() is called
      */
@@ -147,6 +192,11 @@ public:
      */
     size_t size() const;
     
+    /**
+     * Make room for 'count' objects (bulk creation, e.g. scenario loading)
+     */
+    void reserve(size_t count);
+    
     /**
      * Check if game is empty
      * @return true if no objects, false otherwise
@@ -196,16 +246,6 @@ public:
      */
     size_t removeDeadObjects();
     
-    /**
-     * Remove expired projectiles (Job 10)
-     * 
-     * Removes projectiles that have already hit their target.
-     * Called after projectiles are processed.
-     * 
-     * @return Number of projectiles removed
-     */
-    size_t removeExpiredProjectiles();
-    
     /**
      * Find object by name
      * 
@@ -224,20 +264,22 @@ public:
     // ========== COLLISION DETECTION (JOB 09) ==========
     
     /**
-     * Collision radius constant
-     * Objects within this distance are considered colliding
+     * Contact distance of two default shapes (2 x
+     * CollisionShape::DEFAULT_RADIUS). Each object now has its own
+     * shape (GameObject::getCollisionShape); this stays the reference
+     * size for code without an object at hand.
      */
-    static constexpr double COLLISION_RADIUS = 0.5;
+    static constexpr double COLLISION_RADIUS = 2.0 * CollisionShape::DEFAULT_RADIUS;
     
     /**
      * Check if two objects are colliding
      * 
      * @param a First object
      * @param b Second object
-     * @return true if objects are colliding (distance < COLLISION_RADIUS)
+     * @return true if their layers interact and their shapes overlap
      * 
-     * Uses distance-based collision detection with circular bounds.
-     * Two objects collide if their distance is less than COLLISION_RADIUS.
+     * Layer / mask test first (no distance math for objects that can
+     * never touch), then circle / box overlap.
      */
     bool checkCollision(const GameObject* a, const GameObject* b) const;
     
@@ -253,8 +295,10 @@ public:
      * with any other object in the game.
      * 
      * Collision Rules:
-     * - Object cannot move into another object
-     * - Distance-based detection (COLLISION_RADIUS)
+     * - Only objects whose layers interact with obj's shape can block it
+     * - With static geometry: moving objects first (linear scan), then
+     *   one BVH query for the static ones
+     * - obj's shape, placed at (newX, newY), must not overlap theirs
      * - Ignores collision with self
      */
     bool canMoveTo(const GameObject* obj, double newX, double newY) const;
@@ -271,6 +315,9 @@ public:
      * Useful for providing feedback to player.
      */
     GameObject* getBlockingObject(const GameObject* obj, double newX, double newY) const;
+
+private:
+    static bool blocks(const CollisionShape& shape, double x, double y, const GameObject* other);
 };
 
 #endif // GAMEMANAGER_HPP
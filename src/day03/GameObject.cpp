@@ -6,7 +6,9 @@
  * Default constructor
  * Calls Vector2d default constructor (initializes position to 0,0)
  */
-GameObject::GameObject() : Vector2d(), name("Unnamed") {
+GameObject::GameObject()
+    : Vector2d(), name("Unnamed"),
+      shape(CollisionShape::circle(CollisionShape::DEFAULT_RADIUS, CollisionLayer::STATIC, CollisionLayer::ALL)) {
     // Vector2d() calls parent's default constructor
     // name("Unnamed") initializes the name member
 }
@@ -19,7 +21,8 @@ GameObject::GameObject() : Vector2d(), name("Unnamed") {
  * - name(name) initializes the name member
  */
 GameObject::GameObject(double x, double y, const std::string& name) 
-    : Vector2d(x, y), name(name) {
+    : Vector2d(x, y), name(name),
+      shape(CollisionShape::circle(CollisionShape::DEFAULT_RADIUS, CollisionLayer::STATIC, CollisionLayer::ALL)) {
     // Parent (Vector2d) is constructed first with (x, y)
     // Then our member (name) is initialized
 }
@@ -46,7 +49,7 @@ GameObject::~GameObject() {
 
 // ========== NAME ACCESSORS ==========
 
-std::string GameObject::getName() const {
+const std::string& GameObject::getName() const {
     return name;
 }
 
@@ -55,6 +58,17 @@ void GameObject::setName(const std::string& name) {
 }
 
 
+// ========== COLLISION SHAPE ==========
+
+const CollisionShape& GameObject::getCollisionShape() const {
+    return shape;
+}
+
+void GameObject::setCollisionShape(const CollisionShape& shape) {
+    this->shape = shape;
+}
+
+
 // ========== PURE VIRTUAL METHODS ==========
 
 // NOTE: We do NOT implement draw() and update() here!
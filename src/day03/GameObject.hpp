@@ -2,6 +2,7 @@
 #define GAMEOBJECT_HPP
 
 #include "Vector2d.hpp"
+#include "CollisionShape.hpp"
 #include <string>
 
 /**
@@ -18,6 +19,7 @@
 class GameObject : public Vector2d {
 private:
     std::string name;  // Name/identifier for the game object
+    CollisionShape shape;  // Bounds, layer and mask (see CollisionShape.hpp)
 
 public:
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
@@ -49,9 +51,9 @@ public:
     
     /**
      * Get the object's name
-     * @return The name string
+     * @return Const reference to the name (no copy, no allocation)
      */
-    std::string getName() const;
+    const std::string& getName() const;
     
     /**
      * Set the object's name
@@ -60,6 +62,17 @@ public:
     void setName(const std::string& name);
     
     
+    // ========== COLLISION SHAPE ==========
+    
+    /**
+     * Bounds used by the collision code, centred on the position
+     * Default: circle of CollisionShape::DEFAULT_RADIUS on the STATIC
+     * layer; Character and Decor set their own layers.
+     */
+    const CollisionShape& getCollisionShape() const;
+    void setCollisionShape(const CollisionShape& shape);
+    
+    
     // ========== PURE VIRTUAL METHODS (ABSTRACT) ==========
     
     /**
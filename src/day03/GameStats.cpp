@@ -0,0 +1,109 @@
+#include "GameStats.hpp"
+#include "Enemy.hpp"
+
+// ========== CONSTRUCTOR ==========
+
+GameStats::GameStats()
+    : player(nullptr),
+      livingEnemies(0),
+      enemiesSpawned(0),
+      enemiesKilled(0),
+      damageDealt(0),
+      damageTaken(0),
+      hitsLanded(0),
+      projectilesHit(0),
+      projectilesDropped(0)
+{
+}
+
+void GameStats::subscribe(EventBus& bus) {
+    bus.subscribe<SpawnedEvent>(&GameStats::onSpawned, this);
+    bus.subscribe<DamagedEvent>(&GameStats::onDamaged, this);
+    bus.subscribe<DiedEvent>(&GameStats::onDied, this);
+    bus.subscribe<ProjectileExpiredEvent>(&GameStats::onProjectileExpired, this);
+}
+
+void GameStats::setPlayer(const Character* character) {
+    this->player = character;
+}
+
+
+// ========== ACCESSORS ==========
+
+int GameStats::getLivingEnemies() const {
+    return livingEnemies;
+}
+
+int GameStats::getEnemiesSpawned() const {
+    return enemiesSpawned;
+}
+
+int GameStats::getEnemiesKilled() const {
+    return enemiesKilled;
+}
+
+int GameStats::getDamageDealt() const {
+    return damageDealt;
+}
+
+int GameStats::getDamageTaken() const {
+    return damageTaken;
+}
+
+int GameStats::getHitsLanded() const {
+    return hitsLanded;
+}
+
+int GameStats::getProjectilesHit() const {
+    return projectilesHit;
+}
+
+int GameStats::getProjectilesDropped() const {
+    return projectilesDropped;
+}
+
+
+// ========== EVENT HANDLERS ==========
+
+/*
+ * Spawn and death are rare: one dynamic_cast per event, never per turn
+ */
+
+void GameStats::onSpawned(void* context, const SpawnedEvent& event) {
+    GameStats* stats = static_cast<GameStats*>(context);
+    if (const Enemy* enemy = dynamic_cast<const Enemy*>(event.object)) {
+        stats->enemiesSpawned++;
+        if (enemy->isAlive()) {
+            stats->livingEnemies++;
+        }
+    }
+}
+
+void GameStats::onDamaged(void* context, const DamagedEvent& event) {
+    GameStats* stats = static_cast<GameStats*>(context);
+    int lost = event.healthBefore - event.healthAfter;
+    stats->hitsLanded++;
+    if (event.attacker == stats->player) {
+        stats->damageDealt += lost;
+    }
+    if (event.target == stats->player) {
+        stats->damageTaken += lost;
+    }
+}
+
+void GameStats::onDied(void* context, const DiedEvent& event) {
+    GameStats* stats = static_cast<GameStats*>(context);
+    if (dynamic_cast<const Enemy*>(event.victim)) {
+        stats->enemiesKilled++;
+        stats->livingEnemies--;
+    }
+}
+
+void GameStats::onProjectileExpired(void* context, const ProjectileExpiredEvent& event) {
+    GameStats* stats = static_cast<GameStats*>(context);
+    if (event.hit) {
+        stats->projectilesHit++;
+    } else {
+        stats->projectilesDropped++;
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef GAMESTATS_HPP
+#define GAMESTATS_HPP
+
+#include "EventBus.hpp"
+
+/**
+ * GameStats - Running totals of the fight, updated from events
+ *
+ * Instead of walking every object to count enemies (dynamic_cast on
+ * the whole manager each time the UI or the game-over check asks),
+ * the stats subscribe to the EventBus and adjust a few counters when
+ * something actually happens: an object spawns, a hit lands, a
+ * character dies, a projectile expires.
+ *
+ * Values are as of the last EventBus::drain() (once per turn).
+ */
+class GameStats {
+private:
+    const Character* player;   // Hits by / on the player are tracked apart
+
+    int livingEnemies;
+    int enemiesSpawned;
+    int enemiesKilled;
+    int damageDealt;           // By the player
+    int damageTaken;           // By the player
+    int hitsLanded;            // Every hit of the game
+    int projectilesHit;
+    int projectilesDropped;
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    GameStats();
+
+    /**
+     * Subscribe to every channel of the bus
+     * @param bus Must outlive this object's subscriptions
+     */
+    void subscribe(EventBus& bus);
+
+    /**
+     * The character whose damage dealt / taken is tracked
+     */
+    void setPlayer(const Character* character);
+
+
+    // ========== ACCESSORS ==========
+
+    int getLivingEnemies() const;
+    int getEnemiesSpawned() const;
+    int getEnemiesKilled() const;
+    int getDamageDealt() const;
+    int getDamageTaken() const;
+    int getHitsLanded() const;
+    int getProjectilesHit() const;
+    int getProjectilesDropped() const;
+
+private:
+    // ========== EVENT HANDLERS ==========
+
+    static void onSpawned(void* context, const SpawnedEvent& event);
+    static void onDamaged(void* context, const DamagedEvent& event);
+    static void onDied(void* context, const DiedEvent& event);
+    static void onProjectileExpired(void* context, const ProjectileExpiredEvent& event);
+};
+
+#endif // GAMESTATS_HPP
@@ -0,0 +1,108 @@
+#ifndef GEOMETRY_HPP
+#define GEOMETRY_HPP
+
+#include <cmath>
+
+/**
+ * Geometry - Small intersection tests shared by the collision code
+ *
+ * Plain doubles in and out (no Vector2d): these run in the inner loops
+ * of the spatial queries.
+ */
+namespace Geometry {
+
+    /**
+     * Swept circle: first contact of a point moving along a segment
+     * with a circle (continuous collision detection)
+     *
+     * The point moves from (startX, startY) by (moveX, moveY) during the
+     * step; its position at time t (0..1) is start + t * move. A circle of
+     * radius R around a moving point of radius r is the same test with
+     * R + r, so pass the sum of both radii.
+     *
+     * Solves |start + t * move - center|² = radius² for the smallest t:
+     *   a t² + b t + c = 0,  f = start - center
+     *   a = move·move,  b = 2 f·move,  c = f·f - radius²
+     *
+     * A fast projectile that jumps over the circle in one step is still
+     * caught, which a test at the end position alone would miss
+     * (tunneling).
+     *
+     * @param t Receives the time of first contact (0 if it starts inside)
+     * @return true if the segment touches the circle
+     */
+    inline bool sweepCircle(double startX, double startY, double moveX, double moveY,
+                            double centerX, double centerY, double radius, double& t) {
+        double fx = startX - centerX;
+        double fy = startY - centerY;
+        double c = fx * fx + fy * fy - radius * radius;
+        if (c <= 0.0) {
+            t = 0.0;  // Already overlapping
+            return true;
+        }
+
+        double a = moveX * moveX + moveY * moveY;
+        double b = 2.0 * (fx * moveX + fy * moveY);
+        if (a == 0.0 || b >= 0.0) {
+            return false;  // Not moving, or moving away
+        }
+
+        double discriminant = b * b - 4.0 * a * c;
+        if (discriminant < 0.0) {
+            return false;  // The line passes beside the circle
+        }
+
+        double hit = (-b - std::sqrt(discriminant)) / (2.0 * a);
+        if (hit > 1.0) {
+            return false;  // Contact after the end of this step
+        }
+        t = hit;
+        return true;
+    }
+
+    /**
+     * Segment against an axis-aligned box (slab test)
+     *
+     * For each axis, the segment is inside the slab [min, max] between
+     * two times; the segment is in the box where all the intervals
+     * overlap: [max of entries, min of exits]. A zero move along an
+     * axis is inside the slab for all t, or never.
+     *
+     * @param t Receives the time of first contact (0 if it starts inside)
+     * @return true if the segment touches the box during 0..1
+     */
+    inline bool sweepBox(double startX, double startY, double moveX, double moveY,
+                         double minX, double minY, double maxX, double maxY, double& t) {
+        double enter = 0.0;
+        double exit = 1.0;
+        const double start[2] = { startX, startY };
+        const double move[2] = { moveX, moveY };
+        const double low[2] = { minX, minY };
+        const double high[2] = { maxX, maxY };
+        for (int axis = 0; axis < 2; axis++) {
+            if (move[axis] == 0.0) {
+                if (start[axis] < low[axis] || start[axis] > high[axis]) {
+                    return false;  // Parallel to the slab, outside it
+                }
+                continue;
+            }
+            double inverse = 1.0 / move[axis];
+            double t0 = (low[axis] - start[axis]) * inverse;
+            double t1 = (high[axis] - start[axis]) * inverse;
+            if (t0 > t1) {
+                double swap = t0;
+                t0 = t1;
+                t1 = swap;
+            }
+            enter = t0 > enter ? t0 : enter;
+            exit = t1 < exit ? t1 : exit;
+            if (enter > exit) {
+                return false;
+            }
+        }
+        t = enter;
+        return true;
+    }
+}
+
+#endif // GEOMETRY_HPP
@@ -0,0 +1,867 @@
+#include "HierarchicalPathfinder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+
+namespace {
+    const int NEIGHBOUR_DX[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+    const int NEIGHBOUR_DY[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+    const int UNREACHED = 0x7fffffff;
+
+    struct OpenEntryGreater {
+        template<typename Entry>
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (a.f != b.f) return a.f > b.f;
+            return a.g < b.g;
+        }
+    };
+
+    double microsSince(std::chrono::steady_clock::time_point start) {
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+// ========== CONSTRUCTOR ==========
+
+HierarchicalPathfinder::HierarchicalPathfinder(const NavGrid& navGrid)
+    : grid(&navGrid),
+      clustersX(0),
+      clustersY(0),
+      built(false),
+      nextComponent(0),
+      cellGeneration(0),
+      nodeGeneration(0),
+      graphVersion(0),
+      localBounds{0, 0, -1, -1},
+      lastExpanded(0),
+      buildMicros(0.0),
+      lastQueryMicros(0.0)
+{
+}
+
+
+// ========== BUILDING ==========
+
+/**
+ * Full build
+ *
+ * 1. Components: flood fill inside every cluster
+ * 2. Borders: for every pair of adjacent clusters, create transitions
+ * The intra-cluster edges come later, one cluster at a time, from the
+ * queries that reach it (connectCluster).
+ */
+void HierarchicalPathfinder::build() {
+    auto startTime = std::chrono::steady_clock::now();
+
+    const size_t cellCount = grid->getCellCount();
+    clustersX = (grid->getWidth() + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clustersY = (grid->getHeight() + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+
+    nodes.clear();
+    freeNodes.clear();
+    clusterNodes.assign(static_cast<size_t>(clustersX) * clustersY, std::vector<int>());
+    nodeAtCell.assign(cellCount, -1);
+    cellComponent.assign(cellCount, -1);
+    clusterConnected.assign(static_cast<size_t>(clustersX) * clustersY, 0);
+    componentQueue.resize(LOCAL_CELLS);
+    localHeap.reserve(8 * LOCAL_CELLS);  // Lazy deletion: at most one push per step
+    nextComponent = 0;
+
+    cellCost.assign(cellCount, 0);
+    cellParent.assign(cellCount, -1);
+    cellOpen.assign(cellCount, 0u);
+    cellClosed.assign(cellCount, 0u);
+    cellGeneration = 0;
+
+    linkCache.resize(LINK_CACHE_SLOTS);
+    graphVersion++;
+
+    for (int cluster = 0; cluster < clustersX * clustersY; cluster++) {
+        labelComponents(cluster);
+    }
+
+    for (int cy = 0; cy < clustersY; cy++) {
+        for (int cx = 0; cx < clustersX; cx++) {
+            int cluster = cy * clustersX + cx;
+            if (cx + 1 < clustersX) buildBorder(cluster, cluster + 1, true);
+            if (cy + 1 < clustersY) buildBorder(cluster, cluster + clustersX, false);
+        }
+    }
+
+    // Query buffers, sized now: a query (and the cluster links it
+    // computes) then runs without allocating
+    const size_t slots = nodes.size() + 1;  // Every node, plus the goal
+    nodeCost.assign(slots, 0);
+    nodeF.assign(slots, 0);
+    nodeParent.assign(slots, -1);
+    nodeHeapPosition.assign(slots, 0);
+    nodeOpen.assign(slots, 0u);
+    nodeClosed.assign(slots, 0u);
+    nodeGoalMark.assign(slots, 0u);
+    nodeGoalCost.assign(slots, 0);
+    nodeGeneration = 0;
+    nodeHeap.reserve(slots);
+    waypointCells.reserve(slots + 1);
+    openHeap.reserve(16 * LOCAL_CELLS);    // Two clusters, at most 8 pushes per cell
+    scratchCells.reserve(2 * LOCAL_CELLS);
+
+    size_t maxClusterNodes = 0;
+    for (const std::vector<int>& members : clusterNodes) {
+        maxClusterNodes = std::max(maxClusterNodes, members.size());
+        for (int id : members) {
+            nodes[id].edges.reserve(nodes[id].edges.size() + members.size() - 1);
+        }
+    }
+    for (LinkSlot& slot : linkCache) {
+        slot.links.reserve(maxClusterNodes);
+    }
+
+    built = true;
+    buildMicros = microsSince(startTime);
+}
+
+/**
+ * Local update after a Decor change
+ *
+ * The cell can only affect the components of its cluster, the entrances
+ * on the 4 borders of that cluster, and the intra-cluster edges of that
+ * cluster and of its 4 neighbours (their border nodes may have
+ * changed). Those 5 clusters are left disconnected: the next query
+ * through them relinks them.
+ */
+void HierarchicalPathfinder::onCellChanged(int cx, int cy) {
+    if (!isBuilt() || !grid->inBounds(cx, cy)) {
+        return;
+    }
+
+    int cluster = clusterOf(cx, cy);
+    int ccx = cluster % clustersX;
+    int ccy = cluster / clustersX;
+
+    int affected[5];
+    int affectedCount = 0;
+    affected[affectedCount++] = cluster;
+    if (ccx > 0) affected[affectedCount++] = cluster - 1;
+    if (ccx + 1 < clustersX) affected[affectedCount++] = cluster + 1;
+    if (ccy > 0) affected[affectedCount++] = cluster - clustersX;
+    if (ccy + 1 < clustersY) affected[affectedCount++] = cluster + clustersX;
+
+    // 1. Drop the inter-cluster edges on the 4 borders of 'cluster'
+    for (int i = 1; i < affectedCount; i++) {
+        int neighbour = affected[i];
+        for (int id : clusterNodes[cluster]) removeEdgesTo(id, neighbour);
+        for (int id : clusterNodes[neighbour]) removeEdgesTo(id, cluster);
+    }
+
+    // 2. Drop the intra-cluster edges of all affected clusters, then the
+    //    nodes that no longer have any transition
+    for (int i = 0; i < affectedCount; i++) {
+        int k = affected[i];
+        for (int id : clusterNodes[k]) removeEdgesTo(id, k);
+
+        std::vector<int> candidates = clusterNodes[k];
+        for (int id : candidates) {
+            if (nodes[id].edges.empty()) {
+                removeNode(id);
+            }
+        }
+    }
+
+    // 3. Relabel the cell's cluster, rebuild its 4 borders (existing
+    //    nodes are reused)
+    labelComponents(cluster);
+    for (int i = 1; i < affectedCount; i++) {
+        int neighbour = affected[i];
+        if (neighbour == cluster + 1) buildBorder(cluster, neighbour, true);
+        else if (neighbour == cluster - 1) buildBorder(neighbour, cluster, true);
+        else if (neighbour == cluster + clustersX) buildBorder(cluster, neighbour, false);
+        else buildBorder(neighbour, cluster, false);
+    }
+
+    // 4. Intra-cluster edges were dropped: relinked on demand
+    for (int i = 0; i < affectedCount; i++) {
+        clusterConnected[affected[i]] = 0;
+    }
+    graphVersion++;  // Cached start/goal links may point to removed nodes
+}
+
+bool HierarchicalPathfinder::isBuilt() const {
+    return built && nodeAtCell.size() == grid->getCellCount();
+}
+
+
+// ========== QUERIES ==========
+
+/**
+ * Abstract query
+ *
+ * 1. Start and goal in the same cluster: try a local search first
+ * 2. Link start and goal to the nodes of their clusters (cached per
+ *    cell, the graph itself is not touched)
+ * 3. A* over the abstract graph (octile heuristic on node cells), with
+ *    the goal as one extra node reached through its links. A node of a
+ *    cluster not connected yet connects it before it is expanded.
+ */
+bool HierarchicalPathfinder::findAbstractPath(int startCell, int goalCell,
+                                              std::vector<int>& outWaypoints) {
+    auto startTime = std::chrono::steady_clock::now();
+    outWaypoints.clear();
+    lastExpanded = 0;
+
+    const int cellCount = static_cast<int>(grid->getCellCount());  // Fits: NavGrid::MAX_CELLS
+    if (!isBuilt() || startCell < 0 || goalCell < 0
+        || startCell >= cellCount || goalCell >= cellCount) {
+        return false;
+    }
+
+    const int width = grid->getWidth();
+    if (startCell == goalCell) {
+        outWaypoints.push_back(startCell);
+        lastQueryMicros = microsSince(startTime);
+        return true;
+    }
+
+    int startCluster = clusterOf(startCell % width, startCell / width);
+    int goalCluster = clusterOf(goalCell % width, goalCell / width);
+
+    if (startCluster == goalCluster
+        && boundedSearch(startCell, goalCell, clusterBounds(startCluster))) {
+        outWaypoints.push_back(startCell);
+        outWaypoints.push_back(goalCell);
+        lastQueryMicros = microsSince(startTime);
+        return true;
+    }
+
+    // ---- Pooled arrays: one slot per node, plus the goal ----
+    const int goalId = static_cast<int>(nodes.size());
+    if (nodeCost.size() < nodes.size() + 1) {
+        // Nodes were added since build() (onCellChanged)
+        nodeCost.resize(nodes.size() + 1, 0);
+        nodeF.resize(nodes.size() + 1, 0);
+        nodeParent.resize(nodes.size() + 1, -1);
+        nodeHeapPosition.resize(nodes.size() + 1, 0);
+        nodeOpen.resize(nodes.size() + 1, 0u);
+        nodeClosed.resize(nodes.size() + 1, 0u);
+        nodeGoalMark.resize(nodes.size() + 1, 0u);
+        nodeGoalCost.resize(nodes.size() + 1, 0);
+    }
+    nodeGeneration++;
+    if (nodeGeneration == 0) {
+        std::fill(nodeOpen.begin(), nodeOpen.end(), 0u);
+        std::fill(nodeClosed.begin(), nodeClosed.end(), 0u);
+        std::fill(nodeGoalMark.begin(), nodeGoalMark.end(), 0u);
+        nodeGeneration = 1;
+    }
+
+    // ---- Goal links first (the start's may evict them from the cache) ----
+    for (const Link& link : cellLinks(goalCell, goalCluster)) {
+        nodeGoalMark[link.node] = nodeGeneration;
+        nodeGoalCost[link.node] = link.cost;
+    }
+
+    // ---- Abstract A*, seeded with the start links ----
+    // Weighted heuristic: far fewer nodes expanded on long queries, for
+    // paths a few % longer (a closed node is not reopened)
+    auto relax = [&](int id, int parentId, int newCost, int h) {
+        if (nodeClosed[id] == nodeGeneration) {
+            return;
+        }
+        if (nodeOpen[id] != nodeGeneration) {
+            nodeOpen[id] = nodeGeneration;
+            nodeCost[id] = newCost;
+            nodeF[id] = newCost + h;
+            nodeParent[id] = parentId;
+            nodeHeapPush(id);
+        } else if (newCost < nodeCost[id]) {
+            nodeF[id] -= nodeCost[id] - newCost;  // Same h
+            nodeCost[id] = newCost;
+            nodeParent[id] = parentId;
+            nodeHeapSiftUp(nodeHeapPosition[id]);
+        }
+    };
+    auto weighted = [&](int id) {
+        return octile(nodes[id].cell, goalCell) * ABSTRACT_WEIGHT_TENTHS / 10;
+    };
+
+    nodeHeap.clear();
+    for (const Link& link : cellLinks(startCell, startCluster)) {
+        relax(link.node, -1, link.cost, weighted(link.node));
+    }
+
+    bool found = false;
+    while (!nodeHeap.empty()) {
+        const int current = nodeHeapPop();
+        nodeClosed[current] = nodeGeneration;
+        lastExpanded++;
+
+        if (current == goalId) {
+            found = true;
+            break;
+        }
+
+        if (nodeGoalMark[current] == nodeGeneration) {
+            relax(goalId, current, nodeCost[current] + nodeGoalCost[current], 0);
+        }
+        int cluster = nodes[current].cluster;
+        if (!clusterConnected[cluster]) {
+            connectCluster(cluster);
+        }
+        for (const AbstractEdge& edge : nodes[current].edges) {
+            relax(edge.to, current, nodeCost[current] + edge.cost, weighted(edge.to));
+        }
+    }
+
+    if (found) {
+        outWaypoints.push_back(goalCell);
+        for (int id = nodeParent[goalId]; id != -1; id = nodeParent[id]) {
+            if (nodes[id].cell != outWaypoints.back()) {
+                outWaypoints.push_back(nodes[id].cell);
+            }
+        }
+        if (outWaypoints.back() != startCell) {
+            outWaypoints.push_back(startCell);
+        }
+        std::reverse(outWaypoints.begin(), outWaypoints.end());
+    }
+
+    lastQueryMicros = microsSince(startTime);
+    return found;
+}
+
+/**
+ * Full query: abstract path, then each abstract edge is turned into
+ * cells by a search bounded to its cluster(s)
+ */
+bool HierarchicalPathfinder::findPath(int startCell, int goalCell, std::vector<int>& outCells) {
+    outCells.clear();
+    if (!findAbstractPath(startCell, goalCell, waypointCells)) {
+        return false;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    double abstractMicros = lastQueryMicros;
+
+    outCells.push_back(waypointCells[0]);
+    for (size_t i = 0; i + 1 < waypointCells.size(); i++) {
+        if (!refineSegment(waypointCells[i], waypointCells[i + 1], outCells)) {
+            outCells.clear();
+            return false;
+        }
+    }
+
+    lastQueryMicros = abstractMicros + microsSince(startTime);
+    return true;
+}
+
+
+// ========== METRICS ==========
+
+size_t HierarchicalPathfinder::getNodeCount() const {
+    return nodes.size() - freeNodes.size();
+}
+
+size_t HierarchicalPathfinder::getEdgeCount() const {
+    size_t count = 0;
+    for (const AbstractNode& node : nodes) {
+        if (node.alive) count += node.edges.size();
+    }
+    return count;
+}
+
+size_t HierarchicalPathfinder::getConnectedClusterCount() const {
+    return static_cast<size_t>(std::count(clusterConnected.begin(), clusterConnected.end(), 1));
+}
+
+double HierarchicalPathfinder::getBuildMicros() const {
+    return buildMicros;
+}
+
+double HierarchicalPathfinder::getLastQueryMicros() const {
+    return lastQueryMicros;
+}
+
+size_t HierarchicalPathfinder::getLastExpanded() const {
+    return lastExpanded;
+}
+
+
+// ========== PRIVATE HELPERS ==========
+
+int HierarchicalPathfinder::clusterOf(int x, int y) const {
+    return (y / CLUSTER_SIZE) * clustersX + (x / CLUSTER_SIZE);
+}
+
+HierarchicalPathfinder::Bounds HierarchicalPathfinder::clusterBounds(int cluster) const {
+    Bounds bounds;
+    bounds.minX = (cluster % clustersX) * CLUSTER_SIZE;
+    bounds.minY = (cluster / clustersX) * CLUSTER_SIZE;
+    bounds.maxX = std::min(bounds.minX + CLUSTER_SIZE, grid->getWidth()) - 1;
+    bounds.maxY = std::min(bounds.minY + CLUSTER_SIZE, grid->getHeight()) - 1;
+    return bounds;
+}
+
+/**
+ * Flood fill of one cluster
+ *
+ * Straight and diagonal steps with NavGrid::canStep (no corner
+ * cutting), never leaving the cluster: two cells share a label iff a
+ * path inside the cluster joins them.
+ */
+void HierarchicalPathfinder::labelComponents(int cluster) {
+    const Bounds bounds = clusterBounds(cluster);
+    for (int y = bounds.minY; y <= bounds.maxY; y++) {
+        for (int x = bounds.minX; x <= bounds.maxX; x++) {
+            cellComponent[grid->index(x, y)] = -1;
+        }
+    }
+
+    for (int y = bounds.minY; y <= bounds.maxY; y++) {
+        for (int x = bounds.minX; x <= bounds.maxX; x++) {
+            const int seed = grid->index(x, y);
+            if (grid->isBlocked(x, y) || cellComponent[seed] != -1) {
+                continue;
+            }
+            const int label = nextComponent++;
+            int head = 0, tail = 0;
+            cellComponent[seed] = label;
+            componentQueue[tail++] = seed;
+            while (head < tail) {
+                const int current = componentQueue[head++];
+                const int cx = current % grid->getWidth();
+                const int cy = current / grid->getWidth();
+                for (int n = 0; n < 8; n++) {
+                    const int nx = cx + NEIGHBOUR_DX[n];
+                    const int ny = cy + NEIGHBOUR_DY[n];
+                    if (!bounds.contains(nx, ny) || !grid->canStep(cx, cy, NEIGHBOUR_DX[n], NEIGHBOUR_DY[n])) {
+                        continue;
+                    }
+                    const int neighbour = grid->index(nx, ny);
+                    if (cellComponent[neighbour] == -1) {
+                        cellComponent[neighbour] = label;
+                        componentQueue[tail++] = neighbour;  // At most one slot per cluster cell
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Entrance detection on one border
+ *
+ * Walk along the border; a run is a maximal sequence of positions where
+ * the cells on both sides are walkable. Runs joining the same component
+ * on each side are one entrance: a path crossing any of them can cross
+ * at another, so only the widest run gets transitions. Narrow runs get
+ * one transition in the middle, wide runs one at each end (better paths
+ * near walls).
+ */
+void HierarchicalPathfinder::buildBorder(int clusterA, int clusterB, bool vertical) {
+    Bounds a = clusterBounds(clusterA);
+    int first = vertical ? a.minY : a.minX;
+    int last = vertical ? a.maxY : a.maxX;
+
+    auto cellPair = [&](int t, int& cellA, int& cellB) {
+        if (vertical) {
+            cellA = grid->index(a.maxX, t);
+            cellB = grid->index(a.maxX + 1, t);
+        } else {
+            cellA = grid->index(t, a.maxY);
+            cellB = grid->index(t, a.maxY + 1);
+        }
+    };
+    auto isOpen = [&](int t) {
+        return vertical
+            ? !grid->isBlocked(a.maxX, t) && !grid->isBlocked(a.maxX + 1, t)
+            : !grid->isBlocked(t, a.maxY) && !grid->isBlocked(t, a.maxY + 1);
+    };
+    auto addTransition = [&](int t) {
+        int cellA, cellB;
+        cellPair(t, cellA, cellB);
+        int nodeA = getOrCreateNode(cellA, clusterA);
+        int nodeB = getOrCreateNode(cellB, clusterB);
+        addEdge(nodeA, nodeB, STRAIGHT_COST);
+        addEdge(nodeB, nodeA, STRAIGHT_COST);
+    };
+
+    // Runs are separated by a closed position: at most (size + 1) / 2
+    struct Entrance {
+        int componentA, componentB;
+        int firstStart, firstEnd;  // First run along the border
+        int lastStart, lastEnd;    // Last run so far
+    };
+    Entrance entrances[(CLUSTER_SIZE + 1) / 2];
+    int entranceCount = 0;
+
+    int runStart = -1;
+    for (int t = first; t <= last + 1; t++) {
+        bool open = (t <= last) && isOpen(t);
+        if (open && runStart == -1) {
+            runStart = t;
+        } else if (!open && runStart != -1) {
+            int runEnd = t - 1;
+            int cellA, cellB;
+            cellPair(runStart, cellA, cellB);
+            int e = 0;
+            while (e < entranceCount && (entrances[e].componentA != cellComponent[cellA]
+                                         || entrances[e].componentB != cellComponent[cellB])) {
+                e++;
+            }
+            if (e == entranceCount) {
+                entrances[entranceCount++] = {cellComponent[cellA], cellComponent[cellB],
+                                              runStart, runEnd, runStart, runEnd};
+            } else {
+                entrances[e].lastStart = runStart;
+                entrances[e].lastEnd = runEnd;
+            }
+            runStart = -1;
+        }
+    }
+
+    for (int e = 0; e < entranceCount; e++) {
+        const Entrance& entrance = entrances[e];
+        if (entrance.firstStart != entrance.lastStart) {
+            addTransition((entrance.firstStart + entrance.firstEnd) / 2);
+            addTransition((entrance.lastStart + entrance.lastEnd) / 2);
+        } else if (entrance.firstEnd - entrance.firstStart + 1 < MAX_ENTRANCE_WIDTH) {
+            addTransition((entrance.firstStart + entrance.firstEnd) / 2);
+        } else {
+            addTransition(entrance.firstStart);
+            addTransition(entrance.firstEnd);
+        }
+    }
+}
+
+/**
+ * One Dijkstra per node gives its cost to every other node of the
+ * cluster at once. Steps are symmetric (canStep), so node i only needs
+ * the nodes after it: each pair is searched once and linked both ways.
+ */
+void HierarchicalPathfinder::connectCluster(int cluster) {
+    const std::vector<int>& members = clusterNodes[cluster];
+    for (int id : members) {
+        removeEdgesTo(id, cluster);
+    }
+
+    loadCluster(cluster);
+    for (size_t i = 0; i + 1 < members.size(); i++) {
+        localDijkstra(nodes[members[i]].cell);
+        for (size_t j = i + 1; j < members.size(); j++) {
+            int cost = localCost[localIndex(nodes[members[j]].cell)];
+            if (cost != UNREACHED) {
+                addEdge(members[i], members[j], cost);
+                addEdge(members[j], members[i], cost);
+            }
+        }
+    }
+    clusterConnected[cluster] = 1;
+}
+
+void HierarchicalPathfinder::loadCluster(int cluster) {
+    localBounds = clusterBounds(cluster);
+    for (int y = localBounds.minY; y <= localBounds.maxY; y++) {
+        for (int x = localBounds.minX; x <= localBounds.maxX; x++) {
+            uint8_t steps = 0;
+            for (int n = 0; n < 8; n++) {
+                if (localBounds.contains(x + NEIGHBOUR_DX[n], y + NEIGHBOUR_DY[n])
+                    && grid->canStep(x, y, NEIGHBOUR_DX[n], NEIGHBOUR_DY[n])) {
+                    steps |= static_cast<uint8_t>(1u << n);
+                }
+            }
+            localSteps[(y - localBounds.minY) * CLUSTER_SIZE + (x - localBounds.minX)] = steps;
+        }
+    }
+}
+
+/**
+ * Dijkstra on at most CLUSTER_SIZE^2 cells: costs in a small local
+ * array, and the heap holds one packed key (cost, local cell) per entry
+ */
+void HierarchicalPathfinder::localDijkstra(int startCell) {
+    static const int LOCAL_OFFSET[8] = {
+        1, -1, CLUSTER_SIZE, -CLUSTER_SIZE,
+        CLUSTER_SIZE + 1, -CLUSTER_SIZE + 1, CLUSTER_SIZE - 1, -CLUSTER_SIZE - 1
+    };
+    const uint32_t localMask = (1u << LOCAL_BITS) - 1;
+
+    localCost.fill(UNREACHED);
+    localHeap.clear();
+    const int start = localIndex(startCell);
+    localCost[start] = 0;
+    localHeap.push_back(static_cast<uint32_t>(start));
+
+    while (!localHeap.empty()) {
+        std::pop_heap(localHeap.begin(), localHeap.end(), std::greater<uint32_t>());
+        const uint32_t key = localHeap.back();
+        localHeap.pop_back();
+        const int cost = static_cast<int>(key >> LOCAL_BITS);
+        const int cell = static_cast<int>(key & localMask);
+        if (cost != localCost[cell]) {
+            continue;  // Stale entry
+        }
+
+        const uint8_t steps = localSteps[cell];
+        for (int n = 0; n < 8; n++) {
+            if (!(steps & (1u << n))) {
+                continue;
+            }
+            const int next = cell + LOCAL_OFFSET[n];
+            const int nextCost = cost + (n >= 4 ? DIAGONAL_COST : STRAIGHT_COST);
+            if (nextCost < localCost[next]) {
+                localCost[next] = nextCost;
+                localHeap.push_back((static_cast<uint32_t>(nextCost) << LOCAL_BITS) | static_cast<uint32_t>(next));
+                std::push_heap(localHeap.begin(), localHeap.end(), std::greater<uint32_t>());
+            }
+        }
+    }
+}
+
+/**
+ * Direct-mapped cache: a start or goal cell asked again (the player's
+ * cell, an enemy that has not moved) skips its Dijkstra. Moves are
+ * symmetric, so the same costs serve start and goal.
+ */
+const std::vector<HierarchicalPathfinder::Link>& HierarchicalPathfinder::cellLinks(int cell, int cluster) {
+    LinkSlot& slot = linkCache[(static_cast<uint32_t>(cell) * 2654435761u) % LINK_CACHE_SLOTS];
+    if (slot.cell == cell && slot.version == graphVersion) {
+        return slot.links;
+    }
+
+    slot.cell = cell;
+    slot.version = graphVersion;
+    slot.links.clear();
+    loadCluster(cluster);
+    localDijkstra(cell);
+    for (int id : clusterNodes[cluster]) {
+        int cost = localCost[localIndex(nodes[id].cell)];
+        if (cost != UNREACHED) {
+            slot.links.push_back({id, cost});
+        }
+    }
+    return slot.links;
+}
+
+int HierarchicalPathfinder::getOrCreateNode(int cell, int cluster) {
+    if (nodeAtCell[cell] != -1) {
+        return nodeAtCell[cell];
+    }
+
+    int id;
+    if (!freeNodes.empty()) {
+        id = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        id = static_cast<int>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    AbstractNode& node = nodes[id];
+    node.cell = cell;
+    node.cluster = cluster;
+    node.alive = true;
+    node.edges.clear();
+
+    nodeAtCell[cell] = id;
+    clusterNodes[cluster].push_back(id);
+    return id;
+}
+
+/**
+ * Remove a node and every edge pointing to it
+ * (edges are always created in pairs, so the node's own edge list
+ * tells us which nodes point back)
+ */
+void HierarchicalPathfinder::removeNode(int id) {
+    AbstractNode& node = nodes[id];
+    for (const AbstractEdge& edge : node.edges) {
+        std::vector<AbstractEdge>& back = nodes[edge.to].edges;
+        back.erase(std::remove_if(back.begin(), back.end(),
+                                  [id](const AbstractEdge& e) { return e.to == id; }),
+                   back.end());
+    }
+    // Intra edges are one-way per direction but added from both ends,
+    // so also scan the cluster for stragglers
+    for (int other : clusterNodes[node.cluster]) {
+        std::vector<AbstractEdge>& edges = nodes[other].edges;
+        edges.erase(std::remove_if(edges.begin(), edges.end(),
+                                   [id](const AbstractEdge& e) { return e.to == id; }),
+                    edges.end());
+    }
+
+    std::vector<int>& members = clusterNodes[node.cluster];
+    members.erase(std::remove(members.begin(), members.end(), id), members.end());
+
+    nodeAtCell[node.cell] = -1;
+    node.alive = false;
+    node.edges.clear();
+    freeNodes.push_back(id);
+}
+
+void HierarchicalPathfinder::addEdge(int from, int to, int cost) {
+    nodes[from].edges.push_back({to, cost});
+}
+
+void HierarchicalPathfinder::removeEdgesTo(int from, int targetCluster) {
+    std::vector<AbstractEdge>& edges = nodes[from].edges;
+    edges.erase(std::remove_if(edges.begin(), edges.end(),
+                               [&](const AbstractEdge& e) { return nodes[e.to].cluster == targetCluster; }),
+                edges.end());
+}
+
+/**
+ * Grid A* (or Dijkstra when goalCell is -1) that never leaves 'bounds'
+ */
+bool HierarchicalPathfinder::boundedSearch(int startCell, int goalCell, const Bounds& bounds) {
+    nextCellGeneration();
+    const int width = grid->getWidth();
+
+    openHeap.clear();
+    cellCost[startCell] = 0;
+    cellParent[startCell] = -1;
+    cellOpen[startCell] = cellGeneration;
+    openHeap.push_back({goalCell >= 0 ? octile(startCell, goalCell) : 0, 0, startCell});
+
+    while (!openHeap.empty()) {
+        std::pop_heap(openHeap.begin(), openHeap.end(), OpenEntryGreater());
+        OpenEntry current = openHeap.back();
+        openHeap.pop_back();
+
+        if (cellClosed[current.id] == cellGeneration || current.g != cellCost[current.id]) {
+            continue;
+        }
+        cellClosed[current.id] = cellGeneration;
+
+        if (current.id == goalCell) {
+            return true;
+        }
+
+        int x = current.id % width;
+        int y = current.id / width;
+        for (int n = 0; n < 8; n++) {
+            int dx = NEIGHBOUR_DX[n];
+            int dy = NEIGHBOUR_DY[n];
+            if (!bounds.contains(x + dx, y + dy) || !grid->canStep(x, y, dx, dy)) {
+                continue;
+            }
+            int neighbour = grid->index(x + dx, y + dy);
+            if (cellClosed[neighbour] == cellGeneration) {
+                continue;
+            }
+            int newCost = current.g + ((dx != 0 && dy != 0) ? DIAGONAL_COST : STRAIGHT_COST);
+            if (cellOpen[neighbour] != cellGeneration || newCost < cellCost[neighbour]) {
+                cellOpen[neighbour] = cellGeneration;
+                cellCost[neighbour] = newCost;
+                cellParent[neighbour] = current.id;
+                int h = goalCell >= 0 ? octile(neighbour, goalCell) : 0;
+                openHeap.push_back({newCost + h, newCost, neighbour});
+                std::push_heap(openHeap.begin(), openHeap.end(), OpenEntryGreater());
+            }
+        }
+    }
+    return false;
+}
+
+bool HierarchicalPathfinder::refineSegment(int fromCell, int toCell, std::vector<int>& outCells) {
+    if (fromCell == toCell) {
+        return true;
+    }
+
+    const int width = grid->getWidth();
+    int fx = fromCell % width, fy = fromCell / width;
+    int tx = toCell % width, ty = toCell / width;
+
+    // Inter-cluster edge: the two cells are neighbours
+    if (std::abs(tx - fx) <= 1 && std::abs(ty - fy) <= 1
+        && grid->canStep(fx, fy, tx - fx, ty - fy)) {
+        outCells.push_back(toCell);
+        return true;
+    }
+
+    // Intra-cluster edge: search inside the cluster(s) of both ends
+    Bounds bounds = clusterBounds(clusterOf(fx, fy));
+    Bounds other = clusterBounds(clusterOf(tx, ty));
+    bounds.minX = std::min(bounds.minX, other.minX);
+    bounds.minY = std::min(bounds.minY, other.minY);
+    bounds.maxX = std::max(bounds.maxX, other.maxX);
+    bounds.maxY = std::max(bounds.maxY, other.maxY);
+
+    if (!boundedSearch(fromCell, toCell, bounds)) {
+        return false;
+    }
+
+    scratchCells.clear();
+    for (int cell = toCell; cell != fromCell; cell = cellParent[cell]) {
+        scratchCells.push_back(cell);
+    }
+    outCells.insert(outCells.end(), scratchCells.rbegin(), scratchCells.rend());
+    return true;
+}
+
+int HierarchicalPathfinder::octile(int cellA, int cellB) const {
+    const int width = grid->getWidth();
+    int dx = std::abs(cellA % width - cellB % width);
+    int dy = std::abs(cellA / width - cellB / width);
+    int diagonal = std::min(dx, dy);
+    return diagonal * DIAGONAL_COST + (std::max(dx, dy) - diagonal) * STRAIGHT_COST;
+}
+
+void HierarchicalPathfinder::nodeHeapPush(int id) {
+    nodeHeap.push_back(id);  // Reserved: at most one entry per node
+    nodeHeapSiftUp(static_cast<int>(nodeHeap.size()) - 1);
+}
+
+int HierarchicalPathfinder::nodeHeapPop() {
+    const int top = nodeHeap.front();
+    const int last = nodeHeap.back();
+    nodeHeap.pop_back();
+
+    const int count = static_cast<int>(nodeHeap.size());
+    if (count > 0) {
+        int position = 0;
+        while (true) {
+            int child = 2 * position + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && nodeBefore(nodeHeap[child + 1], nodeHeap[child])) {
+                child++;
+            }
+            if (!nodeBefore(nodeHeap[child], last)) {
+                break;
+            }
+            nodeHeap[position] = nodeHeap[child];
+            nodeHeapPosition[nodeHeap[position]] = position;
+            position = child;
+        }
+        nodeHeap[position] = last;
+        nodeHeapPosition[last] = position;
+    }
+    return top;
+}
+
+void HierarchicalPathfinder::nodeHeapSiftUp(int position) {
+    const int id = nodeHeap[position];
+    while (position > 0) {
+        const int up = (position - 1) / 2;
+        if (!nodeBefore(id, nodeHeap[up])) {
+            break;
+        }
+        nodeHeap[position] = nodeHeap[up];
+        nodeHeapPosition[nodeHeap[position]] = position;
+        position = up;
+    }
+    nodeHeap[position] = id;
+    nodeHeapPosition[id] = position;
+}
+
+void HierarchicalPathfinder::nextCellGeneration() {
+    cellGeneration++;
+    if (cellGeneration == 0) {
+        std::fill(cellOpen.begin(), cellOpen.end(), 0u);
+        std::fill(cellClosed.begin(), cellClosed.end(), 0u);
+        cellGeneration = 1;
+    }
+}
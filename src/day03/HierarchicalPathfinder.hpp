@@ -0,0 +1,313 @@
+#ifndef HIERARCHICALPATHFINDER_HPP
+#define HIERARCHICALPATHFINDER_HPP
+
+#include "NavGrid.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * HierarchicalPathfinder - HPA* (Hierarchical Path-Finding A*) for big maps
+ *
+ * On maps with thousands of cells per side, a flat grid search from an
+ * Enemy to a far target expands far too many cells. HPA* searches a much
+ * smaller ABSTRACT graph instead:
+ *
+ * 1. The grid is cut into square CLUSTERS (CLUSTER_SIZE cells per side)
+ * 2. Each cluster's walkable cells are split into COMPONENTS (connected
+ *    without leaving the cluster)
+ * 3. ENTRANCES: along each border between two clusters, the runs of
+ *    open cell pairs that join the same two components form ONE
+ *    entrance, however many decor cut it into fragments. An entrance
+ *    gets one transition in the middle of its widest run (two, at its
+ *    ends, if that run is wide). Each transition adds one abstract node
+ *    on each side, linked by an inter-cluster edge. So a cluster has at
+ *    most 2 nodes per entrance, usually 4 to 8.
+ * 4. Inside each cluster, abstract nodes are linked by intra-cluster
+ *    edges whose cost is the real shortest path cost within the cluster.
+ *    These are computed LAZILY: the first query that reaches a cluster
+ *    connects it, and it stays connected.
+ *
+ * A query links start and goal to the nodes of their clusters (one
+ * bounded Dijkstra each, kept in a small per-cell cache: many enemies
+ * share the same goal), runs A* on the abstract graph, then
+ * (optionally) refines each abstract edge into grid cells with a search
+ * bounded to one cluster.
+ *
+ * build() is O(cells) (components and borders only); when a Decor
+ * appears or disappears, onCellChanged() only recomputes the borders of
+ * the cluster containing the cell and disconnects it and its 4
+ * neighbours.
+ *
+ * Measured costs (campus_bench pathfinding, Release, 20% scattered
+ * obstacles and long walls; cold = first queries, connecting clusters):
+ *
+ *   map          build      abstract path (cold / warm)   full path   JPS
+ *   512x512      ~20 ms     ~5 ms / ~0.2 ms                ~0.4 ms     ~5.6 ms
+ *   2048x2048    ~0.3 s     ~34 ms / ~0.6 ms               ~1.5 ms     ~67 ms
+ *
+ * Paths are 7-9% longer than A* (merged transitions, weighted abstract
+ * heuristic), which is fine for AI.
+ */
+class HierarchicalPathfinder {
+public:
+    static constexpr int CLUSTER_SIZE = 16;          // Cells per cluster side
+    static constexpr int MAX_ENTRANCE_WIDTH = 6;     // Wider runs get 2 transitions
+    static constexpr size_t LINK_CACHE_SLOTS = 256;  // Start/goal links kept (direct-mapped)
+
+private:
+    static constexpr int STRAIGHT_COST = 10;
+    static constexpr int DIAGONAL_COST = 14;
+    static constexpr int ABSTRACT_WEIGHT_TENTHS = 12;  // Abstract A*: f = g + 1.2 h
+    static constexpr int LOCAL_CELLS = CLUSTER_SIZE * CLUSTER_SIZE;
+    static constexpr int LOCAL_BITS = 16;              // Heap key: cost << LOCAL_BITS | local cell
+    static_assert(LOCAL_CELLS <= (1 << LOCAL_BITS), "cluster too big for the local heap key");
+
+    struct AbstractEdge {
+        int to;      // Target node id
+        int cost;    // Path cost (10 per straight step, 14 per diagonal)
+    };
+
+    struct AbstractNode {
+        int cell;                         // Grid index
+        int cluster;                      // Cluster id
+        bool alive;
+        std::vector<AbstractEdge> edges;
+    };
+
+    struct OpenEntry {
+        int f;
+        int g;
+        int id;      // Cell (grid searches) or node (abstract search)
+    };
+
+    /**
+     * Cost from a start/goal cell to one node of its cluster
+     */
+    struct Link {
+        int node;
+        int cost;
+    };
+
+    /**
+     * Cached links of one cell (valid while 'version' == graphVersion)
+     */
+    struct LinkSlot {
+        int cell;
+        unsigned int version;
+        std::vector<Link> links;     // Keeps its capacity between cells
+    };
+
+    /**
+     * Rectangle of local cells (inclusive)
+     */
+    struct Bounds {
+        int minX, minY, maxX, maxY;
+        bool contains(int x, int y) const {
+            return x >= minX && x <= maxX && y >= minY && y <= maxY;
+        }
+    };
+
+    const NavGrid* grid;              // Abstracted grid (not owned)
+    int clustersX;                    // Number of cluster columns
+    int clustersY;                    // Number of cluster rows
+    bool built;
+
+    std::vector<AbstractNode> nodes;  // Node pool (dead nodes are recycled)
+    std::vector<int> freeNodes;
+    std::vector<std::vector<int>> clusterNodes;  // Node ids per cluster
+    std::vector<int> nodeAtCell;      // Node id per grid cell, or -1
+    std::vector<int> cellComponent;   // Component label per cell (unique over the map), -1 if blocked
+    std::vector<unsigned char> clusterConnected;  // Intra-cluster edges computed?
+    std::vector<int> componentQueue;  // Flood fill buffer
+    int nextComponent;
+
+    // ---- Pooled arrays for bounded grid searches ----
+    std::vector<int> cellCost;
+    std::vector<int> cellParent;
+    std::vector<unsigned int> cellOpen;
+    std::vector<unsigned int> cellClosed;
+    unsigned int cellGeneration;
+
+    // ---- Pooled arrays for the abstract search ----
+    std::vector<int> nodeCost;
+    std::vector<int> nodeF;           // Cost + weighted heuristic (heap order)
+    std::vector<int> nodeParent;
+    std::vector<int> nodeHeapPosition;  // Slot in nodeHeap of an open node
+    std::vector<unsigned int> nodeOpen;
+    std::vector<unsigned int> nodeClosed;
+    std::vector<unsigned int> nodeGoalMark;  // == nodeGeneration: nodeGoalCost is valid
+    std::vector<int> nodeGoalCost;    // Cost from the node to the goal cell
+    unsigned int nodeGeneration;
+
+    // ---- Start/goal links ----
+    std::vector<LinkSlot> linkCache;
+    unsigned int graphVersion;        // Bumped whenever nodes or components change
+
+    // ---- Cluster-local Dijkstra (connectCluster, cellLinks) ----
+    Bounds localBounds;               // Cluster loaded by loadCluster()
+    std::array<uint8_t, LOCAL_CELLS> localSteps;  // Bit n: neighbour n reachable in one step
+    std::array<int, LOCAL_CELLS> localCost;       // From the last localDijkstra start
+    std::vector<uint32_t> localHeap;
+
+    std::vector<OpenEntry> openHeap;  // Grid searches
+    std::vector<int> nodeHeap;        // Abstract search: indexed heap of open nodes, one slot per node
+    std::vector<int> scratchCells;    // Refinement buffer
+    std::vector<int> waypointCells;   // Abstract path buffer for findPath()
+
+    size_t lastExpanded;              // Abstract nodes closed by the last query
+    double buildMicros;               // Time of the last full build
+    double lastQueryMicros;           // Time of the last query
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * Constructor
+     * @param navGrid Grid to abstract (must outlive this object)
+     */
+    explicit HierarchicalPathfinder(const NavGrid& navGrid);
+
+
+    // ========== BUILDING ==========
+
+    /**
+     * Build the abstraction (components, entrances, inter-cluster edges)
+     * Call once when the level is loaded. One pass over the cells: the
+     * costly intra-cluster edges are left to the queries.
+     */
+    void build();
+
+    /**
+     * Update the abstraction after a cell's obstacle flag changed
+     * @param cx Local cell x
+     * @param cy Local cell y
+     *
+     * Only the cluster of the cell and its 4 neighbours are rebuilt.
+     */
+    void onCellChanged(int cx, int cy);
+
+    /**
+     * Check if build() has been called for the current grid size
+     */
+    bool isBuilt() const;
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Find the abstract path (waypoints) between two cells
+     * @param startCell Grid index of the start
+     * @param goalCell Grid index of the goal
+     * @param outWaypoints Output waypoint cells, start and goal included
+     * @return true if a path exists
+     *
+     * No grid cells are expanded except inside the start and goal
+     * clusters, but the abstract graph still grows with the map: about
+     * 1-2 ms at 512x512 and 14-26 ms at 2048x2048 (most of findPath).
+     */
+    bool findAbstractPath(int startCell, int goalCell, std::vector<int>& outWaypoints);
+
+    /**
+     * Find a full cell-by-cell path (abstract path + refinement)
+     * @param startCell Grid index of the start
+     * @param goalCell Grid index of the goal
+     * @param outCells Output path, every cell from start to goal (inclusive)
+     * @return true if a path exists
+     */
+    bool findPath(int startCell, int goalCell, std::vector<int>& outCells);
+
+
+    // ========== METRICS ==========
+
+    size_t getNodeCount() const;
+    size_t getEdgeCount() const;         // Edges built so far (grows as clusters connect)
+    size_t getConnectedClusterCount() const;
+    double getBuildMicros() const;
+    double getLastQueryMicros() const;
+    size_t getLastExpanded() const;
+
+private:
+    // ========== PRIVATE HELPERS ==========
+
+    int clusterOf(int x, int y) const;
+    Bounds clusterBounds(int cluster) const;
+
+    /**
+     * Label the components of one cluster (flood fill, same moves as
+     * the grid searches)
+     */
+    void labelComponents(int cluster);
+
+    /**
+     * Create the transitions between two adjacent clusters
+     * @param clusterA Left (vertical border) or bottom (horizontal border) cluster
+     * @param clusterB Right or top cluster
+     * @param vertical true for a left/right border, false for bottom/top
+     */
+    void buildBorder(int clusterA, int clusterB, bool vertical);
+
+    /**
+     * Recompute the intra-cluster edges of one cluster
+     */
+    void connectCluster(int cluster);
+
+    /**
+     * Precompute the steps allowed inside a cluster (canStep, bounds)
+     */
+    void loadCluster(int cluster);
+
+    /**
+     * Dijkstra from a cell of the loaded cluster over its local cells
+     * into localCost (UNREACHED where the cluster does not connect)
+     */
+    void localDijkstra(int startCell);
+
+    int localIndex(int cell) const {
+        const int width = grid->getWidth();
+        return (cell / width - localBounds.minY) * CLUSTER_SIZE + (cell % width - localBounds.minX);
+    }
+
+    /**
+     * Cost from a cell to every node of its cluster it can reach inside
+     * the cluster (cached per cell)
+     * @return Valid until the next call
+     */
+    const std::vector<Link>& cellLinks(int cell, int cluster);
+
+    int getOrCreateNode(int cell, int cluster);
+    void removeNode(int id);
+    void addEdge(int from, int to, int cost);
+    void removeEdgesTo(int from, int targetCluster);
+
+    /**
+     * Grid search restricted to a rectangle
+     * @param goalCell Target cell, or -1 to explore everything (Dijkstra)
+     * @return true if goalCell was reached (always false for -1)
+     *
+     * Results are read from cellCost / cellParent / cellClosed.
+     */
+    bool boundedSearch(int startCell, int goalCell, const Bounds& bounds);
+
+    /**
+     * Append the refined path from 'fromCell' to 'toCell' (excluding fromCell)
+     */
+    bool refineSegment(int fromCell, int toCell, std::vector<int>& outCells);
+
+    int octile(int cellA, int cellB) const;
+    void nextCellGeneration();
+
+    // ---- Abstract open set (smallest nodeF on top, then deeper cost) ----
+
+    bool nodeBefore(int idA, int idB) const {
+        if (nodeF[idA] != nodeF[idB]) return nodeF[idA] < nodeF[idB];
+        return nodeCost[idA] > nodeCost[idB];
+    }
+
+    void nodeHeapPush(int id);
+    int nodeHeapPop();
+    void nodeHeapSiftUp(int position);
+};
+
+#endif // HIERARCHICALPATHFINDER_HPP
@@ -0,0 +1,200 @@
+#include "InfluenceMap.hpp"
+#include <algorithm>
+#include <cmath>
+
+// ========== CONSTRUCTOR ==========
+
+/**
+ * Kernels only depend on the radius: compute them all once
+ *
+ * weight(d) = 1 - d / (radius + 1) for d <= radius, 0 beyond
+ * (d = Euclidean distance in cells), so the center is always 1.0 and
+ * the ring at 'radius' still receives a little influence.
+ */
+InfluenceMap::InfluenceMap()
+    : grid(nullptr)
+{
+    kernels.resize(MAX_KERNEL_RADIUS + 1);
+    for (int r = 0; r <= MAX_KERNEL_RADIUS; r++) {
+        Kernel& kernel = kernels[r];
+        kernel.radius = r;
+        int side = 2 * r + 1;
+        kernel.weights.assign(side * side, 0);
+        for (int ky = -r; ky <= r; ky++) {
+            for (int kx = -r; kx <= r; kx++) {
+                double d = std::sqrt(static_cast<double>(kx * kx + ky * ky));
+                if (d <= r) {
+                    double weight = 1.0 - d / (r + 1);
+                    kernel.weights[(ky + r) * side + (kx + r)] =
+                        static_cast<int>(weight * WEIGHT_SCALE + 0.5);
+                }
+            }
+        }
+    }
+}
+
+
+// ========== BUILDING ==========
+
+void InfluenceMap::build(const NavGrid& navGrid) {
+    grid = &navGrid;
+
+    const size_t cellCount = navGrid.getCellCount();
+    for (std::vector<int>& layer : layers) {
+        layer.assign(cellCount, 0);
+    }
+    sources.clear();
+    freeSources.clear();
+
+    // Static cover: every obstacle protects the cells around it
+    std::vector<int>& cover = layerOf(InfluenceLayer::COVER);
+    for (int cy = 0; cy < navGrid.getHeight(); cy++) {
+        for (int cx = 0; cx < navGrid.getWidth(); cx++) {
+            if (navGrid.isBlocked(cx, cy)) {
+                stamp(cover, cx, cy, COVER_RADIUS, 1, 1);
+            }
+        }
+    }
+}
+
+void InfluenceMap::onCellChanged(int cx, int cy, bool nowBlocked) {
+    if (!grid || !grid->inBounds(cx, cy)) {
+        return;
+    }
+    stamp(layerOf(InfluenceLayer::COVER), cx, cy, COVER_RADIUS, 1, nowBlocked ? 1 : -1);
+}
+
+
+// ========== SOURCES ==========
+
+int InfluenceMap::addSource(InfluenceLayer layer, int strength) {
+    int handle;
+    if (!freeSources.empty()) {
+        handle = freeSources.back();
+        freeSources.pop_back();
+    } else {
+        handle = static_cast<int>(sources.size());
+        sources.emplace_back();
+        freeSources.reserve(sources.size());  // removeSource never allocates
+    }
+
+    Source& source = sources[handle];
+    source.layer = layer;
+    source.strength = strength;
+    source.radius = 0;
+    source.cellX = 0;
+    source.cellY = 0;
+    source.stamped = false;
+    source.alive = true;
+    return handle;
+}
+
+/**
+ * Dirty update: only a source whose cell or radius changed pays for
+ * an unstamp + stamp (2 kernels). A still source costs nothing.
+ */
+void InfluenceMap::moveSource(int handle, double x, double y, int radius) {
+    if (!grid || handle < 0 || handle >= static_cast<int>(sources.size())) {
+        return;
+    }
+    Source& source = sources[handle];
+    if (!source.alive) {
+        return;
+    }
+
+    radius = std::max(0, std::min(radius, MAX_KERNEL_RADIUS));
+
+    // Same conversion as NavGrid::worldToCell, but the cell may lie off
+    // the map (the kernel is then clipped)
+    int cx = static_cast<int>(std::floor(x + 0.5)) - grid->getOriginX();
+    int cy = static_cast<int>(std::floor(y + 0.5)) - grid->getOriginY();
+
+    if (source.stamped && source.cellX == cx && source.cellY == cy && source.radius == radius) {
+        return;
+    }
+
+    std::vector<int>& layer = layerOf(source.layer);
+    if (source.stamped) {
+        stamp(layer, source.cellX, source.cellY, source.radius, source.strength, -1);
+    }
+    stamp(layer, cx, cy, radius, source.strength, 1);
+
+    source.cellX = cx;
+    source.cellY = cy;
+    source.radius = radius;
+    source.stamped = true;
+}
+
+void InfluenceMap::removeSource(int handle) {
+    if (handle < 0 || handle >= static_cast<int>(sources.size())) {
+        return;
+    }
+    Source& source = sources[handle];
+    if (!source.alive) {
+        return;
+    }
+    if (source.stamped) {
+        stamp(layerOf(source.layer), source.cellX, source.cellY, source.radius, source.strength, -1);
+    }
+    source.stamped = false;
+    source.alive = false;
+    freeSources.push_back(handle);
+}
+
+
+// ========== QUERIES ==========
+
+double InfluenceMap::sample(InfluenceLayer layer, double x, double y) const {
+    if (!grid) {
+        return 0.0;
+    }
+    int cx, cy;
+    if (!grid->worldToCell(x, y, cx, cy)) {
+        return 0.0;
+    }
+    return sampleCell(layer, cx, cy);
+}
+
+double InfluenceMap::sampleCell(InfluenceLayer layer, int cx, int cy) const {
+    if (!grid || !grid->inBounds(cx, cy)) {
+        return 0.0;
+    }
+    const std::vector<int>& values = layerOf(layer);
+    return static_cast<double>(values[grid->index(cx, cy)]) / WEIGHT_SCALE;
+}
+
+const NavGrid* InfluenceMap::getGrid() const {
+    return grid;
+}
+
+
+// ========== PRIVATE HELPERS ==========
+
+/**
+ * Kernel stamp, clipped to the map
+ * Rows are contiguous in both the kernel and the layer, so the inner
+ * loop is a plain multiply-add over two arrays.
+ */
+void InfluenceMap::stamp(std::vector<int>& layer, int cx, int cy, int radius, int strength, int sign) {
+    const Kernel& kernel = kernels[radius];
+    const int side = 2 * radius + 1;
+    const int width = grid->getWidth();
+    const int height = grid->getHeight();
+    const int factor = strength * sign;
+
+    int minX = std::max(cx - radius, 0);
+    int maxX = std::min(cx + radius, width - 1);
+    int minY = std::max(cy - radius, 0);
+    int maxY = std::min(cy + radius, height - 1);
+    if (minX > maxX || minY > maxY) {
+        return;  // Entirely off the map
+    }
+
+    for (int y = minY; y <= maxY; y++) {
+        int* row = layer.data() + y * width;
+        const int* weights = kernel.weights.data() + (y - cy + radius) * side + (minX - cx + radius);
+        for (int x = minX; x <= maxX; x++) {
+            row[x] += weights[x - minX] * factor;
+        }
+    }
+}
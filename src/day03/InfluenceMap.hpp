@@ -0,0 +1,165 @@
+#ifndef INFLUENCEMAP_HPP
+#define INFLUENCEMAP_HPP
+
+#include "NavGrid.hpp"
+#include <vector>
+
+/**
+ * InfluenceLayer - The tactical information stored per cell
+ */
+enum class InfluenceLayer {
+    THREAT,     // Player danger (radius = current weapon range)
+    DENSITY,    // Enemy presence (how crowded an area is)
+    COVER,      // Protection offered by nearby Decor
+    COUNT
+};
+
+/**
+ * InfluenceMap - Tiled tactical map for enemy decisions
+ *
+ * Each layer is a grid (same cells as the NavGrid) where SOURCES add a
+ * precomputed KERNEL: a small square of weights that fall off linearly
+ * with distance from the source cell.
+ *
+ * Incremental update (cost proportional to what moved):
+ * - Every source remembers where and how it was last stamped
+ * - moveSource() with the same cell and radius does nothing
+ * - Otherwise the old stamp is subtracted and the new one added:
+ *   O(radius^2) work, whatever the map size
+ * - Values are fixed point integers (WEIGHT_SCALE = 1.0), so stamping
+ *   then unstamping restores exactly the previous values
+ *
+ * Cover is stamped once from the Decor obstacles (build) and patched
+ * with onCellChanged().
+ *
+ * Sources and kernels are allocated at setup: per-turn updates do not
+ * touch the heap.
+ */
+class InfluenceMap {
+public:
+    static constexpr int WEIGHT_SCALE = 256;      // Fixed point: 256 = 1.0
+    static constexpr int MAX_KERNEL_RADIUS = 16;  // Larger radii are clamped
+    static constexpr int COVER_RADIUS = 1;        // Decor protects adjacent cells
+
+private:
+    /**
+     * Precomputed (2r+1)^2 weights for one radius
+     */
+    struct Kernel {
+        int radius;
+        std::vector<int> weights;  // Row-major, WEIGHT_SCALE at the center
+    };
+
+    /**
+     * One moving emitter (player, enemy)
+     */
+    struct Source {
+        InfluenceLayer layer;
+        int strength;      // Multiplier applied to the kernel weights
+        int radius;        // Current kernel radius
+        int cellX;         // Local cell where it is stamped
+        int cellY;
+        bool stamped;      // false: not on the map (removed or never placed)
+        bool alive;        // false: slot free for reuse
+    };
+
+    const NavGrid* grid;                   // Geometry + cover obstacles (not owned)
+    std::vector<int> layers[static_cast<int>(InfluenceLayer::COUNT)];
+    std::vector<Kernel> kernels;           // One per radius 0..MAX_KERNEL_RADIUS
+    std::vector<Source> sources;
+    std::vector<int> freeSources;
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * Default constructor - empty map (every sample returns 0)
+     */
+    InfluenceMap();
+
+
+    // ========== BUILDING ==========
+
+    /**
+     * Size the layers on a grid and stamp the static cover
+     * @param navGrid Grid giving the cells and the Decor obstacles
+     *                (must outlive the map)
+     *
+     * Removes every source.
+     */
+    void build(const NavGrid& navGrid);
+
+    /**
+     * Patch the cover layer after an obstacle appeared or disappeared
+     * @param cx Local cell x
+     * @param cy Local cell y
+     * @param nowBlocked New obstacle state of the cell
+     */
+    void onCellChanged(int cx, int cy, bool nowBlocked);
+
+
+    // ========== SOURCES ==========
+
+    /**
+     * Register a new emitter (not stamped until moveSource is called)
+     * @param layer Layer the source writes to
+     * @param strength Kernel multiplier (1 = one unit at the center)
+     * @return Handle used by the other source methods
+     */
+    int addSource(InfluenceLayer layer, int strength);
+
+    /**
+     * Move and/or resize a source
+     * @param handle Source handle from addSource
+     * @param x World x
+     * @param y World y
+     * @param radius Kernel radius in cells (clamped to MAX_KERNEL_RADIUS)
+     *
+     * No work at all if the cell and the radius did not change.
+     */
+    void moveSource(int handle, double x, double y, int radius);
+
+    /**
+     * Remove a source and erase its stamp
+     */
+    void removeSource(int handle);
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Sample a layer at a world position
+     * @return Influence value (1.0 = one full-strength source center),
+     *         0 outside the map
+     */
+    double sample(InfluenceLayer layer, double x, double y) const;
+
+    /**
+     * Sample a layer at a local cell
+     */
+    double sampleCell(InfluenceLayer layer, int cx, int cy) const;
+
+    /**
+     * Grid the map is laid on (nullptr before build)
+     */
+    const NavGrid* getGrid() const;
+
+private:
+    // ========== PRIVATE HELPERS ==========
+
+    /**
+     * Add (sign = 1) or subtract (sign = -1) a kernel centered on a cell
+     * Cells outside the map are clipped.
+     */
+    void stamp(std::vector<int>& layer, int cx, int cy, int radius, int strength, int sign);
+
+    std::vector<int>& layerOf(InfluenceLayer layer) {
+        return layers[static_cast<int>(layer)];
+    }
+
+    const std::vector<int>& layerOf(InfluenceLayer layer) const {
+        return layers[static_cast<int>(layer)];
+    }
+};
+
+#endif // INFLUENCEMAP_HPP
@@ -0,0 +1,285 @@
+#include "JumpPointSearch.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+    const int NEIGHBOUR_DX[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+    const int NEIGHBOUR_DY[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+
+    struct OpenEntryGreater {
+        template<typename Entry>
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (a.f != b.f) return a.f > b.f;
+            return a.g < b.g;
+        }
+    };
+
+    int sign(int value) {
+        return (value > 0) - (value < 0);
+    }
+}
+
+// ========== CONSTRUCTOR ==========
+
+JumpPointSearch::JumpPointSearch(const NavGrid& navGrid)
+    : grid(&navGrid),
+      generation(0),
+      lastExpanded(0),
+      boundsMinX(0), boundsMinY(0), boundsMaxX(0), boundsMaxY(0)
+{
+}
+
+void JumpPointSearch::reserve() {
+    const size_t cellCount = grid->getCellCount();
+    if (gCost.size() == cellCount) {
+        return;
+    }
+    gCost.assign(cellCount, 0);
+    parent.assign(cellCount, -1);
+    openMark.assign(cellCount, 0u);
+    closedMark.assign(cellCount, 0u);
+    openHeap.reserve(cellCount);
+    generation = 0;
+}
+
+
+// ========== QUERIES ==========
+
+/**
+ * JPS main loop
+ *
+ * Same as A*, except that successors are not the 8 neighbours but the
+ * jump points reached by scanning in each "natural" direction (the
+ * directions that can't be reached more cheaply through the parent).
+ */
+bool JumpPointSearch::findPath(int startCell, int goalCell, std::vector<int>& outCells) {
+    outCells.clear();
+    lastExpanded = 0;
+
+    const int cellCount = static_cast<int>(grid->getCellCount());  // Fits: NavGrid::MAX_CELLS
+    if (startCell < 0 || goalCell < 0 || startCell >= cellCount || goalCell >= cellCount) {
+        return false;
+    }
+
+    if (gCost.size() != static_cast<size_t>(cellCount)) {
+        reserve();
+    }
+    generation++;
+    if (generation == 0) {
+        std::fill(openMark.begin(), openMark.end(), 0u);
+        std::fill(closedMark.begin(), closedMark.end(), 0u);
+        generation = 1;
+    }
+
+    const int width = grid->getWidth();
+    const int goalX = goalCell % width;
+    const int goalY = goalCell / width;
+    boundsMinX = boundsMaxX = startCell % width;
+    boundsMinY = boundsMaxY = startCell / width;
+
+    openHeap.clear();
+    gCost[startCell] = 0;
+    parent[startCell] = -1;
+    openMark[startCell] = generation;
+    openHeap.push_back({octile(startCell, goalCell), 0, startCell});
+
+    bool found = false;
+    while (!openHeap.empty()) {
+        std::pop_heap(openHeap.begin(), openHeap.end(), OpenEntryGreater());
+        OpenEntry current = openHeap.back();
+        openHeap.pop_back();
+
+        if (closedMark[current.cell] == generation || current.g != gCost[current.cell]) {
+            continue;
+        }
+        closedMark[current.cell] = generation;
+        lastExpanded++;
+
+        if (current.cell == goalCell) {
+            found = true;
+            break;
+        }
+
+        int x = current.cell % width;
+        int y = current.cell / width;
+
+        if (parent[current.cell] == -1) {
+            // Start node: every direction is natural
+            for (int n = 0; n < 8; n++) {
+                if (grid->canStep(x, y, NEIGHBOUR_DX[n], NEIGHBOUR_DY[n])) {
+                    int jumpPoint = jump(x + NEIGHBOUR_DX[n], y + NEIGHBOUR_DY[n],
+                                         NEIGHBOUR_DX[n], NEIGHBOUR_DY[n], goalX, goalY);
+                    if (jumpPoint != -1) relax(current.cell, jumpPoint, goalCell);
+                }
+            }
+            continue;
+        }
+
+        // Direction we arrived from
+        int dx = sign(x - parent[current.cell] % width);
+        int dy = sign(y - parent[current.cell] / width);
+
+        // Pruned neighbours (no corner cutting variant)
+        int succX[5], succY[5];
+        int count = 0;
+        if (dx != 0 && dy != 0) {
+            bool walkX = walkable(x + dx, y);
+            bool walkY = walkable(x, y + dy);
+            if (walkY) { succX[count] = 0; succY[count] = dy; count++; }
+            if (walkX) { succX[count] = dx; succY[count] = 0; count++; }
+            if (walkX && walkY) { succX[count] = dx; succY[count] = dy; count++; }
+        } else if (dx != 0) {
+            bool next = walkable(x + dx, y);
+            bool up = walkable(x, y + 1);
+            bool down = walkable(x, y - 1);
+            if (next) {
+                succX[count] = dx; succY[count] = 0; count++;
+                if (up) { succX[count] = dx; succY[count] = 1; count++; }
+                if (down) { succX[count] = dx; succY[count] = -1; count++; }
+            }
+            if (up) { succX[count] = 0; succY[count] = 1; count++; }
+            if (down) { succX[count] = 0; succY[count] = -1; count++; }
+        } else {
+            bool next = walkable(x, y + dy);
+            bool right = walkable(x + 1, y);
+            bool left = walkable(x - 1, y);
+            if (next) {
+                succX[count] = 0; succY[count] = dy; count++;
+                if (right) { succX[count] = 1; succY[count] = dy; count++; }
+                if (left) { succX[count] = -1; succY[count] = dy; count++; }
+            }
+            if (right) { succX[count] = 1; succY[count] = 0; count++; }
+            if (left) { succX[count] = -1; succY[count] = 0; count++; }
+        }
+
+        for (int i = 0; i < count; i++) {
+            int jumpPoint = jump(x + succX[i], y + succY[i], succX[i], succY[i], goalX, goalY);
+            if (jumpPoint != -1) relax(current.cell, jumpPoint, goalCell);
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    // ---- Expand jump points into single steps (goal -> start) ----
+    for (int cell = goalCell; parent[cell] != -1; cell = parent[cell]) {
+        int fromX = parent[cell] % width, fromY = parent[cell] / width;
+        int x = cell % width, y = cell / width;
+        int stepX = sign(fromX - x), stepY = sign(fromY - y);
+        while (x != fromX || y != fromY) {
+            outCells.push_back(grid->index(x, y));
+            x += stepX;
+            y += stepY;
+        }
+    }
+    outCells.push_back(startCell);
+    std::reverse(outCells.begin(), outCells.end());
+    return true;
+}
+
+size_t JumpPointSearch::getLastExpanded() const {
+    return lastExpanded;
+}
+
+void JumpPointSearch::getLastBounds(int& minX, int& minY, int& maxX, int& maxY) const {
+    minX = boundsMinX;
+    minY = boundsMinY;
+    maxX = boundsMaxX;
+    maxY = boundsMaxY;
+}
+
+
+// ========== PRIVATE HELPERS ==========
+
+/**
+ * Scan from (x, y) in direction (dx, dy)
+ *
+ * Straight scan: stop at the goal or at a cell with a forced neighbour.
+ * Diagonal scan: at each cell, also run the two straight scans; if one
+ * of them finds something, this diagonal cell is a jump point.
+ * Iterative (no recursion) so that long runs on big maps are safe.
+ */
+int JumpPointSearch::jump(int x, int y, int dx, int dy, int goalX, int goalY) {
+    while (true) {
+        if (!walkable(x, y)) {
+            return -1;
+        }
+        touch(x, y);
+
+        if (x == goalX && y == goalY) {
+            return grid->index(x, y);
+        }
+
+        if (dx != 0 && dy != 0) {
+            // Straight sub-scans along both components
+            for (int axis = 0; axis < 2; axis++) {
+                int sdx = (axis == 0) ? dx : 0;
+                int sdy = (axis == 0) ? 0 : dy;
+                int sx = x + sdx, sy = y + sdy;
+                while (walkable(sx, sy)) {
+                    touch(sx, sy);
+                    if ((sx == goalX && sy == goalY) || hasForcedNeighbour(sx, sy, sdx, sdy)) {
+                        return grid->index(x, y);
+                    }
+                    sx += sdx;
+                    sy += sdy;
+                }
+            }
+            // No corner cutting: both sides must be open to keep going
+            if (!walkable(x + dx, y) || !walkable(x, y + dy)) {
+                return -1;
+            }
+        } else if (hasForcedNeighbour(x, y, dx, dy)) {
+            return grid->index(x, y);
+        }
+
+        x += dx;
+        y += dy;
+    }
+}
+
+/**
+ * Forced neighbours for straight moves (no corner cutting)
+ *
+ * Moving along x: a side cell is forced when it is open but the cell
+ * behind it (diagonally back) is blocked - the optimal path to it must
+ * turn here.
+ */
+bool JumpPointSearch::hasForcedNeighbour(int x, int y, int dx, int dy) const {
+    if (dx != 0) {
+        return (walkable(x, y - 1) && !walkable(x - dx, y - 1))
+            || (walkable(x, y + 1) && !walkable(x - dx, y + 1));
+    }
+    return (walkable(x - 1, y) && !walkable(x - 1, y - dy))
+        || (walkable(x + 1, y) && !walkable(x + 1, y - dy));
+}
+
+void JumpPointSearch::relax(int fromCell, int toCell, int goalCell) {
+    if (closedMark[toCell] == generation) {
+        return;
+    }
+    int newCost = gCost[fromCell] + octile(fromCell, toCell);
+    if (openMark[toCell] != generation || newCost < gCost[toCell]) {
+        openMark[toCell] = generation;
+        gCost[toCell] = newCost;
+        parent[toCell] = fromCell;
+        openHeap.push_back({newCost + octile(toCell, goalCell), newCost, toCell});
+        std::push_heap(openHeap.begin(), openHeap.end(), OpenEntryGreater());
+    }
+}
+
+int JumpPointSearch::octile(int cellA, int cellB) const {
+    const int width = grid->getWidth();
+    int dx = std::abs(cellA % width - cellB % width);
+    int dy = std::abs(cellA / width - cellB / width);
+    int diagonal = std::min(dx, dy);
+    return diagonal * DIAGONAL_COST + (std::max(dx, dy) - diagonal) * STRAIGHT_COST;
+}
+
+void JumpPointSearch::touch(int x, int y) {
+    boundsMinX = std::min(boundsMinX, x);
+    boundsMaxX = std::max(boundsMaxX, x);
+    boundsMinY = std::min(boundsMinY, y);
+    boundsMaxY = std::max(boundsMaxY, y);
+}
@@ -0,0 +1,128 @@
+#ifndef JUMPPOINTSEARCH_HPP
+#define JUMPPOINTSEARCH_HPP
+
+#include "NavGrid.hpp"
+#include <cstddef>
+#include <vector>
+
+/**
+ * JumpPointSearch - A* variant for uniform-cost grids
+ *
+ * On a grid where every walkable cell costs the same (our NavGrid),
+ * most A* work is wasted on symmetric paths. Jump Point Search (JPS)
+ * only puts "jump points" in the open set: cells where a path may have
+ * to turn because of an obstacle (a "forced neighbour"). Long straight
+ * and diagonal runs are scanned without touching the heap.
+ *
+ * Same movement rules as the rest of the pathfinding code:
+ * - 8 neighbours, straight cost 10, diagonal cost 14
+ * - no corner cutting (NavGrid::canStep)
+ * so the paths found are optimal and have the same cost as plain A*.
+ *
+ * Node arrays and the open heap are pooled between queries (generation
+ * counter, no clearing).
+ */
+class JumpPointSearch {
+private:
+    static constexpr int STRAIGHT_COST = 10;
+    static constexpr int DIAGONAL_COST = 14;
+
+    struct OpenEntry {
+        int f;
+        int g;
+        int cell;
+    };
+
+    const NavGrid* grid;         // Searched grid (not owned)
+
+    // ---- Pooled node arrays ----
+    std::vector<int> gCost;
+    std::vector<int> parent;
+    std::vector<unsigned int> openMark;
+    std::vector<unsigned int> closedMark;
+    std::vector<OpenEntry> openHeap;
+    unsigned int generation;
+
+    // ---- Last search info ----
+    size_t lastExpanded;         // Jump points closed by the last search
+    int boundsMinX, boundsMinY;  // Cells scanned by the last search
+    int boundsMaxX, boundsMaxY;
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * Constructor
+     * @param navGrid Grid to search (must outlive this object)
+     */
+    explicit JumpPointSearch(const NavGrid& navGrid);
+
+    /**
+     * Size the node pools for the grid (and the heap for one entry per
+     * cell) now instead of on the first query
+     */
+    void reserve();
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Find a path between two local cells
+     * @param startCell Grid index of the start
+     * @param goalCell Grid index of the goal
+     * @param outCells Output path, every cell from start to goal (inclusive)
+     * @return true if a path exists
+     *
+     * The jump points are expanded back into single steps, so the output
+     * can be followed one cell at a time like an A* path.
+     */
+    bool findPath(int startCell, int goalCell, std::vector<int>& outCells);
+
+    /**
+     * Number of jump points closed by the last search
+     */
+    size_t getLastExpanded() const;
+
+    /**
+     * Bounding box (local cells) of everything the last search looked at
+     *
+     * Used by Pathfinder to limit cache invalidation to that area.
+     */
+    void getLastBounds(int& minX, int& minY, int& maxX, int& maxY) const;
+
+private:
+    // ========== PRIVATE HELPERS ==========
+
+    /**
+     * Walk from (x, y) in direction (dx, dy) until a jump point is found
+     * @return Grid index of the jump point, or -1 if the run hits a wall
+     */
+    int jump(int x, int y, int dx, int dy, int goalX, int goalY);
+
+    /**
+     * Check if a straight run (dx or dy is 0) reaches a jump point
+     * @return true if (x, y) is a jump point for that direction
+     */
+    bool hasForcedNeighbour(int x, int y, int dx, int dy) const;
+
+    /**
+     * Push a successor into the open set if it improves its cost
+     */
+    void relax(int fromCell, int toCell, int goalCell);
+
+    /**
+     * Octile distance between two cells (exact on an empty grid)
+     */
+    int octile(int cellA, int cellB) const;
+
+    /**
+     * Grow the scanned bounding box
+     */
+    void touch(int x, int y);
+
+    bool walkable(int x, int y) const {
+        return !grid->isBlocked(x, y);
+    }
+};
+
+#endif // JUMPPOINTSEARCH_HPP
@@ -0,0 +1,124 @@
+#ifndef MPSCQUEUE_HPP
+#define MPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * MpscQueue - Bounded lock-free queue, many producers, one consumer
+ *
+ * A ring of cells, each with a sequence number (Dmitry Vyukov's bounded
+ * queue, single-consumer side):
+ *
+ * - push() (any thread): claim the tail slot with one compare-exchange,
+ *   write the value, then publish it by bumping the cell's sequence
+ *   (release). No lock, no allocation.
+ * - pop() (one thread only): a cell is ready when its sequence says
+ *   "written for this lap" (acquire); read it and hand the cell back to
+ *   the producers for the next lap.
+ *
+ * Full queue: push() returns false (the caller counts the drop), it
+ * never blocks and never grows. Size it with reserve() at setup.
+ *
+ * T should be a small trivially copyable record (events, commands).
+ */
+template<typename T>
+class MpscQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;                       // capacity - 1 (power of two)
+    alignas(64) std::atomic<size_t> tail;  // Next slot to claim (producers)
+    alignas(64) size_t head;           // Next slot to read (consumer only)
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    MpscQueue() : mask(0), tail(0), head(0) {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * Allocate the ring (rounded up to a power of two, at least 2)
+     * Not thread-safe: call at setup, before any push/pop. Drops any
+     * queued value.
+     */
+    void reserve(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        mask = size - 1;
+        tail.store(0, std::memory_order_relaxed);
+        head = 0;
+    }
+
+    size_t capacity() const {
+        return cells ? mask + 1 : 0;
+    }
+
+
+    // ========== PRODUCERS (any thread) ==========
+
+    /**
+     * @return false if the queue is full (or was never reserved)
+     */
+    bool push(const T& value) {
+        if (!cells) {
+            return false;
+        }
+        size_t position = tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[position & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            // Signed lap difference: 0 = free for us, < 0 = still full
+            // from the previous lap, > 0 = another producer took it
+            std::ptrdiff_t lap = static_cast<std::ptrdiff_t>(sequence - position);
+            if (lap == 0) {
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS failure reloaded 'position', retry
+            } else if (lap < 0) {
+                return false;
+            } else {
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+
+    // ========== CONSUMER (one thread) ==========
+
+    /**
+     * @return false if no value is ready
+     */
+    bool pop(T& value) {
+        if (!cells) {
+            return false;
+        }
+        Cell& cell = cells[head & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != head + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(head + mask + 1, std::memory_order_release);
+        head++;
+        return true;
+    }
+};
+
+#endif // MPSCQUEUE_HPP
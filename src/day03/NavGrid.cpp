@@ -0,0 +1,124 @@
+#include "NavGrid.hpp"
+#include "GameManager.hpp"
+#include "Decor.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+// ========== CONSTRUCTORS ==========
+
+NavGrid::NavGrid() : originX(0), originY(0), width(0), height(0), version(0) {
+    // Empty grid: every cell is out of bounds
+}
+
+NavGrid::NavGrid(int originX, int originY, int width, int height)
+    : originX(originX),
+      originY(originY),
+      width(std::max(width, 0)),
+      height(std::max(height, 0)),
+      version(0)
+{
+    if (getCellCount() > MAX_CELLS) {
+        throw std::invalid_argument("NavGrid: more than NavGrid::MAX_CELLS cells");
+    }
+    blocked.assign(getCellCount(), 0);
+}
+
+
+// ========== BUILDING ==========
+
+/**
+ * Build the grid from the current level
+ *
+ * 1. Compute the bounding box of all objects (in cells)
+ * 2. Grow it by 'margin' cells on each side, and check the size
+ *    (in double: far apart objects would overflow int)
+ * 3. Mark the cell of every Decor as blocked
+ *
+ * Characters are NOT obstacles here: they move every turn and are
+ * handled by the collision system (GameManager::canMoveTo).
+ */
+void NavGrid::buildFrom(const GameManager& manager, int margin) {
+    // One pass over the objects (no copy of the positions)
+    // floor(x + 0.5) is monotonic: the cell of the min is the min of the cells
+    double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+    if (manager.size() > 0) {
+        double lowX = manager.getObject(0)->getX(), highX = lowX;
+        double lowY = manager.getObject(0)->getY(), highY = lowY;
+        for (size_t i = 1; i < manager.size(); i++) {
+            const GameObject* object = manager.getObject(i);
+            lowX = std::min(lowX, object->getX());
+            lowY = std::min(lowY, object->getY());
+            highX = std::max(highX, object->getX());
+            highY = std::max(highY, object->getY());
+        }
+        minX = std::floor(lowX + 0.5);
+        minY = std::floor(lowY + 0.5);
+        maxX = std::floor(highX + 0.5);
+        maxY = std::floor(highY + 0.5);
+    }
+
+    const double columns = (maxX - minX) + 2.0 * margin + 1.0;
+    const double rows = (maxY - minY) + 2.0 * margin + 1.0;
+    if (columns * rows > static_cast<double>(MAX_CELLS)) {
+        char message[160];
+        std::snprintf(message, sizeof(message),
+                      "navigation grid: objects span %.0f x %.0f cells (limit: %zu cells)",
+                      columns, rows, size_t(MAX_CELLS));
+        throw std::runtime_error(message);
+    }
+    if (minX - margin < INT_MIN || maxX + margin > INT_MAX
+        || minY - margin < INT_MIN || maxY + margin > INT_MAX) {
+        throw std::runtime_error("navigation grid: objects lie beyond the int cell range");
+    }
+
+    originX = static_cast<int>(minX) - margin;
+    originY = static_cast<int>(minY) - margin;
+    width = static_cast<int>(columns);
+    height = static_cast<int>(rows);
+    blocked.assign(getCellCount(), 0);
+
+    for (size_t i = 0; i < manager.size(); i++) {
+        if (const Decor* decor = dynamic_cast<const Decor*>(manager.getObject(i))) {
+            int cx, cy;
+            if (worldToCell(decor->getX(), decor->getY(), cx, cy)) {
+                blocked[index(cx, cy)] = 1;
+            }
+        }
+    }
+
+    version++;
+}
+
+void NavGrid::clear() {
+    std::fill(blocked.begin(), blocked.end(), 0);
+    version++;
+}
+
+void NavGrid::setBlocked(int cx, int cy, bool isBlocked) {
+    if (!inBounds(cx, cy)) {
+        return;
+    }
+    unsigned char value = isBlocked ? 1 : 0;
+    if (blocked[index(cx, cy)] != value) {
+        blocked[index(cx, cy)] = value;
+        version++;
+    }
+}
+
+
+// ========== QUERIES ==========
+
+/**
+ * World -> cell conversion
+ *
+ * Cells are centered on integer coordinates, so we round to the
+ * nearest integer (floor(x + 0.5)) then shift by the grid origin.
+ */
+bool NavGrid::worldToCell(double x, double y, int& cx, int& cy) const {
+    cx = static_cast<int>(std::floor(x + 0.5)) - originX;
+    cy = static_cast<int>(std::floor(y + 0.5)) - originY;
+    return inBounds(cx, cy);
+}
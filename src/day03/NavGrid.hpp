@@ -0,0 +1,159 @@
+#ifndef NAVGRID_HPP
+#define NAVGRID_HPP
+
+#include <cstddef>
+#include <vector>
+
+class GameManager;
+
+/**
+ * NavGrid - Occupancy grid used by pathfinding
+ *
+ * Splits the world into square cells of 1 unit, centered on integer
+ * coordinates: the cell (cx, cy) covers [cx - 0.5, cx + 0.5[ x [cy - 0.5, cy + 0.5[.
+ * A cell is BLOCKED when a Decor object stands in it.
+ *
+ * Cells are addressed with grid-local indices (0..width-1, 0..height-1);
+ * the grid origin is the world cell stored at local index (0, 0).
+ *
+ * The grid is rebuilt from the GameManager when the level is loaded.
+ * Its size is capped (MAX_CELLS): every per-cell buffer of the game
+ * (pathfinding, flow field, influence, fog) scales with it, and cells
+ * are indexed with int.
+ * Every change bumps a version number so that derived data (flow
+ * fields, cached paths) knows when it is stale.
+ */
+class NavGrid {
+public:
+    static const size_t MAX_CELLS = size_t(1) << 24;  // 4096 x 4096
+
+private:
+    int originX;                 // World cell x of local cell (0, 0)
+    int originY;                 // World cell y of local cell (0, 0)
+    int width;                   // Number of columns
+    int height;                  // Number of rows
+    std::vector<unsigned char> blocked;  // 1 = obstacle, 0 = walkable (row-major)
+    unsigned int version;        // Incremented on every obstacle change
+
+public:
+    // ========== CONSTRUCTORS ==========
+
+    /**
+     * Default constructor - empty grid (every query is out of bounds)
+     */
+    NavGrid();
+
+    /**
+     * Constructor
+     * @param originX World cell x of the first column
+     * @param originY World cell y of the first row
+     * @param width Number of columns
+     * @param height Number of rows
+     * @throws std::invalid_argument if width * height exceeds MAX_CELLS
+     */
+    NavGrid(int originX, int originY, int width, int height);
+
+
+    // ========== BUILDING ==========
+
+    /**
+     * Resize the grid to cover all objects of a manager plus a margin,
+     * then mark every Decor cell as blocked
+     * @param manager Source of the game objects
+     * @param margin Extra cells around the objects' bounding box
+     * @throws std::runtime_error if the objects are spread over more
+     *         than MAX_CELLS cells, or beyond the int cell range (the
+     *         grid is left unchanged)
+     */
+    void buildFrom(const GameManager& manager, int margin);
+
+    /**
+     * Mark every cell as walkable
+     */
+    void clear();
+
+    /**
+     * Set the obstacle flag of one cell (no-op if out of bounds)
+     * @param cx Local cell x
+     * @param cy Local cell y
+     * @param isBlocked New obstacle flag
+     */
+    void setBlocked(int cx, int cy, bool isBlocked);
+
+
+    // ========== QUERIES ==========
+
+    int getOriginX() const { return originX; }
+    int getOriginY() const { return originY; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    size_t getCellCount() const { return static_cast<size_t>(width) * height; }
+    unsigned int getVersion() const { return version; }
+
+    /**
+     * Check if a local cell is inside the grid
+     */
+    bool inBounds(int cx, int cy) const {
+        return cx >= 0 && cy >= 0 && cx < width && cy < height;
+    }
+
+    /**
+     * Check if a local cell is an obstacle (out of bounds counts as blocked)
+     */
+    bool isBlocked(int cx, int cy) const {
+        return !inBounds(cx, cy) || blocked[index(cx, cy)] != 0;
+    }
+
+    /**
+     * Check if a mover can step from a cell to one of its 8 neighbours
+     * @param cx Local cell x
+     * @param cy Local cell y
+     * @param dx Step x (-1, 0 or 1)
+     * @param dy Step y (-1, 0 or 1)
+     * 
+     * Diagonal steps may not cut the corner of an obstacle:
+     * both adjacent straight cells must be walkable.
+     */
+    bool canStep(int cx, int cy, int dx, int dy) const {
+        if (isBlocked(cx + dx, cy + dy)) {
+            return false;
+        }
+        if (dx != 0 && dy != 0) {
+            return !isBlocked(cx + dx, cy) && !isBlocked(cx, cy + dy);
+        }
+        return true;
+    }
+
+    /**
+     * Row-major index of a local cell
+     */
+    int index(int cx, int cy) const {
+        return cy * width + cx;
+    }
+
+    /**
+     * Convert a world position to a local cell
+     * @param x World x
+     * @param y World y
+     * @param cx Output local cell x
+     * @param cy Output local cell y
+     * @return true if the cell is inside the grid
+     */
+    bool worldToCell(double x, double y, int& cx, int& cy) const;
+
+    /**
+     * World x coordinate of a local cell's center
+     */
+    double cellCenterX(int cx) const {
+        return static_cast<double>(cx + originX);
+    }
+
+    /**
+     * World y coordinate of a local cell's center
+     */
+    double cellCenterY(int cy) const {
+        return static_cast<double>(cy + originY);
+    }
+};
+
+#endif // NAVGRID_HPP
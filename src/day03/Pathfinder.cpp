@@ -0,0 +1,545 @@
+#include "Pathfinder.hpp"
+#include "HierarchicalPathfinder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+    const int NEIGHBOUR_DX[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+    const int NEIGHBOUR_DY[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+}
+
+// ========== CONSTRUCTOR ==========
+
+Pathfinder::Pathfinder(const NavGrid& navGrid)
+    : grid(&navGrid),
+      knownVersion(navGrid.getVersion()),
+      searchMode(SearchMode::ASTAR),
+      jumpPointSearch(navGrid),
+      hierarchy(nullptr),
+      hierarchyThreshold(0),
+      generation(0),
+      cachedKeys(0)
+{
+    // Pools are sized by reserve() (the grid may not be built yet when
+    // the Game constructs us)
+}
+
+/**
+ * Level-load allocation
+ *
+ * Node pools follow the grid size; the cache budget is fixed, so it is
+ * only allocated once. Every query after this runs in the reserved
+ * memory: the heap holds at most one entry per cell, and a path fits
+ * pathBuffer (at most every cell).
+ */
+void Pathfinder::reserve() {
+    const size_t cellCount = grid->getCellCount();
+    if (cache.empty()) {
+        cache.assign(CACHE_SLOTS, CacheSlot{EMPTY_KEY, {-1, 0}});
+        cellStore.reserve(MAX_CACHED_CELLS);
+        records.reserve(MAX_CACHED_PATHS);
+        freeRecords.reserve(MAX_CACHED_PATHS);
+    }
+    if (gCost.size() != cellCount) {
+        gCost.assign(cellCount, 0);
+        fCost.assign(cellCount, 0);
+        parent.assign(cellCount, -1);
+        openMark.assign(cellCount, 0u);
+        closedMark.assign(cellCount, 0u);
+        heapPosition.assign(cellCount, 0);
+        openHeap.reserve(cellCount);
+        pathBuffer.reserve(cellCount);
+        generation = 0;
+        clearCache();
+        knownVersion = grid->getVersion();
+    }
+    jumpPointSearch.reserve();
+}
+
+
+// ========== QUERIES ==========
+
+/**
+ * Answer a path request
+ *
+ * 1. Cache lookup by (start, goal) - also matches any cell lying on a
+ *    previously found path to the same goal
+ * 2. On miss: run A* and cache the result
+ */
+const int* Pathfinder::findPath(int startCell, int goalCell, int& outLength) {
+    auto startTime = std::chrono::steady_clock::now();
+    stats.queries++;
+    outLength = 0;
+
+    syncWithGrid();
+
+    const int* result = nullptr;
+    if (startCell >= 0 && goalCell >= 0
+        && static_cast<size_t>(startCell) < grid->getCellCount()
+        && static_cast<size_t>(goalCell) < grid->getCellCount()) {
+
+        CacheRef ref;
+        const CacheSlot& slot = cache[findSlot(makeKey(startCell, goalCell))];
+        if (slot.key != EMPTY_KEY) {
+            stats.cacheHits++;
+            ref = slot.ref;
+        } else {
+            ref.record = search(startCell, goalCell);
+            ref.offset = 0;
+        }
+
+        if (ref.record < 0) {
+            // Too long to cache: served from the search buffer
+            if (!pathBuffer.empty()) {
+                outLength = static_cast<int>(pathBuffer.size());
+                result = pathBuffer.data();
+            }
+        } else {
+            const PathRecord& record = records[ref.record];
+            if (record.length > 0) {
+                outLength = record.length - ref.offset;
+                result = cellStore.data() + record.firstCell + ref.offset;
+            }
+        }
+    }
+
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - startTime;
+    stats.lastQueryMicros = elapsed.count();
+    stats.totalQueryMicros += elapsed.count();
+    return result;
+}
+
+/**
+ * World-space helper for movers
+ *
+ * Looks up the path, takes the next cell after the mover's own cell,
+ * and returns the unit vector towards that cell's center.
+ */
+bool Pathfinder::getNextStep(double fromX, double fromY, double toX, double toY,
+                             double& dirX, double& dirY) {
+    int sx, sy, gx, gy;
+    if (!grid->worldToCell(fromX, fromY, sx, sy) || !grid->worldToCell(toX, toY, gx, gy)) {
+        return false;
+    }
+    if (sx == gx && sy == gy) {
+        return false;  // Same cell: the mover can go straight
+    }
+
+    int length = 0;
+    const int* path = findPath(grid->index(sx, sy), grid->index(gx, gy), length);
+    if (!path || length < 2) {
+        return false;
+    }
+
+    int next = path[1];
+    double dx = grid->cellCenterX(next % grid->getWidth()) - fromX;
+    double dy = grid->cellCenterY(next / grid->getWidth()) - fromY;
+    double length2 = std::sqrt(dx * dx + dy * dy);
+    if (length2 < 0.0001) {
+        return false;
+    }
+    dirX = dx / length2;
+    dirY = dy / length2;
+    return true;
+}
+
+
+// ========== CONFIGURATION ==========
+
+void Pathfinder::setSearchMode(SearchMode mode) {
+    if (mode != searchMode) {
+        searchMode = mode;
+        clearCache();
+    }
+}
+
+void Pathfinder::setHierarchy(HierarchicalPathfinder* hpa, int minCells) {
+    hierarchy = hpa;
+    hierarchyThreshold = minCells * STRAIGHT_COST;
+    clearCache();
+}
+
+
+// ========== CACHE MAINTENANCE ==========
+
+/**
+ * Region-limited invalidation
+ *
+ * A cached result can only change if an obstacle changed inside the
+ * area its search explored (any other path costs at least as much as
+ * the one found). So we drop just the records covering that region.
+ */
+void Pathfinder::onCellChanged(int cx, int cy) {
+    int rx = cx / REGION_SIZE;
+    int ry = cy / REGION_SIZE;
+
+    for (size_t i = 0; i < records.size(); i++) {
+        const PathRecord& record = records[i];
+        if (record.alive
+            && rx >= record.minRegionX && rx <= record.maxRegionX
+            && ry >= record.minRegionY && ry <= record.maxRegionY) {
+            releaseRecord(static_cast<int>(i));
+            stats.invalidations++;
+        }
+    }
+
+    if (hierarchy) {
+        hierarchy->onCellChanged(cx, cy);
+    }
+
+    // The caller has updated the grid: we are consistent with it again
+    knownVersion = grid->getVersion();
+}
+
+void Pathfinder::clearCache() {
+    if (cachedKeys > 0) {
+        std::fill(cache.begin(), cache.end(), CacheSlot{EMPTY_KEY, {-1, 0}});
+        cachedKeys = 0;
+    }
+    records.clear();      // All keep their capacity
+    freeRecords.clear();
+    cellStore.clear();
+}
+
+
+// ========== METRICS ==========
+
+const PathfinderStats& Pathfinder::getStats() const {
+    return stats;
+}
+
+void Pathfinder::printStats() const {
+    std::cout << "Pathfinding ("
+              << (searchMode == SearchMode::JUMP_POINT ? "JPS" : "A*")
+              << (hierarchy ? " + HPA*" : "") << "):" << std::endl;
+    std::cout << "  - Queries: " << stats.queries
+              << " (cache hits: " << stats.cacheHits
+              << ", hit rate: " << static_cast<int>(stats.getHitRate() * 100.0) << "%)" << std::endl;
+    std::cout << "  - Searches: " << stats.searches
+              << " (" << stats.nodesExpanded << " nodes expanded, "
+              << stats.hierarchicalSearches << " hierarchical)" << std::endl;
+    std::cout << "  - Avg query time: " << stats.getAverageQueryMicros() << " us" << std::endl;
+    std::cout << "  - Invalidated paths: " << stats.invalidations << std::endl;
+}
+
+
+// ========== PRIVATE HELPERS ==========
+
+/**
+ * Search dispatch
+ *
+ * 1. Long query and a hierarchy is set: HPA* (abstract path + refinement)
+ * 2. Otherwise: A* or JPS on the full grid
+ * The result is cached the same way whatever produced it.
+ */
+int Pathfinder::search(int startCell, int goalCell) {
+    stats.searches++;
+
+    const int width = grid->getWidth();
+    int minX = 0, minY = 0, maxX = 0, maxY = 0;
+    bool found;
+
+    if (hierarchy && hierarchy->isBuilt() && heuristic(startCell, goalCell) >= hierarchyThreshold) {
+        stats.hierarchicalSearches++;
+        found = hierarchy->findPath(startCell, goalCell, pathBuffer);
+
+        // HPA* explores clusters around the path: use the path box grown
+        // by one cluster as the area a change can affect
+        minX = maxX = startCell % width;
+        minY = maxY = startCell / width;
+        for (int cell : pathBuffer) {
+            minX = std::min(minX, cell % width);
+            maxX = std::max(maxX, cell % width);
+            minY = std::min(minY, cell / width);
+            maxY = std::max(maxY, cell / width);
+        }
+        if (!found) {
+            // No path: any change anywhere may open one
+            minX = minY = 0;
+            maxX = width - 1;
+            maxY = grid->getHeight() - 1;
+        }
+        minX = std::max(minX - HierarchicalPathfinder::CLUSTER_SIZE, 0);
+        minY = std::max(minY - HierarchicalPathfinder::CLUSTER_SIZE, 0);
+        maxX += HierarchicalPathfinder::CLUSTER_SIZE;
+        maxY += HierarchicalPathfinder::CLUSTER_SIZE;
+    } else if (searchMode == SearchMode::JUMP_POINT) {
+        found = jumpPointSearch.findPath(startCell, goalCell, pathBuffer);
+        stats.nodesExpanded += jumpPointSearch.getLastExpanded();
+        jumpPointSearch.getLastBounds(minX, minY, maxX, maxY);
+    } else {
+        found = runAStar(startCell, goalCell, minX, minY, maxX, maxY);
+    }
+
+    // ---- Store the result ----
+    const size_t length = found ? pathBuffer.size() : 0;
+    if (length > MAX_CACHED_CELLS) {
+        return -1;
+    }
+    // Out of budget: start over (the cells of released records are only
+    // reclaimed here)
+    if (cellStore.size() + length > MAX_CACHED_CELLS
+        || (freeRecords.empty() && records.size() >= MAX_CACHED_PATHS)) {
+        clearCache();
+    }
+
+    int recordIndex;
+    if (!freeRecords.empty()) {
+        recordIndex = freeRecords.back();
+        freeRecords.pop_back();
+    } else {
+        recordIndex = static_cast<int>(records.size());
+        records.emplace_back();
+    }
+
+    PathRecord& record = records[recordIndex];
+    record.firstCell = static_cast<int>(cellStore.size());
+    record.length = static_cast<int>(length);
+    record.startCell = startCell;
+    record.goalCell = goalCell;
+    record.alive = true;
+    // Explored area, grown by one cell: a change right next to it can
+    // also open a shortcut
+    record.minRegionX = std::max(minX - 1, 0) / REGION_SIZE;
+    record.minRegionY = std::max(minY - 1, 0) / REGION_SIZE;
+    record.maxRegionX = (maxX + 1) / REGION_SIZE;
+    record.maxRegionY = (maxY + 1) / REGION_SIZE;
+
+    if (found) {
+        cellStore.insert(cellStore.end(), pathBuffer.begin(), pathBuffer.end());
+
+        // Index every cell of the path: later queries from any of them hit
+        for (size_t i = 0; i < length; i++) {
+            storeKey(makeKey(pathBuffer[i], goalCell), {recordIndex, static_cast<int>(i)});
+        }
+    } else {
+        storeKey(makeKey(startCell, goalCell), {recordIndex, 0});
+    }
+
+    return recordIndex;
+}
+
+/**
+ * A* search with pooled node arrays
+ *
+ * Instead of clearing gCost/parent for every search, each slot is
+ * tagged with the search 'generation' that wrote it. A slot from an
+ * older generation is treated as "never seen". A cell that is open and
+ * not closed is in the heap, at heapPosition.
+ */
+bool Pathfinder::runAStar(int startCell, int goalCell, int& minX, int& minY, int& maxX, int& maxY) {
+    generation++;
+    if (generation == 0) {
+        // Counter wrapped around: old marks could look current again
+        std::fill(openMark.begin(), openMark.end(), 0u);
+        std::fill(closedMark.begin(), closedMark.end(), 0u);
+        generation = 1;
+    }
+
+    const int width = grid->getWidth();
+    minX = maxX = startCell % width;
+    minY = maxY = startCell / width;
+
+    openHeap.clear();  // Keeps its capacity
+    gCost[startCell] = 0;
+    fCost[startCell] = heuristic(startCell, goalCell);
+    parent[startCell] = -1;
+    openMark[startCell] = generation;
+    heapPush(startCell);
+
+    bool found = false;
+    while (!openHeap.empty()) {
+        const int current = heapPop();
+        closedMark[current] = generation;
+        stats.nodesExpanded++;
+
+        int cx = current % width;
+        int cy = current / width;
+        minX = std::min(minX, cx);
+        maxX = std::max(maxX, cx);
+        minY = std::min(minY, cy);
+        maxY = std::max(maxY, cy);
+
+        if (current == goalCell) {
+            found = true;
+            break;
+        }
+
+        for (int n = 0; n < 8; n++) {
+            int dx = NEIGHBOUR_DX[n];
+            int dy = NEIGHBOUR_DY[n];
+            if (!grid->canStep(cx, cy, dx, dy)) {
+                continue;
+            }
+            int neighbour = grid->index(cx + dx, cy + dy);
+            if (closedMark[neighbour] == generation) {
+                continue;
+            }
+            int newCost = gCost[current] + ((dx != 0 && dy != 0) ? DIAGONAL_COST : STRAIGHT_COST);
+            if (openMark[neighbour] != generation) {
+                openMark[neighbour] = generation;
+                gCost[neighbour] = newCost;
+                fCost[neighbour] = newCost + heuristic(neighbour, goalCell);
+                parent[neighbour] = current;
+                heapPush(neighbour);
+            } else if (newCost < gCost[neighbour]) {
+                // Cheaper route to an open cell: same h, smaller f
+                fCost[neighbour] -= gCost[neighbour] - newCost;
+                gCost[neighbour] = newCost;
+                parent[neighbour] = current;
+                heapSiftUp(heapPosition[neighbour]);
+            }
+        }
+    }
+
+    pathBuffer.clear();
+    if (found) {
+        for (int cell = goalCell; cell != -1; cell = parent[cell]) {
+            pathBuffer.push_back(cell);
+        }
+        std::reverse(pathBuffer.begin(), pathBuffer.end());
+    }
+    return found;
+}
+
+/**
+ * Octile distance: exact cost on an empty grid with 10/14 moves
+ */
+int Pathfinder::heuristic(int cell, int goalCell) const {
+    const int width = grid->getWidth();
+    int dx = std::abs(cell % width - goalCell % width);
+    int dy = std::abs(cell / width - goalCell / width);
+    int diagonal = std::min(dx, dy);
+    int straight = std::max(dx, dy) - diagonal;
+    return diagonal * DIAGONAL_COST + straight * STRAIGHT_COST;
+}
+
+void Pathfinder::syncWithGrid() {
+    if (gCost.size() != grid->getCellCount() || cache.empty()) {
+        reserve();
+    }
+
+    if (grid->getVersion() != knownVersion) {
+        // Grid changed without onCellChanged(): we don't know where
+        clearCache();
+        knownVersion = grid->getVersion();
+    }
+}
+
+void Pathfinder::releaseRecord(int recordIndex) {
+    PathRecord& record = records[recordIndex];
+    if (!record.alive) {
+        return;
+    }
+
+    auto eraseKey = [&](int cell) {
+        const size_t slot = findSlot(makeKey(cell, record.goalCell));
+        // Another record may have re-indexed this cell since
+        if (cache[slot].key != EMPTY_KEY && cache[slot].ref.record == recordIndex) {
+            eraseSlot(slot);
+        }
+    };
+
+    if (record.length == 0) {
+        eraseKey(record.startCell);
+    } else {
+        for (int i = 0; i < record.length; i++) {
+            eraseKey(cellStore[record.firstCell + i]);
+        }
+    }
+
+    record.alive = false;
+    freeRecords.push_back(recordIndex);  // Reserved for every record
+}
+
+void Pathfinder::heapPush(int cell) {
+    openHeap.push_back(cell);  // Reserved: at most one entry per cell
+    heapSiftUp(static_cast<int>(openHeap.size()) - 1);
+}
+
+int Pathfinder::heapPop() {
+    const int top = openHeap.front();
+    const int last = openHeap.back();
+    openHeap.pop_back();
+
+    const int count = static_cast<int>(openHeap.size());
+    if (count > 0) {
+        // Sift 'last' down from the root
+        int position = 0;
+        while (true) {
+            int child = 2 * position + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && heapBefore(openHeap[child + 1], openHeap[child])) {
+                child++;
+            }
+            if (!heapBefore(openHeap[child], last)) {
+                break;
+            }
+            openHeap[position] = openHeap[child];
+            heapPosition[openHeap[position]] = position;
+            position = child;
+        }
+        openHeap[position] = last;
+        heapPosition[last] = position;
+    }
+    return top;
+}
+
+void Pathfinder::heapSiftUp(int position) {
+    const int cell = openHeap[position];
+    while (position > 0) {
+        const int up = (position - 1) / 2;
+        if (!heapBefore(cell, openHeap[up])) {
+            break;
+        }
+        openHeap[position] = openHeap[up];
+        heapPosition[openHeap[position]] = position;
+        position = up;
+    }
+    openHeap[position] = cell;
+    heapPosition[cell] = position;
+}
+
+size_t Pathfinder::findSlot(uint64_t key) const {
+    size_t slot = homeSlot(key);
+    while (cache[slot].key != EMPTY_KEY && cache[slot].key != key) {
+        slot = (slot + 1) & (CACHE_SLOTS - 1);
+    }
+    return slot;
+}
+
+void Pathfinder::storeKey(uint64_t key, CacheRef ref) {
+    CacheSlot& slot = cache[findSlot(key)];
+    if (slot.key == EMPTY_KEY) {
+        slot.key = key;
+        cachedKeys++;
+    }
+    slot.ref = ref;
+}
+
+/**
+ * Backward-shift deletion
+ *
+ * No tombstones: every entry after the hole (up to the next free slot)
+ * whose home slot is not between the hole and itself moves into the
+ * hole, so lookups never stop early on a gap.
+ */
+void Pathfinder::eraseSlot(size_t hole) {
+    const size_t mask = CACHE_SLOTS - 1;
+    size_t next = (hole + 1) & mask;
+    while (cache[next].key != EMPTY_KEY) {
+        const size_t home = homeSlot(cache[next].key);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            cache[hole] = cache[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    cache[hole].key = EMPTY_KEY;
+    cachedKeys--;
+}
@@ -0,0 +1,330 @@
+#ifndef PATHFINDER_HPP
+#define PATHFINDER_HPP
+
+#include "NavGrid.hpp"
+#include "JumpPointSearch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class HierarchicalPathfinder;
+
+/**
+ * PathfinderStats - Metrics exposed by the A* service
+ */
+struct PathfinderStats {
+    size_t queries = 0;          // Total path requests
+    size_t cacheHits = 0;        // Requests answered from the cache
+    size_t searches = 0;         // Requests that ran a search
+    size_t hierarchicalSearches = 0;  // Searches answered by HPA*
+    size_t nodesExpanded = 0;    // Cells closed by all searches
+    size_t invalidations = 0;    // Cached paths dropped after obstacle changes
+    double totalQueryMicros = 0.0;  // Time spent answering requests
+    double lastQueryMicros = 0.0;   // Time of the most recent request
+
+    /**
+     * Fraction of requests served by the cache (0.0 - 1.0)
+     */
+    double getHitRate() const {
+        return queries > 0 ? static_cast<double>(cacheHits) / queries : 0.0;
+    }
+
+    /**
+     * Average request time in microseconds
+     */
+    double getAverageQueryMicros() const {
+        return queries > 0 ? totalQueryMicros / queries : 0.0;
+    }
+};
+
+/**
+ * Pathfinder - A* service with path caching, for individual targets
+ *
+ * The shared FlowField only helps enemies that chase the player. Enemies
+ * with their own objective ask this service instead.
+ *
+ * Search:
+ * - A* over the NavGrid (8 neighbours, straight cost 10, diagonal 14,
+ *   octile heuristic)
+ * - Open set is an indexed binary heap of cells: a cheaper route to an
+ *   open cell moves it up in place (decrease-key), so the heap never
+ *   holds more than one entry per cell
+ * - Node arrays (cost, parent, open/closed marks, heap) are POOLED:
+ *   allocated once for the grid size by reserve() and reused by every
+ *   query. A generation counter replaces clearing them between searches.
+ *
+ * Cache:
+ * - Results are stored by (start cell, goal cell)
+ * - Every cell of a found path is also indexed, so a mover that follows
+ *   its path hits the cache on the next turns (path reuse: any suffix of
+ *   an optimal path is optimal)
+ * - Fixed budget, allocated by reserve(): the cells of every cached path
+ *   live in one store of MAX_CACHED_CELLS, the keys in an open-addressing
+ *   table of CACHE_SLOTS (linear probing). When the store or the record
+ *   pool is full, the whole cache is dropped - a query never allocates.
+ * - Each entry remembers the grid REGIONS its search explored. When an
+ *   obstacle changes (onCellChanged), only the entries touching that
+ *   region are dropped.
+ *
+ * Large maps:
+ * - setSearchMode(JUMP_POINT) replaces plain A* by Jump Point Search
+ *   (same optimal paths, far fewer heap operations on open areas)
+ * - setHierarchy() hands long queries (octile distance above a
+ *   threshold) to an HPA* abstraction; short ones stay on the grid
+ */
+class Pathfinder {
+public:
+    /**
+     * Grid search used when the hierarchy is not involved
+     */
+    enum class SearchMode {
+        ASTAR,          // Plain A* (best on small maps)
+        JUMP_POINT      // Jump Point Search (best on big open maps)
+    };
+
+private:
+    static constexpr int STRAIGHT_COST = 10;
+    static constexpr int DIAGONAL_COST = 14;
+    static constexpr int REGION_SIZE = 8;          // Cells per region side
+    static constexpr size_t MAX_CACHED_PATHS = 4096;
+    static constexpr size_t MAX_CACHED_CELLS = 32768;  // Path cells in the store
+    static constexpr int CACHE_BITS = 17;
+    static constexpr size_t CACHE_SLOTS = size_t(1) << CACHE_BITS;
+    static constexpr uint64_t EMPTY_KEY = ~uint64_t(0);  // No (cell, goal) gives it
+
+    // One key per stored cell, plus one per unreachable goal: the table
+    // stays under half full, so probes are short and always end
+    static_assert(2 * (MAX_CACHED_CELLS + MAX_CACHED_PATHS) <= CACHE_SLOTS,
+                  "path cache table too small for its budget");
+
+    /**
+     * One cached search result
+     */
+    struct PathRecord {
+        int firstCell;           // Path from start to goal (inclusive) in cellStore
+        int length;              // 0 if no path
+        int startCell;
+        int goalCell;
+        int minRegionX, minRegionY;   // Regions explored by the search
+        int maxRegionX, maxRegionY;
+        bool alive;
+    };
+
+    /**
+     * Cache slot: which record, and where along its path the key cell is
+     */
+    struct CacheRef {
+        int record;
+        int offset;
+    };
+
+    /**
+     * Open-addressing table slot (key == EMPTY_KEY: free)
+     */
+    struct CacheSlot {
+        uint64_t key;
+        CacheRef ref;
+    };
+
+    const NavGrid* grid;         // Searched grid (not owned)
+    unsigned int knownVersion;   // Grid version the cache is consistent with
+
+    SearchMode searchMode;
+    JumpPointSearch jumpPointSearch;
+    HierarchicalPathfinder* hierarchy;  // Optional (not owned)
+    int hierarchyThreshold;      // Min octile cost for an HPA* query
+    std::vector<int> pathBuffer; // Output of the last search, before caching
+
+    // ---- Pooled node arrays (one slot per cell) ----
+    std::vector<int> gCost;
+    std::vector<int> fCost;                // g + h (heap order)
+    std::vector<int> parent;
+    std::vector<unsigned int> openMark;    // == generation: g/f/parent are valid
+    std::vector<unsigned int> closedMark;  // == generation: cell is closed
+    std::vector<int> heapPosition;         // Slot in openHeap of an open cell
+    std::vector<int> openHeap;             // Open cells, smallest f on top
+    unsigned int generation;
+
+    // ---- Path cache (fixed capacity, see reserve) ----
+    std::vector<PathRecord> records;       // Record pool
+    std::vector<int> freeRecords;          // Dead records ready for reuse
+    std::vector<int> cellStore;            // Cells of every record, appended
+    std::vector<CacheSlot> cache;          // (cell, goal) -> path
+    size_t cachedKeys;                     // Used slots in 'cache'
+
+    PathfinderStats stats;
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * Constructor
+     * @param navGrid Grid to search (must outlive the pathfinder)
+     */
+    explicit Pathfinder(const NavGrid& navGrid);
+
+    /**
+     * Allocate the node pools for the grid's current size, and the path
+     * cache (records, cell store, key table)
+     *
+     * Call at level load, once the grid is built: queries then never
+     * allocate. Without it the first query does it.
+     */
+    void reserve();
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Find a path between two local cells
+     * @param startCell Grid index of the start
+     * @param goalCell Grid index of the goal
+     * @param outLength Output number of cells from start to goal (inclusive)
+     * @return Pointer to the first cell of the path, or nullptr if unreachable
+     *
+     * The returned cells stay valid until the next query or invalidation.
+     */
+    const int* findPath(int startCell, int goalCell, int& outLength);
+
+    /**
+     * Get the direction of the next step from a world position to another
+     * @param fromX Mover world x
+     * @param fromY Mover world y
+     * @param toX Goal world x
+     * @param toY Goal world y
+     * @param dirX Output unit direction x
+     * @param dirY Output unit direction y
+     * @return false if off grid, unreachable, or already in the goal cell
+     */
+    bool getNextStep(double fromX, double fromY, double toX, double toY,
+                     double& dirX, double& dirY);
+
+
+    // ========== CONFIGURATION ==========
+
+    /**
+     * Choose the grid search algorithm
+     * @param mode ASTAR or JUMP_POINT (both give optimal paths)
+     */
+    void setSearchMode(SearchMode mode);
+
+    /**
+     * Use an HPA* abstraction for long queries
+     * @param hpa Built hierarchy over the same grid, or nullptr to disable
+     * @param minCells Octile distance (in cells) from which HPA* is used
+     */
+    void setHierarchy(HierarchicalPathfinder* hpa, int minCells);
+
+
+    // ========== CACHE MAINTENANCE ==========
+
+    /**
+     * Report that the obstacle flag of a cell changed
+     * @param cx Local cell x
+     * @param cy Local cell y
+     *
+     * Drops only the cached paths whose search touched the cell's region,
+     * and forwards the change to the hierarchy (if any).
+     */
+    void onCellChanged(int cx, int cy);
+
+    /**
+     * Drop every cached path
+     */
+    void clearCache();
+
+
+    // ========== METRICS ==========
+
+    /**
+     * Get query metrics (time, cache hit rate, work done)
+     */
+    const PathfinderStats& getStats() const;
+
+    /**
+     * Print metrics to the console
+     */
+    void printStats() const;
+
+private:
+    // ========== PRIVATE HELPERS ==========
+
+    /**
+     * Run the right search and store the result in the cache
+     * @return Index of the new record, or -1 if the path is longer than
+     *         the whole cell store (then it is only in pathBuffer)
+     */
+    int search(int startCell, int goalCell);
+
+    /**
+     * Plain A* into pathBuffer
+     * @param minX..maxY Output bounding box of the closed cells
+     * @return true if a path was found
+     */
+    bool runAStar(int startCell, int goalCell, int& minX, int& minY, int& maxX, int& maxY);
+
+    /**
+     * Octile distance heuristic between two cells
+     */
+    int heuristic(int cell, int goalCell) const;
+
+    /**
+     * Make sure the pooled arrays match the grid, and that the cache
+     * is not older than an unreported grid change
+     */
+    void syncWithGrid();
+
+    /**
+     * Remove a record and all its cache keys
+     */
+    void releaseRecord(int record);
+
+    // ---- Open set (indexed binary heap over fCost, then deeper g) ----
+
+    bool heapBefore(int cellA, int cellB) const {
+        if (fCost[cellA] != fCost[cellB]) return fCost[cellA] < fCost[cellB];
+        return gCost[cellA] > gCost[cellB];  // Tie: prefer the deeper node (closer to goal)
+    }
+
+    void heapPush(int cell);
+    int heapPop();
+
+    /**
+     * Move the cell at 'position' up after its f decreased
+     */
+    void heapSiftUp(int position);
+
+    // ---- Key table (linear probing, backward-shift deletion) ----
+
+    /**
+     * Slot holding 'key', or the free slot that ends its probe sequence
+     */
+    size_t findSlot(uint64_t key) const;
+
+    /**
+     * Insert or overwrite (the table is never full, see CACHE_SLOTS)
+     */
+    void storeKey(uint64_t key, CacheRef ref);
+
+    /**
+     * Free a used slot, moving later entries of its run back
+     */
+    void eraseSlot(size_t slot);
+
+    /**
+     * Cache key of (cell, goal)
+     */
+    static uint64_t makeKey(int cell, int goalCell) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cell)) << 32)
+             | static_cast<uint32_t>(goalCell);
+    }
+
+    /**
+     * Home slot of a key (Fibonacci hashing)
+     */
+    static size_t homeSlot(uint64_t key) {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - CACHE_BITS));
+    }
+};
+
+#endif // PATHFINDER_HPP
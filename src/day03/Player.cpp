@@ -1,79 +1,67 @@
 #include "Player.hpp"
 #include "UIHelper.hpp"  // JOB 11 - Enhanced UI
+#include "Visibility.hpp"
 #include <iostream>
 
 // ========== CONSTRUCTORS & DESTRUCTOR ==========
 
-Player::Player(double x, double y, const std::string& name, int health)
+Player::Player(double x, double y, const std::string& name, int health,
+               const WeaponTable* weapons)
     : Character(x, y, name, health),
-      bow(),           // Default construct Bow
-      spear(),         // Default construct Spear
-      sword(),         // Default construct Sword
-      currentWeapon(&bow),  // Start with Bow
-      currentTarget(nullptr)
+      weapons(weapons ? weapons : &WeaponTable::getBuiltin()),
+      currentWeaponId(0),     // Start with the first row (beginning of cycle)
+      currentTarget(nullptr),
+      navGrid(nullptr),
+      areaOfEffect(nullptr)
 {
     // Character constructor called first
-    // Then all weapons are constructed (composition)
-    // Start with Bow equipped (beginning of cycle)
 }
 
 Player::~Player() {
     // No manual cleanup needed:
-    // - bow, spear, sword are automatic (not pointers)
-    // - currentWeapon is just a pointer (doesn't own)
+    // - weapons is a shared table (doesn't own)
     // - currentTarget is just a reference (doesn't own)
 }
 
 
 // ========== WEAPON MANAGEMENT ==========
 
-Weapon* Player::getCurrentWeapon() const {
-    return currentWeapon;
+const Weapon* Player::getCurrentWeapon() const {
+    return &weapons->get(currentWeaponId);
+}
+
+const WeaponTable& Player::getWeapons() const {
+    return *weapons;
 }
 
 /**
- * Switch weapon in cycle: Bow → Spear → Sword → Bow
+ * Switch weapon in cycle: next row of the table, wrapping around
  * 
- * This is elegant because:
- * - No memory allocation/deallocation (just pointer change)
+ * - No memory allocation/deallocation (just an id change)
  * - Fast (O(1) operation)
- * - Safe (all weapons always exist)
- * 
- * This is the Strategy Pattern - changing strategy at runtime!
+ * - Works for any number of weapons in the table
  */
 void Player::switchWeapon() {
-    // Determine next weapon in cycle
-    if (currentWeapon == &bow) {
-        currentWeapon = &spear;
-        std::cout << "    🔄 Switched to Spear (Range:" << spear.getRange() 
-                  << ", Power:" << spear.getPower() << ")" << std::endl;
-    } else if (currentWeapon == &spear) {
-        currentWeapon = &sword;
-        std::cout << "    🔄 Switched to Sword (Range:" << sword.getRange() 
-                  << ", Power:" << sword.getPower() << ")" << std::endl;
-    } else {  // currentWeapon == &sword
-        currentWeapon = &bow;
-        std::cout << "    🔄 Switched to Bow (Range:" << bow.getRange() 
-                  << ", Power:" << bow.getPower() << ")" << std::endl;
-    }
+    currentWeaponId = (currentWeaponId + 1) % weapons->size();
+    const Weapon& weapon = weapons->get(currentWeaponId);
+    std::cout << "    🔄 Switched to " << weapon.getName() << " (Range:" << weapon.getRange() 
+              << ", Power:" << weapon.getPower() << ")" << std::endl;
 }
 
 /**
- * Equip specific weapon by name
+ * Equip specific weapon by id
  * Useful for manual weapon selection
  */
-bool Player::equipWeapon(const std::string& weaponName) {
-    if (weaponName == "Bow") {
-        currentWeapon = &bow;
-        return true;
-    } else if (weaponName == "Spear") {
-        currentWeapon = &spear;
-        return true;
-    } else if (weaponName == "Sword") {
-        currentWeapon = &sword;
-        return true;
+bool Player::equipWeapon(int weaponId) {
+    if (weaponId < 0 || weaponId >= weapons->size()) {
+        return false;  // Invalid weapon id
     }
-    return false;  // Invalid weapon name
+    currentWeaponId = weaponId;
+    return true;
+}
+
+bool Player::equipWeapon(const std::string& weaponName) {
+    return equipWeapon(weapons->findByName(weaponName));
 }
 
 
@@ -87,6 +75,14 @@ Character* Player::getTarget() const {
     return currentTarget;
 }
 
+void Player::setNavGrid(const NavGrid* grid) {
+    this->navGrid = grid;
+}
+
+void Player::setAreaOfEffect(AreaOfEffect* area) {
+    this->areaOfEffect = area;
+}
+
 
 // ========== OVERRIDE METHODS ==========
 
@@ -95,10 +91,13 @@ void Player::draw() const {
     std::cout << UI::STYLE_BOLD << "[PLAYER '" << UI::COLOR_BRIGHT_GREEN 
               << getName() << UI::COLOR_RESET << UI::STYLE_BOLD << "']" << UI::COLOR_RESET << " ";
     std::cout << "Pos:(" << getX() << ", " << getY() << ") ";
-    std::cout << "HP: " << UI::getHealthBar(getHealth(), 100, 12, true) << " ";
-    std::cout << "Weapon: " << UI::COLOR_YELLOW << currentWeapon->getName() << UI::COLOR_RESET;
-    std::cout << " (R:" << currentWeapon->getRange() 
-              << ", P:" << currentWeapon->getPower() << ")";
+    std::cout << "HP: ";
+    UI::drawHealthBar(getHealth(), 100, 12, true);
+    std::cout << " ";
+    const Weapon& weapon = weapons->get(currentWeaponId);
+    std::cout << "Weapon: " << UI::COLOR_YELLOW << weapon.getName() << UI::COLOR_RESET;
+    std::cout << " (R:" << weapon.getRange() 
+              << ", P:" << weapon.getPower() << ")";
     std::cout << std::endl;
 }
 
@@ -110,7 +109,8 @@ void Player::draw() const {
  * (Each turn, player must attack before changing weapon)
  * 
  * Implementation:
- * 1. Attack current target with current weapon
+ * 1. Attack current target with current weapon (a SHOT weapon only if
+ *    the target is in our field of view)
  * 2. Switch to next weapon in cycle
  * 
  * This is classic turn-based RPG combat!
@@ -125,11 +125,17 @@ void Player::update() {
     std::cout << "  > " << getName() << "'s turn:" << std::endl;
     
     // Step 1: Attack with current weapon
-    if (currentTarget && currentTarget->isAlive()) {
+    const Weapon& weapon = weapons->get(currentWeaponId);
+    bool blindShot = navGrid && weapon.getStyle() == AttackStyle::SHOT && currentTarget
+        && !LineOfSight::isClear(*navGrid, getX(), getY(), currentTarget->getX(), currentTarget->getY());
+    if (blindShot && currentTarget->isAlive()) {
+        std::cout << "    🚫 No line of sight to " << currentTarget->getName()
+                  << " for the " << weapon.getName() << std::endl;
+    } else if (currentTarget && currentTarget->isAlive()) {
         std::cout << "    ⚔️  Attacking " << currentTarget->getName() 
-                  << " with " << currentWeapon->getName() << ":" << std::endl;
+                  << " with " << weapon.getName() << ":" << std::endl;
         std::cout << "    ";
-        currentWeapon->attack(*currentTarget);
+        weapon.attack(*this, *currentTarget, areaOfEffect);
     } else {
         std::cout << "    ⚠️  No valid target to attack" << std::endl;
     }
@@ -3,9 +3,10 @@
 
 #include "Character.hpp"
 #include "Weapon.hpp"
-#include "Bow.hpp"
-#include "Spear.hpp"
-#include "Sword.hpp"
+#include "WeaponTable.hpp"
+
+class NavGrid;
+class AreaOfEffect;
 
 /**
  * Player - User-controlled character with weapon system
@@ -16,24 +17,23 @@
  * 1. Attack current target with current weapon
  * 2. Switch to next weapon in cycle
  * 
- * Weapon Cycle: Bow → Spear → Sword → Bow (repeats)
+ * Weapon Cycle: rows of the WeaponTable in order, then back to the
+ * first one (default table: Bow → Spear → Sword → Bow)
  * 
  * This demonstrates:
- * - Composition (Player HAS weapons)
- * - Strategy Pattern (switching attack strategies)
+ * - Data-driven design (weapons are table rows, the player holds an id)
  * - Turn-based combat (attack then switch)
  * 
  * Inheritance: Player -> Character -> GameObject -> Vector2d
  */
 class Player : public Character {
 private:
-    // Weapon system - all three weapons stored (composition)
-    Bow bow;
-    Spear spear;
-    Sword sword;
-    
-    Weapon* currentWeapon;    // Pointer to currently equipped weapon
+    // Weapon system - weapons live in a shared table (not owned)
+    const WeaponTable* weapons;
+    int currentWeaponId;      // Row of the currently equipped weapon
     Character* currentTarget; // Current enemy to attack
+    const NavGrid* navGrid;   // Obstacles for ranged shots (not owned, may be null)
+    AreaOfEffect* areaOfEffect;  // Area hits of our weapons (not owned, may be null)
 
 public:
     // ========== CONSTRUCTORS & DESTRUCTOR ==========
@@ -44,8 +44,11 @@ public:
      * @param y Starting y position
      * @param name Player's name
      * @param health Player's health points (default 100)
+     * @param weapons Weapon table (must outlive the player),
+     *                nullptr = built-in Bow / Spear / Sword
      */
-    Player(double x, double y, const std::string& name, int health = 100);
+    Player(double x, double y, const std::string& name, int health = 100,
+           const WeaponTable* weapons = nullptr);
     
     /**
      * Destructor
@@ -57,23 +60,32 @@ public:
     
     /**
      * Get currently equipped weapon
-     * @return Pointer to current weapon
+     * @return Pointer to current weapon (row of the table)
+     */
+    const Weapon* getCurrentWeapon() const;
+    
+    /**
+     * Get the weapon table the player picks from
      */
-    Weapon* getCurrentWeapon() const;
+    const WeaponTable& getWeapons() const;
     
     /**
      * Switch to next weapon in cycle
      * 
-     * Cycle: Bow → Spear → Sword → Bow (repeats)
-     * 
-     * This is the Strategy Pattern in action!
-     * Changes combat strategy by switching weapon.
+     * Cycle: next row of the table, wrapping around
      */
     void switchWeapon();
     
     /**
      * Equip a specific weapon
-     * @param weaponName "Bow", "Spear", or "Sword"
+     * @param weaponId Row in the weapon table
+     * @return true if successful, false if invalid id
+     */
+    bool equipWeapon(int weaponId);
+    
+    /**
+     * Equip a specific weapon by name
+     * @param weaponName e.g. "Bow", "Spear", or "Sword"
      * @return true if successful, false if invalid name
      */
     bool equipWeapon(const std::string& weaponName);
@@ -93,6 +105,22 @@ public:
      */
     Character* getTarget() const;
     
+    /**
+     * Set the grid that ranged shots are checked against
+     * @param grid nullptr = ranged weapons ignore obstacles
+     * 
+     * A SHOT weapon needs a clear line to the target (LineOfSight::isClear
+     * between the exact positions, the rule of every ranged attack): no
+     * arrow through ruins.
+     */
+    void setNavGrid(const NavGrid* grid);
+    
+    /**
+     * Set the service that finds who else an area weapon hits
+     * @param area nullptr = every weapon hits its target only
+     */
+    void setAreaOfEffect(AreaOfEffect* area);
+    
     
     // ========== OVERRIDE METHODS ==========
     
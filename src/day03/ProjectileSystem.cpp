@@ -0,0 +1,233 @@
+#include "ProjectileSystem.hpp"
+#include "SpatialGrid.hpp"
+#include "Geometry.hpp"
+#include "EventBus.hpp"
+#include "UIHelper.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// ========== CONSTRUCTOR ==========
+
+ProjectileSystem::ProjectileSystem()
+    : liveCount(0),
+      events(nullptr)
+{
+}
+
+
+// ========== POOL ==========
+
+void ProjectileSystem::reserve(size_t capacity) {
+    posX.reserve(capacity);
+    posY.reserve(capacity);
+    dirX.reserve(capacity);
+    dirY.reserve(capacity);
+    speed.reserve(capacity);
+    remaining.reserve(capacity);
+    damage.reserve(capacity);
+    blast.reserve(capacity);
+    owner.reserve(capacity);
+    kind.reserve(capacity);
+    live.reserve(capacity);
+    freeSlots.reserve(capacity);
+    impacts.reserve(capacity);
+}
+
+uint32_t ProjectileSystem::spawn(Kind projectileKind, double x, double y, double aimX, double aimY,
+                                 double projectileSpeed, double range, int projectileDamage,
+                                 const GameObject* shooter, double blastRadius) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(posX.size());
+        posX.push_back(0.0);
+        posY.push_back(0.0);
+        dirX.push_back(0.0);
+        dirY.push_back(0.0);
+        speed.push_back(0.0);
+        remaining.push_back(0.0);
+        damage.push_back(0);
+        blast.push_back(0.0);
+        owner.push_back(nullptr);
+        kind.push_back(projectileKind);
+        live.push_back(0);
+        // Room for every slot to come back to the free list / to impact
+        if (freeSlots.capacity() < posX.capacity()) {
+            freeSlots.reserve(posX.capacity());
+            impacts.reserve(posX.capacity());
+        }
+    }
+
+    // Aim at the target's current position (it may move away later)
+    double dx = aimX - x;
+    double dy = aimY - y;
+    double dist = std::sqrt(dx * dx + dy * dy);
+    posX[slot] = x;
+    posY[slot] = y;
+    dirX[slot] = dist > 0.0 ? dx / dist : 0.0;
+    dirY[slot] = dist > 0.0 ? dy / dist : 0.0;
+    speed[slot] = projectileSpeed;
+    remaining[slot] = range;
+    damage[slot] = projectileDamage;
+    blast[slot] = blastRadius;
+    owner[slot] = shooter;
+    kind[slot] = projectileKind;
+    live[slot] = 1;
+    liveCount++;
+    return slot;
+}
+
+void ProjectileSystem::clear() {
+    posX.clear();
+    posY.clear();
+    dirX.clear();
+    dirY.clear();
+    speed.clear();
+    remaining.clear();
+    damage.clear();
+    blast.clear();
+    owner.clear();
+    kind.clear();
+    live.clear();
+    freeSlots.clear();
+    impacts.clear();
+    liveCount = 0;
+}
+
+void ProjectileSystem::setEventBus(EventBus* bus) {
+    this->events = bus;
+}
+
+void ProjectileSystem::release(uint32_t slot) {
+    live[slot] = 0;
+    freeSlots.push_back(slot);
+    liveCount--;
+}
+
+
+// ========== SIMULATION ==========
+
+/**
+ * One turn of flight for every projectile
+ *
+ * For each live slot:
+ * 1. Step = min(speed, remaining) along the direction
+ * 2. Broad phase: grid entries near the box around the step, on a
+ *    layer projectiles interact with (HIT_MASK)
+ * 3. Narrow phase: swept circle (Geometry::sweepCircle) on each, the
+ *    smallest contact time wins, so fast projectiles cannot tunnel
+ * 4. Hit: stop at the contact point, record the impact, free the slot
+ *    No hit: move the full step; out of range: record a drop, free it
+ */
+const std::vector<ProjectileSystem::Impact>& ProjectileSystem::update(const SpatialGrid& grid) {
+    impacts.clear();
+    const size_t slots = posX.size();
+    for (uint32_t slot = 0; slot < slots; slot++) {
+        if (!live[slot]) {
+            continue;
+        }
+
+        const double startX = posX[slot];
+        const double startY = posY[slot];
+        const double step = std::min(speed[slot], remaining[slot]);
+        const double moveX = dirX[slot] * step;
+        const double moveY = dirY[slot] * step;
+        const double endX = startX + moveX;
+        const double endY = startY + moveY;
+        const GameObject* shooter = owner[slot];
+
+        GameObject* firstHit = nullptr;
+        double firstTime = 1.0;
+        grid.query(std::min(startX, endX) - HIT_RADIUS, std::min(startY, endY) - HIT_RADIUS,
+                   std::max(startX, endX) + HIT_RADIUS, std::max(startY, endY) + HIT_RADIUS,
+                   LAYER, HIT_MASK, [&](const SpatialGrid::Entry& entry) {
+                       double t;
+                       if (entry.object != shooter
+                           && Geometry::sweepCircle(startX, startY, moveX, moveY, entry.x, entry.y,
+                                                    entry.radius + HIT_RADIUS, t)
+                           && (!firstHit || t < firstTime)) {
+                           firstHit = entry.object;
+                           firstTime = t;
+                       }
+                   });
+
+        if (firstHit) {
+            posX[slot] = startX + moveX * firstTime;
+            posY[slot] = startY + moveY * firstTime;
+            impacts.push_back(Impact{ kind[slot], firstHit, owner[slot], damage[slot], posX[slot], posY[slot],
+                                      blast[slot] });
+            release(slot);
+            continue;
+        }
+
+        posX[slot] = endX;
+        posY[slot] = endY;
+        remaining[slot] -= step;
+        if (remaining[slot] <= 0.0) {
+            impacts.push_back(Impact{ kind[slot], nullptr, owner[slot], damage[slot], endX, endY, blast[slot] });
+            release(slot);
+        }
+    }
+
+    if (events) {
+        for (const Impact& impact : impacts) {
+            events->publish(ProjectileExpiredEvent{ static_cast<uint8_t>(impact.kind),
+                                                    impact.victim != nullptr, impact.x, impact.y });
+        }
+    }
+    return impacts;
+}
+
+
+// ========== ACCESS ==========
+
+size_t ProjectileSystem::getLiveCount() const {
+    return liveCount;
+}
+
+size_t ProjectileSystem::getSlotCount() const {
+    return posX.size();
+}
+
+bool ProjectileSystem::isLive(uint32_t slot) const {
+    return live[slot] != 0;
+}
+
+double ProjectileSystem::getX(uint32_t slot) const {
+    return posX[slot];
+}
+
+double ProjectileSystem::getY(uint32_t slot) const {
+    return posY[slot];
+}
+
+int ProjectileSystem::getDamage(uint32_t slot) const {
+    return damage[slot];
+}
+
+ProjectileSystem::Kind ProjectileSystem::getKind(uint32_t slot) const {
+    return kind[slot];
+}
+
+const char* ProjectileSystem::getKindName(Kind projectileKind) {
+    switch (projectileKind) {
+        case Kind::ARROW: return "Arrow";
+        case Kind::EXPLOSIVE_ARROW: return "Explosive arrow";
+    }
+    return "Projectile";
+}
+
+void ProjectileSystem::drawAll() const {
+    for (uint32_t slot = 0; slot < posX.size(); slot++) {
+        if (!live[slot]) {
+            continue;
+        }
+        std::cout << "[PROJECTILE '" << UI::COLOR_BRIGHT_YELLOW << getKindName(kind[slot]) << UI::COLOR_RESET << "'] ";
+        std::cout << "Pos:(" << posX[slot] << ", " << posY[slot] << ") ";
+        std::cout << "Dmg:" << damage[slot] << " ";
+        std::cout << "Status: " << UI::COLOR_YELLOW << "FLYING" << UI::COLOR_RESET << std::endl;
+    }
+}
@@ -0,0 +1,155 @@
+#ifndef PROJECTILESYSTEM_HPP
+#define PROJECTILESYSTEM_HPP
+
+#include "CollisionShape.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+class SpatialGrid;
+class EventBus;
+
+/**
+ * ProjectileSystem - Every projectile in flight, as plain records
+ *
+ * Projectiles used to be GameObjects: a heap std::string name, a
+ * vtable, a unique_ptr slot in the GameManager vector, and a
+ * dynamic_cast from every pass that looked for them. Here a projectile
+ * is just one slot in a set of parallel arrays (Structure of Arrays):
+ *
+ *   posX[] posY[] dirX[] dirY[] speed[] remaining[] damage[] blast[] owner[] kind[]
+ *
+ * - spawn() takes a slot from the free list (or grows the pool);
+ *   expired slots go back to the free list, so a long fight reuses the
+ *   same memory and never allocates once the pool is warm (reserve()).
+ * - update() flies every live projectile in ONE loop over the arrays:
+ *   step, swept hit test against the SpatialGrid, expiry.
+ * - The system does not print and does not apply damage: update() lists
+ *   what happened (Impact records) and the Game resolves it. With an
+ *   EventBus, every expiry is also published (ProjectileExpiredEvent).
+ *
+ * Flight rules are the same as before: straight line, 'speed' units
+ * per turn, first object of the grid on the path (not the owner) is
+ * hit, dropped after 'range' units.
+ */
+class ProjectileSystem {
+public:
+    /**
+     * Projectile kinds (name shown in the log; no per-projectile string)
+     */
+    enum class Kind : uint8_t {
+        ARROW,
+        EXPLOSIVE_ARROW   // Blasts everyone within 'blast' of where it stops
+    };
+
+    /**
+     * What happened to a projectile during update()
+     */
+    struct Impact {
+        Kind kind;
+        GameObject* victim;  // First object hit, nullptr = dropped at max range
+        const GameObject* owner;  // Who fired it (only compared, may be gone)
+        int damage;
+        double x;            // Where it stopped
+        double y;
+        double blast;        // Blast radius around (x, y), 0 = none
+    };
+
+    static constexpr double HIT_RADIUS = 0.1;  // Radius of the projectile itself
+    static const uint8_t LAYER = CollisionLayer::PROJECTILE;
+    static const uint8_t HIT_MASK = CollisionLayer::CHARACTER;  // Arrows fly over decor
+
+private:
+    // ---- Per slot (SoA) ----
+    std::vector<double> posX;
+    std::vector<double> posY;
+    std::vector<double> dirX;       // Unit flight direction
+    std::vector<double> dirY;
+    std::vector<double> speed;      // Units per turn
+    std::vector<double> remaining;  // Units left before dropping
+    std::vector<int> damage;
+    std::vector<double> blast;      // Blast radius at impact / drop (0 = none)
+    std::vector<const GameObject*> owner;  // Never hit (not owned, only compared)
+    std::vector<Kind> kind;
+    std::vector<uint8_t> live;      // 1 = in flight, 0 = free slot
+
+    std::vector<uint32_t> freeSlots;  // Recycled slots (stack)
+    std::vector<Impact> impacts;      // Filled by update()
+    size_t liveCount;
+    EventBus* events;                 // Expiry notifications (not owned, may be null)
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    ProjectileSystem();
+
+
+    // ========== POOL ==========
+
+    /**
+     * Make room for 'capacity' projectiles in flight at once
+     * (spawn / update never allocate below that)
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Fire a projectile from (x, y) towards (aimX, aimY)
+     * @param speed Units flown per turn
+     * @param range Units flown before dropping
+     * @param blastRadius Area hit where it stops (0 = the victim only)
+     * @return Slot of the new projectile
+     */
+    uint32_t spawn(Kind kind, double x, double y, double aimX, double aimY,
+                   double speed, double range, int damage, const GameObject* owner,
+                   double blastRadius = 0.0);
+
+    /**
+     * Remove every projectile
+     */
+    void clear();
+
+    /**
+     * Publish a ProjectileExpiredEvent for every impact / drop
+     * @param bus Event bus (nullptr = no events)
+     */
+    void setEventBus(EventBus* bus);
+
+
+    // ========== SIMULATION ==========
+
+    /**
+     * Fly every projectile one turn
+     * @param grid Objects that can be hit (broad phase), already built
+     * @return What hit or dropped this turn (valid until the next update)
+     */
+    const std::vector<Impact>& update(const SpatialGrid& grid);
+
+
+    // ========== ACCESS ==========
+
+    size_t getLiveCount() const;
+
+    /**
+     * Number of slots (live or free); iterate 0..getSlotCount() with isLive()
+     */
+    size_t getSlotCount() const;
+
+    bool isLive(uint32_t slot) const;
+    double getX(uint32_t slot) const;
+    double getY(uint32_t slot) const;
+    int getDamage(uint32_t slot) const;
+    Kind getKind(uint32_t slot) const;
+
+    static const char* getKindName(Kind kind);
+
+    /**
+     * Print every projectile in flight (same style as the GameObjects)
+     */
+    void drawAll() const;
+
+private:
+    void release(uint32_t slot);
+};
+
+#endif // PROJECTILESYSTEM_HPP
@@ -0,0 +1,173 @@
+#include "Random.hpp"
+#include <cmath>
+
+namespace {
+
+    const double PI = 3.14159265358979323846;
+
+    uint64_t splitMix(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * 64 x 64 -> 128 bits product, as (high, low)
+     */
+    void multiplyWide(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low) {
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        high = static_cast<uint64_t>(product >> 64);
+        low = static_cast<uint64_t>(product);
+#else
+        uint64_t aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+        uint64_t bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+        uint64_t lowLow = aLow * bLow;
+        uint64_t middle1 = aHigh * bLow + (lowLow >> 32);
+        uint64_t middle2 = aLow * bHigh + (middle1 & 0xFFFFFFFFULL);
+        high = aHigh * bHigh + (middle1 >> 32) + (middle2 >> 32);
+        low = (middle2 << 32) | (lowLow & 0xFFFFFFFFULL);
+#endif
+    }
+
+    // xoshiro256 jump polynomials (from the reference implementation)
+    const uint64_t JUMP[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+    const uint64_t LONG_JUMP[4] = {
+        0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+    };
+
+    // Philox2x64 constants (Salmon et al., Random123)
+    const uint64_t PHILOX_MULTIPLIER = 0xD2B74407B1CE6E93ULL;
+    const uint64_t PHILOX_WEYL = 0x9E3779B97F4A7C15ULL;
+    const int PHILOX_ROUNDS = 10;
+}
+
+
+// ========== SEEDING ==========
+
+Rng::Rng(uint64_t seed) {
+    this->seed(seed);
+}
+
+/**
+ * splitmix64 expansion: never gives the all-zero state xoshiro cannot
+ * leave, and close seeds still give unrelated states
+ */
+void Rng::seed(uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        state[i] = splitMix(seed);
+    }
+}
+
+Rng Rng::forStream(uint64_t seed, uint64_t stream) {
+    uint64_t mixer = stream;
+    return Rng(seed ^ splitMix(mixer));
+}
+
+void Rng::applyJump(const uint64_t (&polynomial)[4]) {
+    uint64_t result[4] = { 0, 0, 0, 0 };
+    for (int word = 0; word < 4; word++) {
+        for (int bit = 0; bit < 64; bit++) {
+            if (polynomial[word] & (static_cast<uint64_t>(1) << bit)) {
+                for (int i = 0; i < 4; i++) {
+                    result[i] ^= state[i];
+                }
+            }
+            next();
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        state[i] = result[i];
+    }
+}
+
+void Rng::jump() {
+    applyJump(JUMP);
+}
+
+void Rng::longJump() {
+    applyJump(LONG_JUMP);
+}
+
+
+// ========== NUMBERS ==========
+
+/**
+ * Lemire's multiply-shift: the high half of next() * bound is uniform
+ * once the few low halves below (2^64 mod bound) are rejected
+ */
+uint64_t Rng::below(uint64_t bound) {
+    uint64_t high, low;
+    multiplyWide(next(), bound, high, low);
+    if (low < bound) {
+        const uint64_t threshold = (0 - bound) % bound;
+        while (low < threshold) {
+            multiplyWide(next(), bound, high, low);
+        }
+    }
+    return high;
+}
+
+double Rng::normal() {
+    double u = 1.0 - uniform();  // (0, 1]: log(0) is not an option
+    return std::sqrt(-2.0 * std::log(u)) * std::cos(2.0 * PI * uniform());
+}
+
+
+// ========== BATCHES ==========
+
+void Rng::fill(uint64_t* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = next();
+    }
+}
+
+void Rng::fillUniform(double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = toUnit(next());
+    }
+}
+
+
+// ========== COUNTER-BASED ==========
+
+/**
+ * Ten rounds of: (high, low) = M * c0; c0 = high ^ key ^ c1; c1 = low;
+ * the key gets a Weyl increment between rounds
+ */
+CounterRng::Block CounterRng::philox(uint64_t key, uint64_t stream, uint64_t counter) {
+    uint64_t c0 = counter, c1 = stream;
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        if (round > 0) {
+            key += PHILOX_WEYL;
+        }
+        uint64_t high, low;
+        multiplyWide(PHILOX_MULTIPLIER, c0, high, low);
+        c0 = high ^ key ^ c1;
+        c1 = low;
+    }
+    return Block{ c0, c1 };
+}
+
+void CounterRng::fillUniform(uint64_t key, uint64_t stream, uint64_t first, double* out, size_t count,
+                             VectorBulk::Execution execution) {
+    auto body = [=](size_t, size_t begin, size_t end) {
+        size_t i = begin;
+        if (i < end && ((first + i) & 1)) {
+            out[i] = uniformAt(key, stream, first + i);  // Odd start: second half of a block
+            i++;
+        }
+        for (; i + 2 <= end; i += 2) {
+            Block block = philox(key, stream, (first + i) >> 1);
+            out[i] = Rng::toUnit(block.first);
+            out[i + 1] = Rng::toUnit(block.second);
+        }
+        if (i < end) {
+            out[i] = uniformAt(key, stream, first + i);
+        }
+    };
+    VectorBulk::Detail::forChunks(count, execution, body);
+}
@@ -0,0 +1,173 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include "VectorBulk.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Random - The engine's random numbers (no rand(), no shared state)
+ *
+ * Two generators, both fully reproducible from an explicit seed:
+ *
+ * Rng (xoshiro256**): a small object (32 bytes) with its own state, one
+ * per user. Each thread / session / region owns one; nothing is shared,
+ * so nothing is locked. Independent streams:
+ *   - Rng::forStream(seed, n): stream n of a seed (hashed state)
+ *   - jump(): skip 2^128 numbers, for non-overlapping sub-sequences
+ *     of one stream (longJump: 2^192)
+ *
+ * CounterRng (Philox2x64-10): NO state at all. Number i of stream s
+ * under key k is a pure function philox(k, s, i). Any thread can
+ * compute any part of a sequence, so a parallel fill gives exactly
+ * the serial result whatever the split.
+ *
+ * Rule for reproducible parallel code: tie randomness to the WORK
+ * (region, entity, turn), never to the thread that happens to run it.
+ *
+ * Conversions are written out here (no std:: distributions, which are
+ * allowed to differ between standard libraries).
+ */
+class Rng {
+public:
+    typedef uint64_t result_type;  // Usable as a UniformRandomBitGenerator (std::shuffle...)
+
+private:
+    uint64_t state[4];
+
+public:
+    // ========== SEEDING ==========
+
+    /**
+     * @param seed Any value (expanded into 256 bits by splitmix64)
+     */
+    explicit Rng(uint64_t seed);
+
+    void seed(uint64_t seed);
+
+    /**
+     * Independent stream 'stream' of 'seed' (per region, per entity...)
+     */
+    static Rng forStream(uint64_t seed, uint64_t stream);
+
+    /**
+     * Advance by 2^128 (jump) / 2^192 (longJump) numbers: copies of one
+     * generator, each jumped once more than the previous one, never
+     * overlap
+     */
+    void jump();
+    void longJump();
+
+
+    // ========== NUMBERS ==========
+
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return ~static_cast<uint64_t>(0); }
+
+    /**
+     * Next 64 random bits
+     */
+    uint64_t next() {
+        const uint64_t result = rotate(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate(state[3], 45);
+        return result;
+    }
+
+    uint64_t operator()() { return next(); }
+
+    /**
+     * Uniform double in [0, 1) (53 random bits)
+     */
+    double uniform() {
+        return toUnit(next());
+    }
+
+    /**
+     * Uniform double in [low, high)
+     */
+    double uniform(double low, double high) {
+        return low + (high - low) * uniform();
+    }
+
+    /**
+     * Uniform integer in [0, bound) without modulo bias (Lemire)
+     * @pre bound > 0
+     */
+    uint64_t below(uint64_t bound);
+
+    /**
+     * true with probability p
+     */
+    bool chance(double p) {
+        return uniform() < p;
+    }
+
+    /**
+     * Standard normal value (Box-Muller)
+     */
+    double normal();
+
+
+    // ========== BATCHES ==========
+
+    /**
+     * out[0..count) = the next 'count' numbers (same as 'count' calls)
+     */
+    void fill(uint64_t* out, size_t count);
+    void fillUniform(double* out, size_t count);
+
+    /**
+     * 64 random bits -> [0, 1)
+     */
+    static double toUnit(uint64_t bits) {
+        return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    static uint64_t rotate(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    void applyJump(const uint64_t (&polynomial)[4]);
+};
+
+
+namespace CounterRng {
+
+    /**
+     * Philox2x64-10: 128 random bits for block 'counter' of 'stream'
+     */
+    struct Block {
+        uint64_t first;
+        uint64_t second;
+    };
+
+    Block philox(uint64_t key, uint64_t stream, uint64_t counter);
+
+    /**
+     * Number 'index' of a stream (two numbers per block)
+     */
+    inline uint64_t at(uint64_t key, uint64_t stream, uint64_t index) {
+        Block block = philox(key, stream, index >> 1);
+        return (index & 1) ? block.second : block.first;
+    }
+
+    inline double uniformAt(uint64_t key, uint64_t stream, uint64_t index) {
+        return Rng::toUnit(at(key, stream, index));
+    }
+
+    /**
+     * out[i] = uniformAt(key, stream, first + i): identical results
+     * with SEQUENTIAL and PARALLEL
+     */
+    void fillUniform(uint64_t key, uint64_t stream, uint64_t first, double* out, size_t count,
+                     VectorBulk::Execution execution = VectorBulk::Execution::SEQUENTIAL);
+}
+
+#endif // RANDOM_HPP
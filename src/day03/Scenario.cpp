@@ -0,0 +1,561 @@
+#include "Scenario.hpp"
+#include "WeaponTable.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    // ========== BINARY LAYOUT ==========
+
+    const char MAGIC[4] = { 'C', 'Q', 'S', 'B' };
+    const uint32_t VERSION = 1;
+    const size_t MAX_NAME_LENGTH = 65535;   // Stored as uint16
+    const size_t MAX_RECORD_SIZE = 32;      // Largest payload (enemy: 28 bytes)
+
+    /**
+     * Record tags: one byte, then a fixed-size payload
+     */
+    enum Tag : uint8_t {
+        TAG_END = 0,        // -
+        TAG_NAME = 1,       // uint16 length, bytes  (next string table index)
+        TAG_RESERVE = 2,    // uint64 entities
+        TAG_RULE = 3,       // uint8 rule, double value
+        TAG_WEAPON = 4,     // uint32 name, int32 range, int32 power, uint8 style
+        TAG_PLAYER = 5,     // uint32 name, double x, double y, int32 health
+        TAG_ENEMY = 6,      // uint32 name, double x, double y, int32 health, int32 damage
+        TAG_DECOR = 7       // uint32 name, double x, double y
+    };
+
+    /**
+     * Append / take one field of a payload (memcpy: no alignment needed)
+     */
+    template<typename T>
+    void put(unsigned char*& cursor, T value) {
+        std::memcpy(cursor, &value, sizeof(T));
+        cursor += sizeof(T);
+    }
+
+    template<typename T>
+    T take(const unsigned char*& cursor) {
+        T value;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+
+    // ========== TEXT TOKENS ==========
+
+    /**
+     * Position in the current line (no copy of the line)
+     */
+    struct LineCursor {
+        const char* pos;
+        const char* end;
+    };
+
+    void skipSpaces(LineCursor& cursor) {
+        while (cursor.pos < cursor.end && (*cursor.pos == ' ' || *cursor.pos == '\t')) {
+            cursor.pos++;
+        }
+    }
+
+    bool atEnd(LineCursor& cursor) {
+        skipSpaces(cursor);
+        return cursor.pos == cursor.end;
+    }
+
+    bool isSeparator(const char* pos, const char* end) {
+        return pos == end || *pos == ' ' || *pos == '\t';
+    }
+
+    /**
+     * Next word, or "quoted words" (reuses out's buffer)
+     */
+    bool nextWord(LineCursor& cursor, std::string& out) {
+        if (atEnd(cursor)) {
+            return false;
+        }
+        const char* start = cursor.pos;
+        if (*start == '"') {
+            const char* close = static_cast<const char*>(std::memchr(start + 1, '"', cursor.end - start - 1));
+            if (!close || !isSeparator(close + 1, cursor.end)) {
+                return false;
+            }
+            out.assign(start + 1, close);
+            cursor.pos = close + 1;
+            return !out.empty();
+        }
+        while (!isSeparator(cursor.pos, cursor.end)) {
+            cursor.pos++;
+        }
+        out.assign(start, cursor.pos);
+        return true;
+    }
+
+    template<typename T>
+    bool nextNumber(LineCursor& cursor, T& value) {
+        if (atEnd(cursor)) {
+            return false;
+        }
+        std::from_chars_result result = std::from_chars(cursor.pos, cursor.end, value);
+        if (result.ec != std::errc() || !isSeparator(result.ptr, cursor.end)) {
+            return false;
+        }
+        cursor.pos = result.ptr;
+        return true;
+    }
+
+    bool nextCoordinates(LineCursor& cursor, double& x, double& y) {
+        return nextNumber(cursor, x) && nextNumber(cursor, y) && std::isfinite(x) && std::isfinite(y);
+    }
+
+    /**
+     * End of the statement: '#' starts a comment (outside quotes)
+     */
+    const char* statementEnd(const std::string& line) {
+        bool quoted = false;
+        for (size_t i = 0; i < line.size(); i++) {
+            if (line[i] == '"') {
+                quoted = !quoted;
+            } else if (line[i] == '#' && !quoted) {
+                return line.data() + i;
+            }
+        }
+        size_t size = line.size();
+        if (size > 0 && line[size - 1] == '\r') {
+            size--;  // CRLF files
+        }
+        return line.data() + size;
+    }
+
+    bool parseRule(const std::string& text, ScenarioRule& rule) {
+        if (text == "max_turns") {
+            rule = ScenarioRule::MAX_TURNS;
+        } else if (text == "arrow_speed") {
+            rule = ScenarioRule::ARROW_SPEED;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    [[noreturn]] void fail(const char* what, size_t number, const char* message) {
+        throw std::runtime_error(std::string("scenario: ") + what + " " + std::to_string(number)
+                                 + ": " + message);
+    }
+
+
+    // ========== BINARY READING ==========
+
+    void readExact(std::istream& in, void* data, size_t size, size_t record) {
+        if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+            fail("record", record, "truncated file");
+        }
+    }
+
+    /**
+     * Same rule as the text form (nextCoordinates): no NaN or infinity
+     */
+    void checkCoordinates(double x, double y, size_t record) {
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            fail("record", record, "coordinates are not finite numbers");
+        }
+    }
+
+    /**
+     * Records after the header
+     */
+    void readBinaryBody(std::istream& in, ScenarioSink& sink) {
+        uint32_t version;
+        readExact(in, &version, sizeof(version), 0);
+        if (version != VERSION) {
+            fail("record", 0, "unsupported version");
+        }
+        
+        std::vector<std::string> names;   // String table (one entry per distinct name)
+        unsigned char payload[MAX_RECORD_SIZE];
+        
+        for (size_t record = 1; ; record++) {
+            unsigned char tag;
+            readExact(in, &tag, 1, record);
+            const unsigned char* cursor = payload;
+            
+            // Checked name reference
+            auto name = [&](uint32_t id) -> const std::string& {
+                if (id >= names.size()) {
+                    fail("record", record, "unknown name index");
+                }
+                return names[id];
+            };
+            
+            switch (tag) {
+                case TAG_END:
+                    return;
+                case TAG_NAME: {
+                    uint16_t length;
+                    readExact(in, &length, sizeof(length), record);
+                    names.emplace_back(length, '\0');
+                    readExact(in, &names.back()[0], length, record);
+                    break;
+                }
+                case TAG_RESERVE:
+                    readExact(in, payload, 8, record);
+                    sink.onReserve(static_cast<size_t>(take<uint64_t>(cursor)));
+                    break;
+                case TAG_RULE: {
+                    readExact(in, payload, 9, record);
+                    uint8_t rule = take<uint8_t>(cursor);
+                    if (rule > static_cast<uint8_t>(ScenarioRule::ARROW_SPEED)) {
+                        fail("record", record, "unknown rule");
+                    }
+                    double value = take<double>(cursor);
+                    if (!std::isfinite(value)) {
+                        fail("record", record, "rule value is not a finite number");
+                    }
+                    sink.onRule(static_cast<ScenarioRule>(rule), value);
+                    break;
+                }
+                case TAG_WEAPON: {
+                    readExact(in, payload, 13, record);
+                    const std::string& weaponName = name(take<uint32_t>(cursor));
+                    int32_t range = take<int32_t>(cursor);
+                    int32_t power = take<int32_t>(cursor);
+                    uint8_t style = take<uint8_t>(cursor);
+                    if (style > static_cast<uint8_t>(AttackStyle::SLASH)) {
+                        fail("record", record, "unknown attack style");
+                    }
+                    if (range < 0 || power < 0) {
+                        fail("record", record, "negative weapon range or power");
+                    }
+                    sink.onWeapon(weaponName, range, power, static_cast<AttackStyle>(style));
+                    break;
+                }
+                case TAG_PLAYER: {
+                    readExact(in, payload, 24, record);
+                    const std::string& playerName = name(take<uint32_t>(cursor));
+                    double x = take<double>(cursor);
+                    double y = take<double>(cursor);
+                    checkCoordinates(x, y, record);
+                    sink.onPlayer(playerName, x, y, take<int32_t>(cursor));
+                    break;
+                }
+                case TAG_ENEMY: {
+                    readExact(in, payload, 28, record);
+                    const std::string& enemyName = name(take<uint32_t>(cursor));
+                    double x = take<double>(cursor);
+                    double y = take<double>(cursor);
+                    checkCoordinates(x, y, record);
+                    int32_t health = take<int32_t>(cursor);
+                    sink.onEnemy(enemyName, x, y, health, take<int32_t>(cursor));
+                    break;
+                }
+                case TAG_DECOR: {
+                    readExact(in, payload, 20, record);
+                    const std::string& decorName = name(take<uint32_t>(cursor));
+                    double x = take<double>(cursor);
+                    double y = take<double>(cursor);
+                    checkCoordinates(x, y, record);
+                    sink.onDecor(decorName, x, y);
+                    break;
+                }
+                default:
+                    fail("record", record, "unknown record type");
+            }
+        }
+    }
+}
+
+
+// ========== BINARY WRITER ==========
+
+BinaryScenarioWriter::BinaryScenarioWriter(std::ostream& out)
+    : out(out)
+{
+    out.write(MAGIC, sizeof(MAGIC));
+    out.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+}
+
+/**
+ * Index of a name in the string table (written on first use)
+ */
+uint32_t BinaryScenarioWriter::nameId(const std::string& name) {
+    auto found = nameIds.find(name);
+    if (found != nameIds.end()) {
+        return found->second;
+    }
+    if (name.size() > MAX_NAME_LENGTH) {
+        throw std::runtime_error("scenario: name too long: " + name.substr(0, 32) + "...");
+    }
+    uint32_t id = static_cast<uint32_t>(nameIds.size());
+    nameIds.emplace(name, id);
+    
+    char tag = TAG_NAME;
+    uint16_t length = static_cast<uint16_t>(name.size());
+    out.put(tag);
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.write(name.data(), length);
+    return id;
+}
+
+void BinaryScenarioWriter::onReserve(size_t entities) {
+    unsigned char payload[MAX_RECORD_SIZE];
+    unsigned char* cursor = payload;
+    put<uint8_t>(cursor, TAG_RESERVE);
+    put<uint64_t>(cursor, entities);
+    out.write(reinterpret_cast<const char*>(payload), cursor - payload);
+}
+
+void BinaryScenarioWriter::onRule(ScenarioRule rule, double value) {
+    unsigned char payload[MAX_RECORD_SIZE];
+    unsigned char* cursor = payload;
+    put<uint8_t>(cursor, TAG_RULE);
+    put<uint8_t>(cursor, static_cast<uint8_t>(rule));
+    put<double>(cursor, value);
+    out.write(reinterpret_cast<const char*>(payload), cursor - payload);
+}
+
+void BinaryScenarioWriter::onWeapon(const std::string& name, int range, int power, AttackStyle style) {
+    uint32_t id = nameId(name);
+    unsigned char payload[MAX_RECORD_SIZE];
+    unsigned char* cursor = payload;
+    put<uint8_t>(cursor, TAG_WEAPON);
+    put<uint32_t>(cursor, id);
+    put<int32_t>(cursor, range);
+    put<int32_t>(cursor, power);
+    put<uint8_t>(cursor, static_cast<uint8_t>(style));
+    out.write(reinterpret_cast<const char*>(payload), cursor - payload);
+}
+
+void BinaryScenarioWriter::onPlayer(const std::string& name, double x, double y, int health) {
+    uint32_t id = nameId(name);
+    unsigned char payload[MAX_RECORD_SIZE];
+    unsigned char* cursor = payload;
+    put<uint8_t>(cursor, TAG_PLAYER);
+    put<uint32_t>(cursor, id);
+    put<double>(cursor, x);
+    put<double>(cursor, y);
+    put<int32_t>(cursor, health);
+    out.write(reinterpret_cast<const char*>(payload), cursor - payload);
+}
+
+void BinaryScenarioWriter::onEnemy(const std::string& name, double x, double y, int health, int damage) {
+    uint32_t id = nameId(name);
+    unsigned char payload[MAX_RECORD_SIZE];
+    unsigned char* cursor = payload;
+    put<uint8_t>(cursor, TAG_ENEMY);
+    put<uint32_t>(cursor, id);
+    put<double>(cursor, x);
+    put<double>(cursor, y);
+    put<int32_t>(cursor, health);
+    put<int32_t>(cursor, damage);
+    out.write(reinterpret_cast<const char*>(payload), cursor - payload);
+}
+
+void BinaryScenarioWriter::onDecor(const std::string& name, double x, double y) {
+    uint32_t id = nameId(name);
+    unsigned char payload[MAX_RECORD_SIZE];
+    unsigned char* cursor = payload;
+    put<uint8_t>(cursor, TAG_DECOR);
+    put<uint32_t>(cursor, id);
+    put<double>(cursor, x);
+    put<double>(cursor, y);
+    out.write(reinterpret_cast<const char*>(payload), cursor - payload);
+}
+
+void BinaryScenarioWriter::finish() {
+    out.put(static_cast<char>(TAG_END));
+}
+
+
+// ========== TEXT WRITER ==========
+
+TextScenarioWriter::TextScenarioWriter(std::ostream& out)
+    : out(out)
+{
+}
+
+void TextScenarioWriter::writeName(const std::string& name) {
+    if (name.empty() || name.find('"') != std::string::npos || name.find('#') != std::string::npos
+        || name.find('\n') != std::string::npos) {
+        throw std::runtime_error("scenario: name cannot be written as text: " + name.substr(0, 32));
+    }
+    out << ' ';
+    if (name.find(' ') != std::string::npos || name.find('\t') != std::string::npos) {
+        out << '"' << name << '"';
+    } else {
+        out << name;
+    }
+}
+
+void TextScenarioWriter::writeNumber(double value) {
+    char buffer[32];
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out << ' ';
+    out.write(buffer, result.ptr - buffer);
+}
+
+void TextScenarioWriter::onReserve(size_t entities) {
+    out << "entities " << entities << '\n';
+}
+
+void TextScenarioWriter::onRule(ScenarioRule rule, double value) {
+    out << "rule " << Scenario::getRuleName(rule);
+    writeNumber(value);
+    out << '\n';
+}
+
+void TextScenarioWriter::onWeapon(const std::string& name, int range, int power, AttackStyle style) {
+    out << "weapon";
+    writeName(name);
+    out << ' ' << range << ' ' << power << ' ' << WeaponTable::getStyleName(style) << '\n';
+}
+
+void TextScenarioWriter::onPlayer(const std::string& name, double x, double y, int health) {
+    out << "player";
+    writeName(name);
+    writeNumber(x);
+    writeNumber(y);
+    out << ' ' << health << '\n';
+}
+
+void TextScenarioWriter::onEnemy(const std::string& name, double x, double y, int health, int damage) {
+    out << "enemy";
+    writeName(name);
+    writeNumber(x);
+    writeNumber(y);
+    out << ' ' << health << ' ' << damage << '\n';
+}
+
+void TextScenarioWriter::onDecor(const std::string& name, double x, double y) {
+    out << "decor";
+    writeName(name);
+    writeNumber(x);
+    writeNumber(y);
+    out << '\n';
+}
+
+
+// ========== READERS ==========
+
+/**
+ * Text form: one statement per line
+ * 
+ * One getline buffer and a few token buffers, reused for every line:
+ * after the first lines, parsing allocates nothing.
+ */
+void Scenario::readText(std::istream& in, ScenarioSink& sink) {
+    std::string line, keyword, name, extra;
+    size_t lineNumber = 0;
+    
+    while (std::getline(in, line)) {
+        lineNumber++;
+        LineCursor cursor{ line.data(), statementEnd(line) };
+        if (!nextWord(cursor, keyword)) {
+            if (!atEnd(cursor)) {
+                fail("line", lineNumber, "unterminated quote");
+            }
+            continue;  // Blank or comment-only line
+        }
+        
+        double x, y;
+        int health, damage;
+        bool valid;
+        
+        if (keyword == "enemy") {
+            valid = nextWord(cursor, name) && nextCoordinates(cursor, x, y)
+                 && nextNumber(cursor, health) && nextNumber(cursor, damage) && atEnd(cursor);
+            if (!valid) {
+                fail("line", lineNumber, "expected 'enemy name x y health damage'");
+            }
+            sink.onEnemy(name, x, y, health, damage);
+        } else if (keyword == "decor") {
+            valid = nextWord(cursor, name) && nextCoordinates(cursor, x, y) && atEnd(cursor);
+            if (!valid) {
+                fail("line", lineNumber, "expected 'decor name x y'");
+            }
+            sink.onDecor(name, x, y);
+        } else if (keyword == "player") {
+            valid = nextWord(cursor, name) && nextCoordinates(cursor, x, y)
+                 && nextNumber(cursor, health) && atEnd(cursor);
+            if (!valid) {
+                fail("line", lineNumber, "expected 'player name x y health'");
+            }
+            sink.onPlayer(name, x, y, health);
+        } else if (keyword == "weapon") {
+            int range, power;
+            AttackStyle style;
+            valid = nextWord(cursor, name) && nextNumber(cursor, range) && nextNumber(cursor, power)
+                 && nextWord(cursor, extra) && WeaponTable::parseStyle(extra, style) && atEnd(cursor)
+                 && range >= 0 && power >= 0;
+            if (!valid) {
+                fail("line", lineNumber, "expected 'weapon name range power shot|thrust|slash'");
+            }
+            sink.onWeapon(name, range, power, style);
+        } else if (keyword == "rule") {
+            ScenarioRule rule;
+            double value;
+            valid = nextWord(cursor, extra) && parseRule(extra, rule) && nextNumber(cursor, value)
+                 && std::isfinite(value) && atEnd(cursor);
+            if (!valid) {
+                fail("line", lineNumber, "expected 'rule max_turns|arrow_speed value'");
+            }
+            sink.onRule(rule, value);
+        } else if (keyword == "entities") {
+            unsigned long long count;
+            if (!nextNumber(cursor, count) || !atEnd(cursor)) {
+                fail("line", lineNumber, "expected 'entities count'");
+            }
+            sink.onReserve(static_cast<size_t>(count));
+        } else {
+            fail("line", lineNumber, "unknown statement");
+        }
+    }
+}
+
+void Scenario::readBinary(std::istream& in, ScenarioSink& sink) {
+    char magic[sizeof(MAGIC)];
+    readExact(in, magic, sizeof(magic), 0);
+    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        fail("record", 0, "not a compiled scenario");
+    }
+    readBinaryBody(in, sink);
+}
+
+void Scenario::read(std::istream& in, ScenarioSink& sink) {
+    std::istream::pos_type start = in.tellg();
+    char magic[sizeof(MAGIC)];
+    if (in.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0) {
+        readBinaryBody(in, sink);
+        return;
+    }
+    in.clear();
+    in.seekg(start);
+    readText(in, sink);
+}
+
+bool Scenario::loadFile(const std::string& path, ScenarioSink& sink) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    read(file, sink);
+    return true;
+}
+
+void Scenario::compile(std::istream& text, std::ostream& binary) {
+    BinaryScenarioWriter writer(binary);
+    readText(text, writer);
+    writer.finish();
+}
+
+const char* Scenario::getRuleName(ScenarioRule rule) {
+    switch (rule) {
+        case ScenarioRule::MAX_TURNS: return "max_turns";
+        default:                      return "arrow_speed";
+    }
+}
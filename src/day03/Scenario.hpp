@@ -0,0 +1,164 @@
+#ifndef SCENARIO_HPP
+#define SCENARIO_HPP
+
+#include "Weapon.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Scenario - What a game starts with: weapons, rules, player, enemies,
+ * decor
+ *
+ * Two forms of the same content:
+ *
+ * TEXT (for authoring, data/campus.scenario), one statement per line:
+ *
+ *   # comment
+ *   entities 7                      optional size hint (reserve)
+ *   rule max_turns 50               rule <name> <value>
+ *   weapon Bow 4 1 shot             weapon <name> <range> <power> <style>
+ *   player Hero 0 0 80              player <name> <x> <y> <health>
+ *   enemy Goblin 5 0 25 6           enemy <name> <x> <y> <health> <damage>
+ *   decor "Ancient Tree" 3 3        decor <name> <x> <y>
+ *
+ *   Names with spaces go between double quotes. The player must come
+ *   before the enemies (they target it); the first enemy is the
+ *   player's first target. Weapon lines replace the weapon table.
+ *
+ * BINARY (compiled, "CQSB" magic, see compile()): the same statements
+ * as fixed-size records, names stored once in a string table and then
+ * referenced by index. Host byte order: compile on the machine that
+ * plays.
+ *
+ * Loading is STREAMING: the reader never builds a list of entities, it
+ * calls a ScenarioSink for each statement as soon as it is parsed (the
+ * Game's sink creates the object right away). The reader reuses one
+ * line buffer and one name buffer, so parsing itself does not allocate
+ * per entity. Errors throw std::runtime_error with the line (text) or
+ * record (binary) number.
+ */
+
+/**
+ * Rules a scenario can override
+ */
+enum class ScenarioRule : uint8_t {
+    MAX_TURNS,      // Turn limit (draw after that)
+    ARROW_SPEED     // Units per turn of fired arrows
+};
+
+/**
+ * Receives the statements of a scenario, in file order
+ */
+class ScenarioSink {
+public:
+    virtual ~ScenarioSink() {}
+
+    /**
+     * Size hint: about 'entities' objects follow (optional)
+     */
+    virtual void onReserve(size_t entities) { (void)entities; }
+
+    virtual void onRule(ScenarioRule rule, double value) = 0;
+    virtual void onWeapon(const std::string& name, int range, int power, AttackStyle style) = 0;
+    virtual void onPlayer(const std::string& name, double x, double y, int health) = 0;
+    virtual void onEnemy(const std::string& name, double x, double y, int health, int damage) = 0;
+    virtual void onDecor(const std::string& name, double x, double y) = 0;
+};
+
+/**
+ * BinaryScenarioWriter - A sink that writes the compiled form
+ *
+ * Feed it with readText() (see Scenario::compile) or directly from code
+ * (map generators). Call finish() once at the end.
+ */
+class BinaryScenarioWriter : public ScenarioSink {
+private:
+    std::ostream& out;
+    std::unordered_map<std::string, uint32_t> nameIds;  // String table so far
+
+public:
+    explicit BinaryScenarioWriter(std::ostream& out);
+
+    void onReserve(size_t entities) override;
+    void onRule(ScenarioRule rule, double value) override;
+    void onWeapon(const std::string& name, int range, int power, AttackStyle style) override;
+    void onPlayer(const std::string& name, double x, double y, int health) override;
+    void onEnemy(const std::string& name, double x, double y, int health, int damage) override;
+    void onDecor(const std::string& name, double x, double y) override;
+
+    /**
+     * Write the end marker (the reader stops there)
+     */
+    void finish();
+
+private:
+    uint32_t nameId(const std::string& name);
+};
+
+/**
+ * TextScenarioWriter - A sink that writes the text form
+ *
+ * Numbers are written in their shortest exact form (reading the file
+ * back gives the same doubles), names with spaces between quotes.
+ */
+class TextScenarioWriter : public ScenarioSink {
+private:
+    std::ostream& out;
+
+public:
+    explicit TextScenarioWriter(std::ostream& out);
+
+    void onReserve(size_t entities) override;
+    void onRule(ScenarioRule rule, double value) override;
+    void onWeapon(const std::string& name, int range, int power, AttackStyle style) override;
+    void onPlayer(const std::string& name, double x, double y, int health) override;
+    void onEnemy(const std::string& name, double x, double y, int health, int damage) override;
+    void onDecor(const std::string& name, double x, double y) override;
+
+private:
+    void writeName(const std::string& name);
+    void writeNumber(double value);
+};
+
+namespace Scenario {
+
+    /**
+     * Parse the text form
+     * @throws std::runtime_error on a malformed line
+     */
+    void readText(std::istream& in, ScenarioSink& sink);
+
+    /**
+     * Parse the binary form (header included)
+     * @throws std::runtime_error on a truncated or malformed file
+     */
+    void readBinary(std::istream& in, ScenarioSink& sink);
+
+    /**
+     * Read either form (detected from the first bytes)
+     */
+    void read(std::istream& in, ScenarioSink& sink);
+
+    /**
+     * Open and read a scenario file (text or binary)
+     * @return false if the file cannot be opened
+     * @throws std::runtime_error on malformed content
+     */
+    bool loadFile(const std::string& path, ScenarioSink& sink);
+
+    /**
+     * Text form -> binary form
+     */
+    void compile(std::istream& text, std::ostream& binary);
+
+    /**
+     * Rule name in the text form ("max_turns"...)
+     */
+    const char* getRuleName(ScenarioRule rule);
+}
+
+#endif // SCENARIO_HPP
@@ -0,0 +1,95 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+
+// ========== CONSTRUCTOR ==========
+
+SpatialGrid::SpatialGrid(double cellSize, int bucketBits)
+    : cellSize(cellSize),
+      inverseCellSize(1.0 / cellSize),
+      bucketMask((1u << bucketBits) - 1),
+      bucketStart((static_cast<size_t>(1) << bucketBits) + 1, 0),
+      maxRadius(0.0)
+{
+}
+
+
+// ========== BUILDING ==========
+
+void SpatialGrid::reserve(size_t capacity) {
+    pending.reserve(capacity);
+    entries.reserve(capacity);
+    bucketOf.reserve(capacity);
+}
+
+void SpatialGrid::clear() {
+    pending.clear();
+    entries.clear();
+    maxRadius = 0.0;
+}
+
+void SpatialGrid::insert(GameObject* object, double x, double y, double radius,
+                         uint8_t layer, uint8_t mask) {
+    pending.push_back(Entry{ x, y, object, static_cast<float>(radius), layer, mask });
+    maxRadius = std::max(maxRadius, radius);
+}
+
+/**
+ * Counting sort by bucket
+ *
+ * 1. Count the entries of each bucket
+ * 2. Prefix sum: bucketStart[b] = first slot of bucket b
+ * 3. Scatter each entry to its slot (stable: insertion order kept
+ *    inside a bucket)
+ */
+void SpatialGrid::build() {
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+    bucketOf.resize(pending.size());
+    for (size_t i = 0; i < pending.size(); i++) {
+        bucketOf[i] = bucketIndex(cellCoord(pending[i].x), cellCoord(pending[i].y));
+        bucketStart[bucketOf[i] + 1]++;
+    }
+    for (size_t b = 1; b < bucketStart.size(); b++) {
+        bucketStart[b] += bucketStart[b - 1];
+    }
+
+    entries.resize(pending.size());
+    for (size_t i = 0; i < pending.size(); i++) {
+        // bucketStart[b] is used as the write cursor of bucket b...
+        entries[bucketStart[bucketOf[i]]++] = pending[i];
+    }
+    // ...so it now holds the END of bucket b: shift up by one
+    for (size_t b = bucketStart.size() - 1; b > 0; b--) {
+        bucketStart[b] = bucketStart[b - 1];
+    }
+    bucketStart[0] = 0;
+}
+
+
+// ========== QUERIES ==========
+
+size_t SpatialGrid::size() const {
+    return entries.size();
+}
+
+double SpatialGrid::getCellSize() const {
+    return cellSize;
+}
+
+size_t SpatialGrid::getBucketCount() const {
+    return static_cast<size_t>(bucketMask) + 1;
+}
+
+
+// ========== PRIVATE HELPERS ==========
+
+int SpatialGrid::cellCoord(double value) const {
+    return static_cast<int>(std::floor(value * inverseCellSize));
+}
+
+/**
+ * Hash of a cell (two large primes, as in Teschner et al. 2003)
+ */
+uint32_t SpatialGrid::bucketIndex(int cx, int cy) const {
+    uint32_t h = (static_cast<uint32_t>(cx) * 73856093u) ^ (static_cast<uint32_t>(cy) * 19349663u);
+    return h & bucketMask;
+}
@@ -0,0 +1,179 @@
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include "CollisionShape.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+
+/**
+ * SpatialGrid - Uniform hash grid over circles (broad phase)
+ *
+ * Answers "which objects are near this box?" without looking at every
+ * object. The world is cut into square cells of 'cellSize' units; each
+ * entry goes into the cell of its center. Cells are hashed into a fixed
+ * number of buckets, so the world needs no bounds.
+ *
+ * Rebuilt from scratch every turn (insert everything, then build()):
+ * the entries are sorted by bucket with a counting sort into one flat
+ * array (bucketStart[b] .. bucketStart[b + 1]), so a query reads
+ * contiguous memory and a rebuild never allocates once the buffers are
+ * reserved.
+ *
+ * Queries are conservative: the box is grown by the largest radius, so
+ * every circle that touches the box is visited. Some visited entries do
+ * not touch it (same bucket, other cell): the caller runs the exact
+ * test (narrow phase), e.g. Geometry::sweepCircle.
+ *
+ * Each entry carries its collision layer and mask (CollisionLayer): a
+ * filtered query drops entries that cannot interact with the querying
+ * layer before calling the visitor, so they cost no distance math.
+ */
+class SpatialGrid {
+public:
+    /**
+     * One indexed circle
+     */
+    struct Entry {
+        double x;            // Center
+        double y;
+        GameObject* object;  // Not owned
+        float radius;
+        uint8_t layer;       // CollisionLayer bit of the object
+        uint8_t mask;        // Layers it interacts with
+    };
+
+    static constexpr double DEFAULT_CELL_SIZE = 4.0;
+    static const int DEFAULT_BUCKET_BITS = 10;  // 1024 buckets
+    static const int MAX_QUERY_CELLS = 64;      // Bigger boxes scan every bucket
+
+private:
+    double cellSize;
+    double inverseCellSize;
+    uint32_t bucketMask;                 // bucketCount - 1 (power of two)
+    std::vector<Entry> pending;          // Inserted since the last clear()
+    std::vector<Entry> entries;          // Sorted by bucket (valid after build())
+    std::vector<uint32_t> bucketOf;      // Bucket of each pending entry
+    std::vector<uint32_t> bucketStart;   // bucketCount + 1 offsets into entries
+    double maxRadius;
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    /**
+     * @param cellSize Cell side in world units (about the typical query size)
+     * @param bucketBits log2 of the number of buckets
+     */
+    explicit SpatialGrid(double cellSize = DEFAULT_CELL_SIZE, int bucketBits = DEFAULT_BUCKET_BITS);
+
+
+    // ========== BUILDING ==========
+
+    /**
+     * Reserve room for 'capacity' entries (then rebuilds do not allocate)
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Remove every entry
+     */
+    void clear();
+
+    /**
+     * Add a circle (visible to queries after the next build())
+     */
+    void insert(GameObject* object, double x, double y, double radius,
+                uint8_t layer = CollisionLayer::ALL, uint8_t mask = CollisionLayer::ALL);
+
+    /**
+     * Sort the inserted entries into their buckets
+     */
+    void build();
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Call visit(const Entry&) once for every entry that may touch the
+     * box [minX, maxX] x [minY, maxY]
+     */
+    template<typename Visitor>
+    void query(double minX, double minY, double maxX, double maxY, Visitor&& visit) const;
+
+    /**
+     * Same, for a querier on 'layer' interacting with 'mask': only the
+     * entries that interact with it both ways are visited
+     */
+    template<typename Visitor>
+    void query(double minX, double minY, double maxX, double maxY,
+               uint8_t layer, uint8_t mask, Visitor&& visit) const;
+
+    size_t size() const;
+    double getCellSize() const;
+    size_t getBucketCount() const;
+
+private:
+    int cellCoord(double value) const;
+    uint32_t bucketIndex(int cx, int cy) const;
+};
+
+
+// ========== TEMPLATE IMPLEMENTATION ==========
+
+template<typename Visitor>
+void SpatialGrid::query(double minX, double minY, double maxX, double maxY, Visitor&& visit) const {
+    query(minX, minY, maxX, maxY, CollisionLayer::ALL, CollisionLayer::ALL, visit);
+}
+
+template<typename Visitor>
+void SpatialGrid::query(double minX, double minY, double maxX, double maxY,
+                        uint8_t layer, uint8_t mask, Visitor&& visit) const {
+    if (entries.empty()) {
+        return;
+    }
+    // A circle is stored in the cell of its center: grow the box by the
+    // largest radius so centers just outside it are found too
+    int firstX = cellCoord(minX - maxRadius);
+    int firstY = cellCoord(minY - maxRadius);
+    int lastX = cellCoord(maxX + maxRadius);
+    int lastY = cellCoord(maxY + maxRadius);
+
+    long long cellCount = (static_cast<long long>(lastX) - firstX + 1) * (static_cast<long long>(lastY) - firstY + 1);
+    if (cellCount > MAX_QUERY_CELLS || cellCount > static_cast<long long>(bucketMask) + 1) {
+        // Big box: every bucket once
+        for (const Entry& entry : entries) {
+            if ((mask & entry.layer) && (entry.mask & layer)) {
+                visit(entry);
+            }
+        }
+        return;
+    }
+
+    // Several cells of the box can share a bucket: visit each bucket once
+    uint32_t visited[MAX_QUERY_CELLS];
+    int visitedCount = 0;
+    for (int cy = firstY; cy <= lastY; cy++) {
+        for (int cx = firstX; cx <= lastX; cx++) {
+            uint32_t bucket = bucketIndex(cx, cy);
+            bool seen = false;
+            for (int i = 0; i < visitedCount && !seen; i++) {
+                seen = visited[i] == bucket;
+            }
+            if (seen) {
+                continue;
+            }
+            visited[visitedCount++] = bucket;
+            for (uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; i++) {
+                const Entry& entry = entries[i];
+                if ((mask & entry.layer) && (entry.mask & layer)) {
+                    visit(entry);
+                }
+            }
+        }
+    }
+}
+
+#endif // SPATIALGRID_HPP
@@ -0,0 +1,318 @@
+#include "StaticBvh.hpp"
+#include "GameManager.hpp"
+#include "Geometry.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+    double halfPerimeter(double minX, double minY, double maxX, double maxY) {
+        return (maxX - minX) + (maxY - minY);
+    }
+
+    /**
+     * Bounds of one SAH bin (or of a sweep of bins)
+     */
+    struct BinBounds {
+        double minX, minY, maxX, maxY;
+        uint32_t count;
+
+        void reset() {
+            minX = minY = 1e300;
+            maxX = maxY = -1e300;
+            count = 0;
+        }
+
+        void grow(const StaticBvh::Primitive& primitive) {
+            minX = std::min(minX, primitive.minX);
+            minY = std::min(minY, primitive.minY);
+            maxX = std::max(maxX, primitive.maxX);
+            maxY = std::max(maxY, primitive.maxY);
+            count++;
+        }
+
+        void grow(const BinBounds& other) {
+            minX = std::min(minX, other.minX);
+            minY = std::min(minY, other.minY);
+            maxX = std::max(maxX, other.maxX);
+            maxY = std::max(maxY, other.maxY);
+            count += other.count;
+        }
+
+        double cost() const {
+            return count == 0 ? 0.0 : halfPerimeter(minX, minY, maxX, maxY) * count;
+        }
+    };
+}
+
+
+// ========== CONSTRUCTOR ==========
+
+StaticBvh::StaticBvh()
+    : depth(0)
+{
+}
+
+
+// ========== BUILDING ==========
+
+void StaticBvh::build(const GameManager& manager) {
+    std::vector<Primitive> input;
+    for (size_t i = 0; i < manager.size(); i++) {
+        GameObject* object = const_cast<GameObject*>(manager.getObject(i));
+        const CollisionShape& shape = object->getCollisionShape();
+        if (shape.layer & CollisionLayer::STATIC) {
+            input.push_back(Primitive{ object->getX(), object->getY(), 0.0, 0.0, 0.0, 0.0,
+                                       object, static_cast<uint32_t>(i), shape });
+        }
+    }
+    build(std::move(input));
+}
+
+void StaticBvh::build(std::vector<Primitive> input) {
+    primitives = std::move(input);
+    for (Primitive& primitive : primitives) {
+        primitive.minX = primitive.x - primitive.shape.halfWidth;
+        primitive.maxX = primitive.x + primitive.shape.halfWidth;
+        primitive.minY = primitive.y - primitive.shape.halfHeight;
+        primitive.maxY = primitive.y + primitive.shape.halfHeight;
+    }
+    nodes.clear();
+    depth = 0;
+    if (primitives.empty()) {
+        return;
+    }
+    nodes.reserve(primitives.size() * 2);
+    buildNode(0, static_cast<uint32_t>(primitives.size()), 1);
+}
+
+void StaticBvh::clear() {
+    nodes.clear();
+    primitives.clear();
+    depth = 0;
+}
+
+void StaticBvh::computeBounds(Node& node, uint32_t begin, uint32_t end) const {
+    BinBounds bounds;
+    bounds.reset();
+    for (uint32_t i = begin; i < end; i++) {
+        bounds.grow(primitives[i]);
+    }
+    node.minX = bounds.minX;
+    node.minY = bounds.minY;
+    node.maxX = bounds.maxX;
+    node.maxY = bounds.maxY;
+}
+
+/**
+ * Binned SAH split of primitives [begin, end)
+ *
+ * 1. Centroid bounds -> longest axis, SAH_BINS equal slices of it
+ * 2. One pass: box and count of every bin
+ * 3. Sweep from the right, then from the left: cost of each of the
+ *    SAH_BINS - 1 split planes
+ * 4. Leaf if the best split is not cheaper than testing every
+ *    primitive (and the node is small enough), else partition and
+ *    recurse; a partition that leaves one side empty falls back to a
+ *    median split
+ */
+uint32_t StaticBvh::buildNode(uint32_t begin, uint32_t end, int level) {
+    Node node;
+    computeBounds(node, begin, end);
+    node.start = begin;
+    node.count = end - begin;
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(node);
+    depth = std::max(depth, level);
+
+    const uint32_t count = end - begin;
+    if (count <= 1 || level >= MAX_DEPTH - 1) {
+        return index;
+    }
+
+    double centroidMin[2] = { 1e300, 1e300 };
+    double centroidMax[2] = { -1e300, -1e300 };
+    for (uint32_t i = begin; i < end; i++) {
+        centroidMin[0] = std::min(centroidMin[0], primitives[i].x);
+        centroidMax[0] = std::max(centroidMax[0], primitives[i].x);
+        centroidMin[1] = std::min(centroidMin[1], primitives[i].y);
+        centroidMax[1] = std::max(centroidMax[1], primitives[i].y);
+    }
+    const int axis = (centroidMax[0] - centroidMin[0] >= centroidMax[1] - centroidMin[1]) ? 0 : 1;
+    const double low = centroidMin[axis];
+    const double extent = centroidMax[axis] - low;
+    auto centroid = [axis](const Primitive& primitive) { return axis == 0 ? primitive.x : primitive.y; };
+
+    uint32_t mid = begin;
+    if (extent > 0.0) {
+        const double scale = SAH_BINS / extent;
+        auto binOf = [&](const Primitive& primitive) {
+            int bin = static_cast<int>((centroid(primitive) - low) * scale);
+            return bin < SAH_BINS ? bin : SAH_BINS - 1;
+        };
+
+        BinBounds bins[SAH_BINS];
+        for (BinBounds& bin : bins) {
+            bin.reset();
+        }
+        for (uint32_t i = begin; i < end; i++) {
+            bins[binOf(primitives[i])].grow(primitives[i]);
+        }
+
+        double rightCost[SAH_BINS];
+        BinBounds sweep;
+        sweep.reset();
+        for (int b = SAH_BINS - 1; b > 0; b--) {
+            sweep.grow(bins[b]);
+            rightCost[b] = sweep.cost();
+        }
+        sweep.reset();
+        int bestBin = -1;
+        double bestCost = 0.0;
+        for (int b = 0; b < SAH_BINS - 1; b++) {
+            sweep.grow(bins[b]);
+            double cost = sweep.cost() + rightCost[b + 1];
+            if (bestBin < 0 || cost < bestCost) {
+                bestBin = b;
+                bestCost = cost;
+            }
+        }
+
+        const double area = halfPerimeter(node.minX, node.minY, node.maxX, node.maxY);
+        if (count <= MAX_LEAF_SIZE && TRAVERSAL_COST * area + bestCost >= area * count) {
+            return index;
+        }
+        mid = static_cast<uint32_t>(std::partition(primitives.begin() + begin, primitives.begin() + end,
+                                                   [&](const Primitive& primitive) {
+                                                       return binOf(primitive) <= bestBin;
+                                                   }) - primitives.begin());
+    } else if (count <= MAX_LEAF_SIZE) {
+        return index;  // Every centroid at the same place
+    }
+
+    if (mid == begin || mid == end) {
+        mid = begin + count / 2;
+        std::nth_element(primitives.begin() + begin, primitives.begin() + mid, primitives.begin() + end,
+                         [&](const Primitive& a, const Primitive& b) { return centroid(a) < centroid(b); });
+    }
+
+    buildNode(begin, mid, level + 1);                 // Left: index + 1
+    uint32_t right = buildNode(mid, end, level + 1);
+    nodes[index].start = right;
+    nodes[index].count = 0;
+    return index;
+}
+
+
+// ========== QUERIES ==========
+
+GameObject* StaticBvh::findOverlap(double x, double y, const CollisionShape& shape) const {
+    const Primitive* best = nullptr;
+    query(x - shape.halfWidth, y - shape.halfHeight, x + shape.halfWidth, y + shape.halfHeight,
+          [&](const Primitive& primitive) {
+              if ((!best || primitive.order < best->order)
+                  && shape.interacts(primitive.shape)
+                  && CollisionShape::overlaps(x, y, shape, primitive.x, primitive.y, primitive.shape)) {
+                  best = &primitive;
+              }
+          });
+    return best ? best->object : nullptr;
+}
+
+/**
+ * Nearest hit along the segment
+ *
+ * Node boxes are grown by 'radius' and slab-tested; the nearer child
+ * is visited first and a node whose entry time is past the best hit
+ * so far is skipped. Narrow phase: swept circle for circles, slab test
+ * on the box grown by 'radius' for boxes.
+ */
+bool StaticBvh::raycast(double startX, double startY, double moveX, double moveY, double radius,
+                        uint8_t layer, uint8_t mask, Hit& hit) const {
+    hit.object = nullptr;
+    hit.t = 1.0;
+    if (nodes.empty()) {
+        return false;
+    }
+
+    auto enterNode = [&](const Node& node, double& t) {
+        return Geometry::sweepBox(startX, startY, moveX, moveY, node.minX - radius, node.minY - radius,
+                                  node.maxX + radius, node.maxY + radius, t);
+    };
+
+    uint32_t stack[MAX_DEPTH];
+    double entry[MAX_DEPTH];
+    int top = 0;
+    uint32_t hitOrder = 0;  // Ties at the same t: lowest build order
+    double t;
+    if (!enterNode(nodes[0], t)) {
+        return false;
+    }
+    stack[top] = 0;
+    entry[top++] = t;
+
+    while (top > 0) {
+        top--;
+        if (hit.object && entry[top] > hit.t) {
+            continue;
+        }
+        uint32_t index = stack[top];
+        const Node& node = nodes[index];
+        if (node.count > 0) {
+            for (uint32_t i = node.start; i < node.start + node.count; i++) {
+                const Primitive& primitive = primitives[i];
+                if (!(mask & primitive.shape.layer) || !(primitive.shape.mask & layer)) {
+                    continue;
+                }
+                bool touched;
+                if (primitive.shape.kind == CollisionShape::Kind::CIRCLE) {
+                    touched = Geometry::sweepCircle(startX, startY, moveX, moveY, primitive.x, primitive.y,
+                                                    primitive.shape.halfWidth + radius, t);
+                } else {
+                    touched = Geometry::sweepBox(startX, startY, moveX, moveY,
+                                                 primitive.minX - radius, primitive.minY - radius,
+                                                 primitive.maxX + radius, primitive.maxY + radius, t);
+                }
+                if (touched && (!hit.object || t < hit.t || (t == hit.t && primitive.order < hitOrder))) {
+                    hit.object = primitive.object;
+                    hit.t = t;
+                    hitOrder = primitive.order;
+                }
+            }
+            continue;
+        }
+
+        double leftT, rightT;
+        bool left = enterNode(nodes[index + 1], leftT);
+        bool right = enterNode(nodes[node.start], rightT);
+        // Push the far child first: the near one is popped next
+        if (left && right && leftT <= rightT) {
+            stack[top] = node.start;
+            entry[top++] = rightT;
+            stack[top] = index + 1;
+            entry[top++] = leftT;
+        } else {
+            if (left) {
+                stack[top] = index + 1;
+                entry[top++] = leftT;
+            }
+            if (right) {
+                stack[top] = node.start;
+                entry[top++] = rightT;
+            }
+        }
+    }
+    return hit.object != nullptr;
+}
+
+size_t StaticBvh::size() const {
+    return primitives.size();
+}
+
+size_t StaticBvh::getNodeCount() const {
+    return nodes.size();
+}
+
+int StaticBvh::getDepth() const {
+    return depth;
+}
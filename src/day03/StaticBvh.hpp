@@ -0,0 +1,170 @@
+#ifndef STATICBVH_HPP
+#define STATICBVH_HPP
+
+#include "CollisionShape.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+class GameManager;
+
+/**
+ * StaticBvh - Immutable bounding volume hierarchy over static geometry
+ *
+ * Decor never moves (Decor::update does nothing), so it does not need
+ * to be re-tested object by object on every move: it is indexed once,
+ * at level load, and the dynamic side (GameManager::canMoveTo, the
+ * SpatialGrid) only keeps what moves.
+ *
+ * Build: top-down, binned SAH (surface area heuristic, in 2D the half
+ * perimeter of the boxes): at each node, the centroids are sorted into
+ * SAH_BINS slices along the longest axis and the split with the lowest
+ * expected cost
+ *   TRAVERSAL_COST * halfPerimeter(node)
+ *     + halfPerimeter(L) * count(L) + halfPerimeter(R) * count(R)
+ * wins (costs in primitive tests); a node stays a leaf when no split
+ * beats testing everything, halfPerimeter(node) * count.
+ *
+ * Layout: one flat array of nodes in depth-first order (left child =
+ * next node, right child stored in the node) and the primitives
+ * reordered so every leaf is a contiguous range. No pointers between
+ * nodes, no allocation after build().
+ *
+ * Queries:
+ * - findOverlap: first (lowest build order) static shape overlapping a
+ *   shape at a position, after the layer / mask filter (movement)
+ * - raycast: nearest static shape hit by a segment (line of sight,
+ *   projectiles), children visited near first, pruned by the best hit
+ * - query: every primitive whose box touches a box
+ */
+class StaticBvh {
+public:
+    /**
+     * One static object, as indexed
+     */
+    struct Primitive {
+        double x;              // Position (centre of the shape)
+        double y;
+        double minX, minY;     // Bounds of the shape
+        double maxX, maxY;
+        GameObject* object;    // Not owned
+        uint32_t order;        // Build order (= order in the GameManager)
+        CollisionShape shape;
+    };
+
+    /**
+     * Ray / segment hit
+     */
+    struct Hit {
+        GameObject* object;
+        double t;              // 0..1 along the segment
+    };
+
+    static const int SAH_BINS = 12;
+    static constexpr double TRAVERSAL_COST = 1.0;  // One node visit, in primitive tests
+    static const uint32_t MAX_LEAF_SIZE = 8;     // Forced split above this
+    static const int MAX_DEPTH = 64;             // Traversal stack size
+
+private:
+    /**
+     * count > 0: leaf, primitives [start, start + count)
+     * count == 0: inner node, left child = this + 1, right child = start
+     */
+    struct Node {
+        double minX, minY;
+        double maxX, maxY;
+        uint32_t start;
+        uint32_t count;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Primitive> primitives;   // Leaf order
+    int depth;
+
+public:
+    StaticBvh();
+
+    // ========== BUILDING ==========
+
+    /**
+     * Index every object of the manager on the STATIC collision layer
+     * (replaces the previous content)
+     */
+    void build(const GameManager& manager);
+
+    /**
+     * Index the given primitives (bounds are computed here)
+     */
+    void build(std::vector<Primitive> input);
+
+    void clear();
+
+
+    // ========== QUERIES ==========
+
+    /**
+     * Static object overlapping 'shape' placed at (x, y), layer filter
+     * included; the lowest build order wins if several do
+     * @return nullptr if none
+     */
+    GameObject* findOverlap(double x, double y, const CollisionShape& shape) const;
+
+    /**
+     * Nearest static shape crossed by the segment from (startX, startY)
+     * to (startX + moveX, startY + moveY), seen from 'layer' / 'mask'
+     * @param radius Thickness of the moving thing (0 for a line of sight)
+     * @return false if nothing is hit
+     */
+    bool raycast(double startX, double startY, double moveX, double moveY, double radius,
+                 uint8_t layer, uint8_t mask, Hit& hit) const;
+
+    /**
+     * visit(const Primitive&) for every primitive whose bounds touch
+     * the box [minX, maxX] x [minY, maxY]
+     */
+    template<typename Visitor>
+    void query(double minX, double minY, double maxX, double maxY, Visitor&& visit) const;
+
+    size_t size() const;
+    size_t getNodeCount() const;
+    int getDepth() const;
+
+private:
+    uint32_t buildNode(uint32_t begin, uint32_t end, int level);
+    void computeBounds(Node& node, uint32_t begin, uint32_t end) const;
+};
+
+
+// ========== TEMPLATE IMPLEMENTATION ==========
+
+template<typename Visitor>
+void StaticBvh::query(double minX, double minY, double maxX, double maxY, Visitor&& visit) const {
+    if (nodes.empty()) {
+        return;
+    }
+    uint32_t stack[MAX_DEPTH];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (node.maxX < minX || node.minX > maxX || node.maxY < minY || node.minY > maxY) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (uint32_t i = node.start; i < node.start + node.count; i++) {
+                const Primitive& primitive = primitives[i];
+                if (primitive.maxX >= minX && primitive.minX <= maxX
+                    && primitive.maxY >= minY && primitive.minY <= maxY) {
+                    visit(primitive);
+                }
+            }
+        } else {
+            uint32_t index = static_cast<uint32_t>(&node - nodes.data());
+            stack[top++] = node.start;   // Right
+            stack[top++] = index + 1;    // Left (visited first)
+        }
+    }
+}
+
+#endif // STATICBVH_HPP
@@ -0,0 +1,179 @@
+#include "SteeringBatch.hpp"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #define STEERING_X86 1
+    #include <immintrin.h>
+    #if defined(__GNUC__) || defined(__clang__)
+        // Compile just this function for AVX2, the rest stays baseline
+        #define STEERING_TARGET_AVX2 __attribute__((target("avx2")))
+    #else
+        #define STEERING_TARGET_AVX2
+    #endif
+#endif
+
+// ========== CONSTRUCTOR ==========
+
+SteeringBatch::SteeringBatch()
+    : count(0)
+{
+}
+
+
+// ========== FILLING ==========
+
+void SteeringBatch::reserve(size_t capacity) {
+    posX.resize(capacity);
+    posY.resize(capacity);
+    range.resize(capacity);
+    dist.resize(capacity);
+    dirX.resize(capacity);
+    dirY.resize(capacity);
+    inRange.resize(capacity);
+}
+
+void SteeringBatch::clear() {
+    count = 0;
+}
+
+size_t SteeringBatch::add(double x, double y, double attackRange) {
+    if (count == posX.size()) {
+        reserve(count == 0 ? 16 : count * 2);
+    }
+    posX[count] = x;
+    posY[count] = y;
+    range[count] = attackRange;
+    return count++;
+}
+
+
+// ========== KERNEL ==========
+
+void SteeringBatch::compute(double targetX, double targetY) {
+    computeWith(getBestBackend(), targetX, targetY);
+}
+
+void SteeringBatch::computeWith(Backend backend, double targetX, double targetY) {
+    size_t done = 0;
+#ifdef STEERING_X86
+    if (backend == Backend::AVX2 && getBestBackend() == Backend::AVX2) {
+        done = computeAVX2(targetX, targetY);
+    } else if (backend != Backend::SCALAR) {
+        done = computeSSE2(targetX, targetY);
+    }
+#else
+    (void)backend;
+#endif
+    computeScalar(done, count, targetX, targetY);
+}
+
+SteeringBatch::Backend SteeringBatch::getBestBackend() {
+#ifdef STEERING_X86
+    #if defined(__GNUC__) || defined(__clang__)
+    static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+    if (hasAVX2) {
+        return Backend::AVX2;
+    }
+    #endif
+    return Backend::SSE2;  // Part of every x86-64 CPU
+#else
+    return Backend::SCALAR;
+#endif
+}
+
+const char* SteeringBatch::getBackendName(Backend backend) {
+    switch (backend) {
+        case Backend::AVX2: return "AVX2";
+        case Backend::SSE2: return "SSE2";
+        default:            return "scalar";
+    }
+}
+
+
+// ========== KERNELS ==========
+
+/**
+ * Reference kernel - every SIMD kernel must give exactly these results
+ */
+void SteeringBatch::computeScalar(size_t begin, size_t end, double targetX, double targetY) {
+    for (size_t i = begin; i < end; i++) {
+        double dx = targetX - posX[i];
+        double dy = targetY - posY[i];
+        double d = std::sqrt(dx * dx + dy * dy);
+        dist[i] = d;
+        inRange[i] = d <= range[i] ? 1 : 0;
+        if (d > MIN_DISTANCE) {
+            dirX[i] = dx / d;
+            dirY[i] = dy / d;
+        } else {
+            dirX[i] = 0.0;
+            dirY[i] = 0.0;
+        }
+    }
+}
+
+#ifdef STEERING_X86
+
+size_t SteeringBatch::computeSSE2(double targetX, double targetY) {
+    const __m128d tx = _mm_set1_pd(targetX);
+    const __m128d ty = _mm_set1_pd(targetY);
+    const __m128d minDist = _mm_set1_pd(MIN_DISTANCE);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d dx = _mm_sub_pd(tx, _mm_loadu_pd(&posX[i]));
+        __m128d dy = _mm_sub_pd(ty, _mm_loadu_pd(&posY[i]));
+        __m128d d = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)));
+        _mm_storeu_pd(&dist[i], d);
+
+        int rangeMask = _mm_movemask_pd(_mm_cmple_pd(d, _mm_loadu_pd(&range[i])));
+        inRange[i] = rangeMask & 1;
+        inRange[i + 1] = (rangeMask >> 1) & 1;
+
+        // Lanes too close to the target get a zero direction
+        __m128d moving = _mm_cmpgt_pd(d, minDist);
+        _mm_storeu_pd(&dirX[i], _mm_and_pd(moving, _mm_div_pd(dx, d)));
+        _mm_storeu_pd(&dirY[i], _mm_and_pd(moving, _mm_div_pd(dy, d)));
+    }
+    return i;
+}
+
+STEERING_TARGET_AVX2
+size_t SteeringBatch::computeAVX2(double targetX, double targetY) {
+    const __m256d tx = _mm256_set1_pd(targetX);
+    const __m256d ty = _mm256_set1_pd(targetY);
+    const __m256d minDist = _mm256_set1_pd(MIN_DISTANCE);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d dx = _mm256_sub_pd(tx, _mm256_loadu_pd(&posX[i]));
+        __m256d dy = _mm256_sub_pd(ty, _mm256_loadu_pd(&posY[i]));
+        // No FMA: a fused multiply-add would round differently from the
+        // scalar kernel
+        __m256d d = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)));
+        _mm256_storeu_pd(&dist[i], d);
+
+        int rangeMask = _mm256_movemask_pd(_mm256_cmp_pd(d, _mm256_loadu_pd(&range[i]), _CMP_LE_OQ));
+        inRange[i] = rangeMask & 1;
+        inRange[i + 1] = (rangeMask >> 1) & 1;
+        inRange[i + 2] = (rangeMask >> 2) & 1;
+        inRange[i + 3] = (rangeMask >> 3) & 1;
+
+        __m256d moving = _mm256_cmp_pd(d, minDist, _CMP_GT_OQ);
+        _mm256_storeu_pd(&dirX[i], _mm256_and_pd(moving, _mm256_div_pd(dx, d)));
+        _mm256_storeu_pd(&dirY[i], _mm256_and_pd(moving, _mm256_div_pd(dy, d)));
+    }
+    return i;
+}
+
+#else
+
+size_t SteeringBatch::computeSSE2(double, double) {
+    return 0;
+}
+
+size_t SteeringBatch::computeAVX2(double, double) {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef STEERINGBATCH_HPP
+#define STEERINGBATCH_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * SteeringBatch - Distance / range / direction for many movers at once
+ *
+ * Enemy::update used to compute, per enemy and through getters:
+ *   distance (sqrt), then dx, dy, a second sqrt and two divisions.
+ * The batch does it ONCE for every enemy chasing the same target, on
+ * contiguous arrays (Structure of Arrays):
+ *
+ *   posX[] posY[] range[]  ->  dist[] dirX[] dirY[] inRange[]
+ *
+ * Kernels:
+ * - AVX2: 4 doubles per instruction
+ * - SSE2: 2 doubles per instruction
+ * - Scalar fallback (and for the tail that does not fill a register)
+ * The best one is picked at runtime from the CPU features (x86 only;
+ * other CPUs always use the scalar kernel).
+ *
+ * All kernels use sqrt and division (no approximate reciprocal), so
+ * their results are bit-identical: the game plays the same on any CPU.
+ *
+ * Buffers are reserved once (reserve) and reused every turn.
+ */
+class SteeringBatch {
+public:
+    /**
+     * Kernel implementations
+     */
+    enum class Backend {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    static constexpr double MIN_DISTANCE = 0.0001;  // Below this: no direction
+
+private:
+    // ---- Inputs ----
+    std::vector<double> posX;
+    std::vector<double> posY;
+    std::vector<double> range;
+
+    // ---- Outputs ----
+    std::vector<double> dist;
+    std::vector<double> dirX;
+    std::vector<double> dirY;
+    std::vector<unsigned char> inRange;
+
+    size_t count;
+
+public:
+    // ========== CONSTRUCTOR ==========
+
+    SteeringBatch();
+
+
+    // ========== FILLING ==========
+
+    /**
+     * Reserve room for 'capacity' movers (no allocation below that)
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Remove every mover (keeps the buffers)
+     */
+    void clear();
+
+    /**
+     * Add a mover
+     * @param x World x
+     * @param y World y
+     * @param attackRange Distance at which the mover attacks instead of moving
+     * @return Index of the mover in the batch
+     */
+    size_t add(double x, double y, double attackRange);
+
+    size_t size() const { return count; }
+
+
+    // ========== KERNEL ==========
+
+    /**
+     * Compute every output towards one target with the best backend
+     * @param targetX Target world x
+     * @param targetY Target world y
+     */
+    void compute(double targetX, double targetY);
+
+    /**
+     * Same, with a chosen backend (falls back to SCALAR if unsupported)
+     * Used by the benchmarks.
+     */
+    void computeWith(Backend backend, double targetX, double targetY);
+
+    /**
+     * Fastest backend supported by this CPU
+     */
+    static Backend getBestBackend();
+
+    /**
+     * Display name of a backend ("AVX2", "SSE2", "scalar")
+     */
+    static const char* getBackendName(Backend backend);
+
+
+    // ========== RESULTS ==========
+
+    double getDistance(size_t i) const { return dist[i]; }
+    double getDirX(size_t i) const { return dirX[i]; }     // 0 if on the target
+    double getDirY(size_t i) const { return dirY[i]; }
+    bool isInRange(size_t i) const { return inRange[i] != 0; }
+
+private:
+    // ========== KERNELS ==========
+
+    /**
+     * Process movers [begin, end) one by one
+     */
+    void computeScalar(size_t begin, size_t end, double targetX, double targetY);
+
+    /**
+     * Process as many movers as fit in 2-lane registers
+     * @return Index of the first mover left for the scalar tail
+     */
+    size_t computeSSE2(double targetX, double targetY);
+
+    /**
+     * Process as many movers as fit in 4-lane registers
+     * @return Index of the first mover left for the scalar tail
+     */
+    size_t computeAVX2(double targetX, double targetY);
+};
+
+#endif // STEERINGBATCH_HPP
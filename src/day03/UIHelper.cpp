@@ -1,4 +1,5 @@
 #include "UIHelper.hpp"
+#include <cstdio>
 #include <sstream>
 #include <iomanip>
 
@@ -6,6 +7,44 @@ namespace UI {
 
 // ========== HEALTH BAR FUNCTIONS ==========
 
+namespace {
+
+    /**
+     * Write the health bar to a stream (shared by getHealthBar and
+     * drawHealthBar, so the console path builds no string)
+     */
+    void writeHealthBar(std::ostream& out, int current, int max, int barWidth, bool useColor) {
+        // Calculate percentage and bar fill
+        if (max <= 0) max = 1;  // Prevent division by zero
+        if (current < 0) current = 0;
+        if (current > max) current = max;
+        
+        double percentage = static_cast<double>(current) / max;
+        int filled = static_cast<int>(percentage * barWidth);
+        
+        // Add color if requested
+        if (useColor) {
+            out << getHealthColor(current, max);
+        }
+        
+        // Draw the bar
+        out << "[";
+        for (int i = 0; i < barWidth; i++) {
+            if (i < filled) {
+                out << "\u2588";  // Filled block (█)
+            } else {
+                out << "\u2591";  // Light shade (░)
+            }
+        }
+        out << "] " << current << "/" << max << " HP";
+        
+        // Reset color
+        if (useColor) {
+            out << COLOR_RESET;
+        }
+    }
+}
+
 /**
  * Get health bar as string
  * 
@@ -16,41 +55,12 @@ namespace UI {
  */
 std::string getHealthBar(int current, int max, int barWidth, bool useColor) {
     std::stringstream ss;
-    
-    // Calculate percentage and bar fill
-    if (max <= 0) max = 1;  // Prevent division by zero
-    if (current < 0) current = 0;
-    if (current > max) current = max;
-    
-    double percentage = static_cast<double>(current) / max;
-    int filled = static_cast<int>(percentage * barWidth);
-    
-    // Add color if requested
-    if (useColor) {
-        ss << getHealthColor(current, max);
-    }
-    
-    // Draw the bar
-    ss << "[";
-    for (int i = 0; i < barWidth; i++) {
-        if (i < filled) {
-            ss << "\u2588";  // Filled block (█)
-        } else {
-            ss << "\u2591";  // Light shade (░)
-        }
-    }
-    ss << "] " << current << "/" << max << " HP";
-    
-    // Reset color
-    if (useColor) {
-        ss << COLOR_RESET;
-    }
-    
+    writeHealthBar(ss, current, max, barWidth, useColor);
     return ss.str();
 }
 
 void drawHealthBar(int current, int max, int barWidth, bool useColor) {
-    std::cout << getHealthBar(current, max, barWidth, useColor);
+    writeHealthBar(std::cout, current, max, barWidth, useColor);
 }
 
 /**
@@ -86,7 +96,7 @@ std::string getHealthColor(int current, int max) {
  * ║   ║ (sides)
  * ╚ ═ ╝ (bottom)
  */
-void drawTitleBox(const std::string& title, int width) {
+void drawTitleBox(const char* title, int width) {
     // Top border (╔═══╗)
     std::cout << "\u2554";  // ╔
     for (int i = 0; i < width - 2; i++) {
@@ -95,7 +105,9 @@ void drawTitleBox(const std::string& title, int width) {
     std::cout << "\u2557" << std::endl;  // ╗
     
     // Title (centered)
-    std::cout << "\u2551" << centerText(title, width - 2) << "\u2551" << std::endl;  // ║
+    std::cout << "\u2551";  // ║
+    writeCentered(title, std::char_traits<char>::length(title), width - 2);
+    std::cout << "\u2551" << std::endl;  // ║
     
     // Bottom border (╚═══╝)
     std::cout << "\u255A";  // ╚
@@ -105,6 +117,10 @@ void drawTitleBox(const std::string& title, int width) {
     std::cout << "\u255D" << std::endl;  // ╝
 }
 
+void drawTitleBox(const std::string& title, int width) {
+    drawTitleBox(title.c_str(), width);
+}
+
 /**
  * Draw a section header with single-line borders
  * 
@@ -122,7 +138,9 @@ void drawSectionHeader(const std::string& title, int width) {
     std::cout << "\u2510" << std::endl;  // ┐
     
     // Title (centered)
-    std::cout << "\u2502" << centerText(title, width - 2) << "\u2502" << std::endl;  // │
+    std::cout << "\u2502";  // │
+    writeCentered(title.c_str(), title.length(), width - 2);
+    std::cout << "\u2502" << std::endl;  // │
     
     // Bottom border (└───┘)
     std::cout << "\u2514";  // └
@@ -194,14 +212,14 @@ void drawStatusDashboard(
     
     std::cout << "\u2551   Position: (" << std::fixed << std::setprecision(1) 
               << playerX << ", " << playerY << ")";
-    std::ostringstream pos;
-    pos << std::fixed << std::setprecision(1) << playerX << ", " << playerY;
-    padding = 30 - pos.str().length();
+    // Width of the same text, measured in a stack buffer (no stream, no string)
+    char measure[64];
+    padding = 30 - std::snprintf(measure, sizeof(measure), "%.1f, %.1f", playerX, playerY);
     for (int i = 0; i < padding; i++) std::cout << " ";
     std::cout << "\u2551" << std::endl;  // ║
     
     std::cout << "\u2551   Health: ";
-    std::cout << getHealthBar(playerHealth, playerMaxHealth, 15, true);
+    drawHealthBar(playerHealth, playerMaxHealth, 15, true);
     std::cout << "  \u2551" << std::endl;  // ║
     
     std::cout << "\u2551   Weapon: " << COLOR_YELLOW << weaponName << COLOR_RESET 
@@ -223,14 +241,12 @@ void drawStatusDashboard(
         
         std::cout << "\u2551   Distance: " << std::fixed << std::setprecision(2) 
                   << targetDistance << " units";
-        std::ostringstream dist;
-        dist << std::fixed << std::setprecision(2) << targetDistance;
-        padding = 31 - dist.str().length();
+        padding = 31 - std::snprintf(measure, sizeof(measure), "%.2f", targetDistance);
         for (int i = 0; i < padding; i++) std::cout << " ";
         std::cout << "\u2551" << std::endl;  // ║
         
         std::cout << "\u2551   Health: ";
-        std::cout << getHealthBar(targetHealth, targetMaxHealth, 15, true);
+        drawHealthBar(targetHealth, targetMaxHealth, 15, true);
         std::cout << "  \u2551" << std::endl;  // ║
     } else {
         std::cout << "\u2551 " << COLOR_BRIGHT_RED << "🎯 Target: None" << COLOR_RESET;
@@ -275,6 +291,25 @@ std::string centerText(const std::string& text, int width) {
     return result;
 }
 
+/**
+ * Write centered text straight to the console
+ * Same padding rule as centerText(), without building a string
+ */
+void writeCentered(const char* text, size_t length, int width) {
+    int padding = width - static_cast<int>(length);
+    if (padding <= 0) {
+        std::cout.write(text, length);
+        return;
+    }
+    
+    int leftPad = padding / 2;
+    int rightPad = padding - leftPad;
+    
+    for (int i = 0; i < leftPad; i++) std::cout << ' ';
+    std::cout.write(text, length);
+    for (int i = 0; i < rightPad; i++) std::cout << ' ';
+}
+
 /**
  * Wrap text with color and auto-reset
  */
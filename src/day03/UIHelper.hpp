@@ -80,7 +80,7 @@ namespace UI {
     
     /**
      * Draw simple health bar without returning string
-     * Directly outputs to console
+     * Directly outputs to console (no string built)
      */
     void drawHealthBar(int current, int max, int barWidth = 10, bool useColor = true);
     
@@ -103,7 +103,8 @@ namespace UI {
     /**
      * Draw a title box with enhanced borders
      * 
-     * @param title Title text
+     * @param title Title text (e.g. built with snprintf in a stack buffer:
+     *              no std::string temporary)
      * @param width Box width (default 50)
      * 
      * Example:
@@ -111,6 +112,11 @@ namespace UI {
      * ║         TURN 1                 ║
      * ╚════════════════════════════════╝
      */
+    void drawTitleBox(const char* title, int width = 50);
+    
+    /**
+     * Same, for a std::string title
+     */
     void drawTitleBox(const std::string& title, int width = 50);
     
     /**
@@ -177,6 +183,17 @@ namespace UI {
      */
     std::string centerText(const std::string& text, int width);
     
+    /**
+     * Write text centered within a given width directly to std::cout
+     * @param text Text to center
+     * @param length Length of text in bytes
+     * @param width Total width
+     * 
+     * Same layout as centerText(), but streams the padding instead of
+     * building a new string (no heap allocation).
+     */
+    void writeCentered(const char* text, size_t length, int width);
+    
     /**
      * Colored text helper
      * @param text Text to color
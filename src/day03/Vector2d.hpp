@@ -1,97 +1,287 @@
 #ifndef VECTOR2D_HPP
 #define VECTOR2D_HPP
 
+#include "VectorExpr.hpp"
+#include <stdexcept>  // For exceptions
+
+// ========== SETTER POLICIES ==========
+
+/**
+ * CheckedCoordinates - Reject NaN / infinity / out of range values
+ * (throws std::invalid_argument). Default: catches bugs at the source.
+ */
+struct CheckedCoordinates {
+    static constexpr void check(bool valid, const char* message) {
+        if (!valid) {
+            throw std::invalid_argument(message);
+        }
+    }
+};
+
+/**
+ * UncheckedCoordinates - No test at all on writes
+ * For builds where positions are known to stay valid and every
+ * setX/setY in the hot loops should be a plain store.
+ */
+struct UncheckedCoordinates {
+    static constexpr void check(bool, const char*) {}
+};
+
+
 /**
- * Vector2d - A 2D vector class for Campus Quest
- * 
+ * BasicVector2d - A 2D vector class for Campus Quest
+ *
  * Represents a position or direction in 2D space with x and y coordinates.
- * Supports vector arithmetic (addition, subtraction) and distance calculation.
+ * Supports vector arithmetic (addition, subtraction, scaling) and
+ * distance calculation.
+ *
+ * Template on the coordinate type T (the "precision"):
+ * - double     : default, 16 bytes per position
+ * - float      : 8 bytes per position, twice the SIMD width,
+ *                but only ~7 significant digits
+ * - Fixed32x32 : 16 bytes, exact add/sub, same precision everywhere
+ * and on the setter Policy (CheckedCoordinates / UncheckedCoordinates).
+ *
+ * The public interface always speaks double (constructor, getters,
+ * setters, distance): conversion happens at this boundary, so the rest
+ * of the game does not depend on T. getRawX/getRawY give the stored
+ * values for code that wants to stay in T.
+ *
+ * Header-only and constexpr: every call can be inlined at the call
+ * site. Only distance() (sqrt) is not usable in constant expressions.
+ * Prefer distanceSquared() for comparisons: d < r  <=>  d² < r².
+ *
+ * Arithmetic (+, -, * number) builds expression templates (see
+ * VectorExpr.hpp), evaluated in one pass when stored into a vector.
+ * The Policy checks values coming in as double (constructor, setters)
+ * and arithmetic results (finite, as the original operator+ / operator-
+ * did): once per stored vector, not per operator, and before anything
+ * is written. Fixed 32.32 results are not checked (see isValid()).
  */
-class Vector2d {
+template<typename T, typename Policy = CheckedCoordinates>
+class BasicVector2d : public VecExpr<BasicVector2d<T, Policy>> {
+public:
+    typedef T Scalar;  // Coordinate storage type
+    static constexpr bool IS_LEAF = true;  // Held by reference in expressions
+
 private:
-    double x;  // X coordinate
-    double y;  // Y coordinate
+    typedef VectorDetail::ScalarTraits<T> Traits;
+
+    T x;  // X coordinate
+    T y;  // Y coordinate
 
 public:
     // ========== CONSTRUCTORS ==========
-    
+
     /**
      * Default constructor - initializes vector to origin (0, 0)
      */
-    Vector2d();
-    
+    constexpr BasicVector2d() : x(Traits::fromDouble(0.0)), y(Traits::fromDouble(0.0)) {}
+
     /**
      * Parameterized constructor - initializes vector with specific coordinates
      * @param x The x coordinate
      * @param y The y coordinate
+     * @throws std::invalid_argument if a coordinate is not finite or
+     *         does not fit in T (checked policy only)
      */
-    Vector2d(double x, double y);
-    
-    
+    constexpr BasicVector2d(double x, double y) : x(Traits::fromDouble(x)), y(Traits::fromDouble(y)) {
+        Policy::check(Traits::fits(x) && Traits::fits(y),
+                      "Vector2d coordinates must be finite numbers (not NaN or infinity)");
+    }
+
+    /**
+     * Build from stored values (no conversion, no check), the mirror of
+     * getRawX / getRawY for code that stays in T
+     */
+    static constexpr BasicVector2d fromRaw(T x, T y) {
+        BasicVector2d result;
+        result.x = x;
+        result.y = y;
+        return result;
+    }
+
+    /**
+     * Evaluate an expression (a + b * k...) into a new vector
+     * Implicit, so that: Vector2d c = a + b;
+     * @throws std::invalid_argument if the result is not finite
+     *         (checked policy only)
+     */
+    template<typename E>
+    constexpr BasicVector2d(const VecExpr<E>& expr) : x(expr.self().getRawX()), y(expr.self().getRawY()) {
+        checkResult(x, y);
+    }
+
+
     // ========== ACCESSORS (GETTERS) ==========
-    
+
     /**
      * Get the X coordinate
-     * @return The x value
-     * const: This method doesn't modify the object
+     * @return The x value (converted to double)
      */
-    double getX() const;
-    
+    constexpr double getX() const { return Traits::toDouble(x); }
+
     /**
      * Get the Y coordinate
-     * @return The y value
-     * const: This method doesn't modify the object
+     * @return The y value (converted to double)
      */
-    double getY() const;
-    
-    
+    constexpr double getY() const { return Traits::toDouble(y); }
+
+    /**
+     * Get the stored coordinates, without conversion
+     */
+    constexpr T getRawX() const { return x; }
+    constexpr T getRawY() const { return y; }
+
+
     // ========== MUTATORS (SETTERS) ==========
-    
+
     /**
-     * Set the X coordinate with validation
-     * @param x The new x value (must be a finite number)
+     * Set the X coordinate (validated by the Policy)
+     * @param x The new x value (must be a finite number that fits in T)
      */
-    void setX(double x);
-    
+    constexpr void setX(double x) {
+        Policy::check(Traits::fits(x), "X coordinate must be a finite number (not NaN or infinity)");
+        this->x = Traits::fromDouble(x);
+    }
+
     /**
-     * Set the Y coordinate with validation
-     * @param y The new y value (must be a finite number)
+     * Set the Y coordinate (validated by the Policy)
+     * @param y The new y value (must be a finite number that fits in T)
      */
-    void setY(double y);
-    
-    
+    constexpr void setY(double y) {
+        Policy::check(Traits::fits(y), "Y coordinate must be a finite number (not NaN or infinity)");
+        this->y = Traits::fromDouble(y);
+    }
+
+
     // ========== OPERATOR OVERLOADING ==========
-    
-    /**
-     * Vector addition operator
-     * @param other The vector to add
-     * @return A new vector that is the sum of this vector and other
-     * 
-     * Example: v1(3,4) + v2(1,2) = v3(4,6)
-     */
-    Vector2d operator+(const Vector2d& other) const;
-    
-    /**
-     * Vector subtraction operator
-     * @param other The vector to subtract
-     * @return A new vector that is the difference of this vector and other
-     * 
-     * Example: v1(3,4) - v2(1,2) = v3(2,2)
-     */
-    Vector2d operator-(const Vector2d& other) const;
-    
-    
+
+    /*
+     * Vector addition / subtraction / scaling are free operators on
+     * expressions (VectorExpr.hpp):
+     * Example: v1(3,4) + v2(1,2) = v3(4,6), v(3,4) * 2 = (6,8)
+     */
+
+    /**
+     * Store an expression (one fused pass, component by component)
+     *
+     * Safe when the expression reads this vector (v = w - v): each
+     * component only depends on the same component of the operands.
+     * Like every store below, throws std::invalid_argument (checked
+     * policy) if the result is not finite, leaving the vector unchanged.
+     */
+    template<typename E>
+    constexpr BasicVector2d& operator=(const VecExpr<E>& expr) {
+        store(expr.self().getRawX(), expr.self().getRawY());
+        return *this;
+    }
+
+    /**
+     * Compound versions: modify this vector in place (no temporary)
+     */
+    template<typename E>
+    constexpr BasicVector2d& operator+=(const VecExpr<E>& expr) {
+        store(x + expr.self().getRawX(), y + expr.self().getRawY());
+        return *this;
+    }
+
+    template<typename E>
+    constexpr BasicVector2d& operator-=(const VecExpr<E>& expr) {
+        store(x - expr.self().getRawX(), y - expr.self().getRawY());
+        return *this;
+    }
+
+    constexpr BasicVector2d& operator*=(double factor) {
+        T f = Traits::fromDouble(factor);
+        store(x * f, y * f);
+        return *this;
+    }
+
+
     // ========== DISTANCE CALCULATION ==========
-    
+
+    /**
+     * Squared length: x² + y² (no sqrt)
+     */
+    constexpr double lengthSquared() const {
+        return Traits::toDouble(x * x + y * y);
+    }
+
+    /**
+     * Dot product: x1*x2 + y1*y2 (the length of the projection of one
+     * vector on the other, times the other's length)
+     */
+    constexpr double dot(const BasicVector2d& other) const {
+        return Traits::toDouble(x * other.x + y * other.y);
+    }
+
+    /**
+     * Squared distance to another vector: (x2-x1)² + (y2-y1)² (no sqrt)
+     *
+     * Use it to COMPARE distances: dist < radius  <=>  dist² < radius²
+     */
+    constexpr double distanceSquared(const BasicVector2d& other) const {
+        T dx = other.x - x;
+        T dy = other.y - y;
+        return Traits::toDouble(dx * dx + dy * dy);
+    }
+
     /**
      * Calculate Euclidean distance to another vector
      * @param other The target vector
      * @return The distance between this vector and other
-     * 
-     * Formula: sqrt((x2-x1)² + (y2-y1)²)
+     *
+     * Formula: sqrt((x2-x1)² + (y2-y1)²), computed in T
+     */
+    double distance(const BasicVector2d& other) const {
+        T dx = other.x - x;
+        T dy = other.y - y;
+        return Traits::toDouble(Traits::squareRoot(dx * dx + dy * dy));
+    }
+
+private:
+    static constexpr void checkResult(T newX, T newY) {
+        Policy::check(Traits::isValid(newX) && Traits::isValid(newY),
+                      "Vector2d arithmetic result must be finite (not NaN or infinity)");
+    }
+
+    /**
+     * Write computed values (arithmetic results, checked first)
      */
-    double distance(const Vector2d& other) const;
+    constexpr void store(T newX, T newY) {
+        checkResult(newX, newY);
+        x = newX;
+        y = newY;
+    }
 };
 
-#endif // VECTOR2D_HPP
 
+// ========== ENGINE POSITION TYPE ==========
+
+/**
+ * Build-time choice of the precision used by every GameObject:
+ *   cmake -DCAMPUS_QUEST_POSITION_TYPE=double|float|fixed
+ * and of the setter policy:
+ *   cmake -DCAMPUS_QUEST_UNCHECKED_COORDINATES=ON
+ */
+#if defined(CAMPUS_QUEST_POSITION_FLOAT)
+typedef float PositionScalar;
+constexpr const char* POSITION_TYPE_NAME = "float";
+#elif defined(CAMPUS_QUEST_POSITION_FIXED)
+typedef Fixed32x32 PositionScalar;
+constexpr const char* POSITION_TYPE_NAME = "fixed 32.32";
+#else
+typedef double PositionScalar;
+constexpr const char* POSITION_TYPE_NAME = "double";
+#endif
+
+#if defined(CAMPUS_QUEST_UNCHECKED_COORDINATES)
+typedef UncheckedCoordinates PositionPolicy;
+#else
+typedef CheckedCoordinates PositionPolicy;
+#endif
+
+typedef BasicVector2d<PositionScalar, PositionPolicy> Vector2d;
+
+#endif // VECTOR2D_HPP
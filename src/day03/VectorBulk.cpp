@@ -0,0 +1,45 @@
+#include "VectorBulk.hpp"
+#include <thread>
+
+namespace VectorBulk {
+
+    size_t chunkCount(size_t count, Execution execution) {
+        if (execution == Execution::SEQUENTIAL || count < PARALLEL_MIN_COUNT) {
+            return 1;
+        }
+        size_t workers = std::thread::hardware_concurrency();  // 0 if unknown
+        if (workers > MAX_WORKERS) {
+            workers = MAX_WORKERS;
+        }
+        // Every chunk keeps at least half of PARALLEL_MIN_COUNT points
+        size_t bySize = count / (PARALLEL_MIN_COUNT / 2);
+        if (workers > bySize) {
+            workers = bySize;
+        }
+        return workers == 0 ? 1 : workers;
+    }
+
+    void runChunks(size_t count, size_t chunks, ChunkTask task, void* context) {
+        std::thread workers[MAX_WORKERS];
+        size_t chunkSize = count / chunks;
+        size_t extra = count % chunks;  // The first 'extra' chunks get one more item
+
+        size_t begin = 0;
+        size_t firstEnd = 0;
+        for (size_t c = 0; c < chunks; c++) {
+            size_t end = begin + chunkSize + (c < extra ? 1 : 0);
+            if (c == 0) {
+                firstEnd = end;  // Run on this thread, after launching the others
+            } else {
+                workers[c] = std::thread(task, context, c, begin, end);
+            }
+            begin = end;
+        }
+
+        task(context, 0, 0, firstEnd);
+
+        for (size_t c = 1; c < chunks; c++) {
+            workers[c].join();
+        }
+    }
+}
@@ -0,0 +1,304 @@
+#ifndef VECTORBULK_HPP
+#define VECTORBULK_HPP
+
+#include "Vector2d.hpp"
+#include "VectorSpan.hpp"
+#include <cstddef>
+
+/**
+ * VectorBulk - "Do X for every position" on whole arrays of vectors
+ *
+ * The Vector2d member functions stay the scalar path (one object, one
+ * call). These functions take a VectorSpan over contiguous positions
+ * and run one tight loop:
+ *
+ *   translateAll        points[i] += offset
+ *   distancesTo         out[i] = |points[i] - origin|
+ *   distancesSquaredTo  out[i] = |points[i] - origin|²   (range tests)
+ *   nearestOf           index of the point closest to origin
+ *   boundingBox         min / max corners of all points
+ *
+ * Vectorization: the loops read raw coordinates (no conversion, no
+ * check, no virtual call) and keep LANES independent accumulators
+ * (min/max pairs, or nearest candidates), so consecutive points do not
+ * wait on each other and the compiler can put several in one SIMD
+ * register.
+ *
+ * Callers own a contiguous array of positions. Game objects are not
+ * stored that way (GameManager holds them by pointer), so the game
+ * loops (culling, area of effect, pathing setup) walk the objects or
+ * SpatialGrid entries instead.
+ *
+ * Parallelism: with Execution::PARALLEL and at least PARALLEL_MIN_COUNT
+ * points, the span is cut into one chunk per hardware thread (at most
+ * MAX_WORKERS). Results do not depend on the split: min / max are exact
+ * and nearestOf keeps the lowest index on ties.
+ * Small spans always run on the calling thread and never allocate.
+ */
+namespace VectorBulk {
+
+    enum class Execution {
+        SEQUENTIAL,   // Calling thread only
+        PARALLEL      // Worker threads for large spans
+    };
+
+    const size_t PARALLEL_MIN_COUNT = 32768;  // Below this, threads cost more than they save
+    const size_t MAX_WORKERS = 16;
+    const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    // ========== CHUNK RUNNER ==========
+
+    typedef void (*ChunkTask)(void* context, size_t chunk, size_t begin, size_t end);
+
+    /**
+     * Number of chunks for 'count' items (1 = run on the calling thread)
+     */
+    size_t chunkCount(size_t count, Execution execution);
+
+    /**
+     * Run task on 'chunks' contiguous slices of [0, count): chunk 0 on
+     * the calling thread, the others on worker threads; returns when
+     * all are done
+     */
+    void runChunks(size_t count, size_t chunks, ChunkTask task, void* context);
+
+    namespace Detail {
+        const size_t LANES = 4;    // Independent accumulators per reduction
+
+        template<typename T>
+        struct NonDeduced {
+            typedef T type;
+        };
+
+        /**
+         * body(chunk, begin, end) on every chunk
+         */
+        template<typename Body>
+        size_t forChunks(size_t count, Execution execution, Body& body) {
+            size_t chunks = chunkCount(count, execution);
+            if (chunks <= 1) {
+                body(0, 0, count);
+                return 1;
+            }
+            runChunks(count, chunks, [](void* context, size_t chunk, size_t begin, size_t end) {
+                (*static_cast<Body*>(context))(chunk, begin, end);
+            }, &body);
+            return chunks;
+        }
+
+        template<typename T>
+        constexpr T minimum(T a, T b) { return b < a ? b : a; }
+
+        template<typename T>
+        constexpr T maximum(T a, T b) { return a < b ? b : a; }
+    }
+
+
+    // ========== TRANSFORMS ==========
+
+    /**
+     * points[i] += offset, for every point
+     */
+    template<typename T, typename P>
+    void translateAll(typename Detail::NonDeduced<VectorSpan<BasicVector2d<T, P>>>::type points,
+                      const BasicVector2d<T, P>& offset,
+                      Execution execution = Execution::SEQUENTIAL) {
+        BasicVector2d<T, P>* data = points.data();
+        auto body = [data, &offset](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                data[i] += offset;
+            }
+        };
+        Detail::forChunks(points.size(), execution, body);
+    }
+
+    /**
+     * out[i] = squared distance from points[i] to origin
+     * @pre out.size() >= points.size()
+     */
+    template<typename T, typename P>
+    void distancesSquaredTo(typename Detail::NonDeduced<VectorSpan<const BasicVector2d<T, P>>>::type points,
+                            const BasicVector2d<T, P>& origin, VectorSpan<double> out,
+                            Execution execution = Execution::SEQUENTIAL) {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        const BasicVector2d<T, P>* data = points.data();
+        double* result = out.data();
+        const T ox = origin.getRawX(), oy = origin.getRawY();
+        auto body = [=](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                T dx = data[i].getRawX() - ox;
+                T dy = data[i].getRawY() - oy;
+                result[i] = Traits::toDouble(dx * dx + dy * dy);
+            }
+        };
+        Detail::forChunks(points.size(), execution, body);
+    }
+
+    /**
+     * out[i] = distance from points[i] to origin (same value as
+     * points[i].distance(origin))
+     * @pre out.size() >= points.size()
+     */
+    template<typename T, typename P>
+    void distancesTo(typename Detail::NonDeduced<VectorSpan<const BasicVector2d<T, P>>>::type points,
+                     const BasicVector2d<T, P>& origin, VectorSpan<double> out,
+                     Execution execution = Execution::SEQUENTIAL) {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        const BasicVector2d<T, P>* data = points.data();
+        double* result = out.data();
+        const T ox = origin.getRawX(), oy = origin.getRawY();
+        auto body = [=](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                T dx = data[i].getRawX() - ox;
+                T dy = data[i].getRawY() - oy;
+                result[i] = Traits::toDouble(Traits::squareRoot(dx * dx + dy * dy));
+            }
+        };
+        Detail::forChunks(points.size(), execution, body);
+    }
+
+
+    // ========== REDUCTIONS ==========
+
+    /**
+     * Index of the point closest to origin (lowest index on ties)
+     * @return NOT_FOUND if the span is empty
+     */
+    template<typename T, typename P>
+    size_t nearestOf(typename Detail::NonDeduced<VectorSpan<const BasicVector2d<T, P>>>::type points,
+                     const BasicVector2d<T, P>& origin,
+                     Execution execution = Execution::SEQUENTIAL) {
+        if (points.empty()) {
+            return NOT_FOUND;
+        }
+        const BasicVector2d<T, P>* data = points.data();
+        const T ox = origin.getRawX(), oy = origin.getRawY();
+        size_t bestIndex[MAX_WORKERS];
+        T bestDistance[MAX_WORKERS];
+
+        auto body = [&](size_t chunk, size_t begin, size_t end) {
+            // One pass, LANES independent minima (point i goes to lane
+            // i % LANES): the compare / select chains run side by side
+            size_t laneIndex[Detail::LANES];
+            T laneSquared[Detail::LANES];
+            for (size_t lane = 0; lane < Detail::LANES; lane++) {
+                laneIndex[lane] = begin;
+                T dx = data[begin].getRawX() - ox;
+                T dy = data[begin].getRawY() - oy;
+                laneSquared[lane] = dx * dx + dy * dy;
+            }
+            size_t i = begin;
+            for (; i + Detail::LANES <= end; i += Detail::LANES) {
+                for (size_t lane = 0; lane < Detail::LANES; lane++) {
+                    T dx = data[i + lane].getRawX() - ox;
+                    T dy = data[i + lane].getRawY() - oy;
+                    T squared = dx * dx + dy * dy;
+                    if (squared < laneSquared[lane]) {  // Strict: first index of the lane wins ties
+                        laneSquared[lane] = squared;
+                        laneIndex[lane] = i + lane;
+                    }
+                }
+            }
+            for (; i < end; i++) {
+                T dx = data[i].getRawX() - ox;
+                T dy = data[i].getRawY() - oy;
+                T squared = dx * dx + dy * dy;
+                if (squared < laneSquared[0]) {
+                    laneSquared[0] = squared;
+                    laneIndex[0] = i;
+                }
+            }
+            // Lanes interleave: on ties, the lowest index wins explicitly
+            size_t best = laneIndex[0];
+            T bestSquared = laneSquared[0];
+            for (size_t lane = 1; lane < Detail::LANES; lane++) {
+                if (laneSquared[lane] < bestSquared
+                    || (!(bestSquared < laneSquared[lane]) && laneIndex[lane] < best)) {
+                    bestSquared = laneSquared[lane];
+                    best = laneIndex[lane];
+                }
+            }
+            bestIndex[chunk] = best;
+            bestDistance[chunk] = bestSquared;
+        };
+        size_t chunks = Detail::forChunks(points.size(), execution, body);
+
+        // Chunks are in index order: strict < keeps the lowest index
+        size_t best = bestIndex[0];
+        T bestSquared = bestDistance[0];
+        for (size_t c = 1; c < chunks; c++) {
+            if (bestDistance[c] < bestSquared) {
+                bestSquared = bestDistance[c];
+                best = bestIndex[c];
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Axis-aligned bounding box of all points
+     * @param min Receives (smallest x, smallest y)
+     * @param max Receives (largest x, largest y)
+     * @return false (min / max untouched) if the span is empty
+     */
+    template<typename T, typename P>
+    bool boundingBox(typename Detail::NonDeduced<VectorSpan<const BasicVector2d<T, P>>>::type points,
+                     BasicVector2d<T, P>& min, BasicVector2d<T, P>& max,
+                     Execution execution = Execution::SEQUENTIAL) {
+        if (points.empty()) {
+            return false;
+        }
+        const BasicVector2d<T, P>* data = points.data();
+        T minX[MAX_WORKERS], minY[MAX_WORKERS], maxX[MAX_WORKERS], maxY[MAX_WORKERS];
+
+        auto body = [&](size_t chunk, size_t begin, size_t end) {
+            // LANES independent accumulators: no loop-carried dependency
+            // between consecutive points
+            T lowX[Detail::LANES], lowY[Detail::LANES], highX[Detail::LANES], highY[Detail::LANES];
+            for (size_t lane = 0; lane < Detail::LANES; lane++) {
+                lowX[lane] = highX[lane] = data[begin].getRawX();
+                lowY[lane] = highY[lane] = data[begin].getRawY();
+            }
+            size_t i = begin;
+            for (; i + Detail::LANES <= end; i += Detail::LANES) {
+                for (size_t lane = 0; lane < Detail::LANES; lane++) {
+                    T x = data[i + lane].getRawX();
+                    T y = data[i + lane].getRawY();
+                    lowX[lane] = Detail::minimum(lowX[lane], x);
+                    lowY[lane] = Detail::minimum(lowY[lane], y);
+                    highX[lane] = Detail::maximum(highX[lane], x);
+                    highY[lane] = Detail::maximum(highY[lane], y);
+                }
+            }
+            for (; i < end; i++) {
+                lowX[0] = Detail::minimum(lowX[0], data[i].getRawX());
+                lowY[0] = Detail::minimum(lowY[0], data[i].getRawY());
+                highX[0] = Detail::maximum(highX[0], data[i].getRawX());
+                highY[0] = Detail::maximum(highY[0], data[i].getRawY());
+            }
+            for (size_t lane = 1; lane < Detail::LANES; lane++) {
+                lowX[0] = Detail::minimum(lowX[0], lowX[lane]);
+                lowY[0] = Detail::minimum(lowY[0], lowY[lane]);
+                highX[0] = Detail::maximum(highX[0], highX[lane]);
+                highY[0] = Detail::maximum(highY[0], highY[lane]);
+            }
+            minX[chunk] = lowX[0];
+            minY[chunk] = lowY[0];
+            maxX[chunk] = highX[0];
+            maxY[chunk] = highY[0];
+        };
+        size_t chunks = Detail::forChunks(points.size(), execution, body);
+
+        for (size_t c = 1; c < chunks; c++) {
+            minX[0] = Detail::minimum(minX[0], minX[c]);
+            minY[0] = Detail::minimum(minY[0], minY[c]);
+            maxX[0] = Detail::maximum(maxX[0], maxX[c]);
+            maxY[0] = Detail::maximum(maxY[0], maxY[c]);
+        }
+        min = BasicVector2d<T, P>::fromRaw(minX[0], minY[0]);
+        max = BasicVector2d<T, P>::fromRaw(maxX[0], maxY[0]);
+        return true;
+    }
+}
+
+#endif // VECTORBULK_HPP
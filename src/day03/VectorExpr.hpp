@@ -0,0 +1,204 @@
+#ifndef VECTOREXPR_HPP
+#define VECTOREXPR_HPP
+
+#include "FixedPoint.hpp"
+#include <cmath>      // For sqrt()
+#include <limits>     // For the float range
+#include <type_traits>
+
+/**
+ * VectorExpr - Scalar traits and expression templates for BasicVector2d
+ *
+ * Expression templates: a + (b - c) * k does NOT compute anything by
+ * itself. Each operator returns a tiny node that remembers its operands:
+ *
+ *   Sum< Leaf a, Scaled< Difference< Leaf b, Leaf c > > >
+ *
+ * The work happens once, when the expression is stored into a vector
+ * (constructor, =, +=, -=): each component is computed in one fused
+ * pass, x = a.x + (b.x - c.x) * k, with no intermediate vector.
+ *
+ * Leaves (vectors) are held by reference, nodes by value. As with any
+ * expression template library, do not keep an expression in an 'auto'
+ * variable beyond the statement that built it: store it in a vector.
+ *
+ * This is mostly about writing vector formulas. The optimizer already
+ * removes the temporaries of eager operators; what the fused form saves
+ * is their checks: with checked coordinates, one finiteness check per
+ * stored vector instead of one per operator. campus_bench expressions
+ * (Release, best of alternating rounds): x2.6-2.9 in double, parity
+ * (x0.98-1.01) in fixed 32.32, which has no result check.
+ * Used by enemy steering and the collision slide; ProjectileSystem
+ * keeps plain double lanes (struct of arrays, no Vector2d per slot).
+ */
+
+// ========== SCALAR TRAITS ==========
+
+/**
+ * Per-precision conversions used by BasicVector2d (all constexpr)
+ *
+ * fits(): can this double be stored in T?
+ * - float: finite and within float range (otherwise it becomes inf)
+ * - double: finite
+ * - Fixed32x32: finite and within +/- MAX_VALUE
+ *
+ * isValid(): is this computed T a usable coordinate?
+ * - float, double: finite (an overflow shows up as inf)
+ * - Fixed32x32: always (every raw value is a number; an overflow of
+ *   the 64-bit raw value cannot be seen afterwards)
+ */
+namespace VectorDetail {
+
+    /**
+     * constexpr replacement for std::isfinite (NaN != NaN, inf - inf = NaN)
+     */
+    constexpr bool isFinite(double value) {
+        return value == value && value - value == 0.0;
+    }
+
+    constexpr double absolute(double value) {
+        return value < 0.0 ? -value : value;
+    }
+
+    template<typename T>
+    struct ScalarTraits {
+        static constexpr bool fits(double value) {
+            return isFinite(value)
+                && absolute(value) <= static_cast<double>(std::numeric_limits<T>::max());
+        }
+        static constexpr bool isValid(T value) { return isFinite(static_cast<double>(value)); }
+        static constexpr T fromDouble(double value) { return static_cast<T>(value); }
+        static constexpr double toDouble(T value) { return static_cast<double>(value); }
+        static T squareRoot(T value) { return std::sqrt(value); }
+    };
+
+    template<>
+    struct ScalarTraits<Fixed32x32> {
+        static constexpr bool fits(double value) {
+            return isFinite(value) && absolute(value) <= Fixed32x32::MAX_VALUE;
+        }
+        static constexpr bool isValid(Fixed32x32) { return true; }
+        static constexpr Fixed32x32 fromDouble(double value) { return Fixed32x32::fromDouble(value); }
+        static constexpr double toDouble(Fixed32x32 value) { return value.toDouble(); }
+        static Fixed32x32 squareRoot(Fixed32x32 value) { return sqrt(value); }
+    };
+
+    /**
+     * How a node stores an operand: leaves by reference, nodes by value
+     */
+    template<typename E, bool Leaf = E::IS_LEAF>
+    struct ExprStorage {
+        typedef E type;
+    };
+
+    template<typename E>
+    struct ExprStorage<E, true> {
+        typedef const E& type;
+    };
+}
+
+
+// ========== EXPRESSION BASE ==========
+
+/**
+ * VecExpr - CRTP base of every vector expression (vectors included)
+ *
+ * Derived types provide: Scalar, IS_LEAF, getRawX(), getRawY().
+ */
+template<typename E>
+struct VecExpr {
+    constexpr const E& self() const { return static_cast<const E&>(*this); }
+};
+
+
+// ========== EXPRESSION NODES ==========
+
+/**
+ * VecSum - Lazy a + b
+ */
+template<typename L, typename R>
+class VecSum : public VecExpr<VecSum<L, R>> {
+    static_assert(std::is_same<typename L::Scalar, typename R::Scalar>::value,
+                  "Vector expressions cannot mix precisions");
+
+private:
+    typename VectorDetail::ExprStorage<L>::type left;
+    typename VectorDetail::ExprStorage<R>::type right;
+
+public:
+    typedef typename L::Scalar Scalar;
+    static constexpr bool IS_LEAF = false;
+
+    constexpr VecSum(const L& left, const R& right) : left(left), right(right) {}
+
+    constexpr Scalar getRawX() const { return left.getRawX() + right.getRawX(); }
+    constexpr Scalar getRawY() const { return left.getRawY() + right.getRawY(); }
+};
+
+/**
+ * VecDifference - Lazy a - b
+ */
+template<typename L, typename R>
+class VecDifference : public VecExpr<VecDifference<L, R>> {
+    static_assert(std::is_same<typename L::Scalar, typename R::Scalar>::value,
+                  "Vector expressions cannot mix precisions");
+
+private:
+    typename VectorDetail::ExprStorage<L>::type left;
+    typename VectorDetail::ExprStorage<R>::type right;
+
+public:
+    typedef typename L::Scalar Scalar;
+    static constexpr bool IS_LEAF = false;
+
+    constexpr VecDifference(const L& left, const R& right) : left(left), right(right) {}
+
+    constexpr Scalar getRawX() const { return left.getRawX() - right.getRawX(); }
+    constexpr Scalar getRawY() const { return left.getRawY() - right.getRawY(); }
+};
+
+/**
+ * VecScaled - Lazy a * k (the factor is converted to the precision once)
+ */
+template<typename E>
+class VecScaled : public VecExpr<VecScaled<E>> {
+public:
+    typedef typename E::Scalar Scalar;
+    static constexpr bool IS_LEAF = false;
+
+private:
+    typename VectorDetail::ExprStorage<E>::type operand;
+    Scalar factor;
+
+public:
+    constexpr VecScaled(const E& operand, double factor)
+        : operand(operand), factor(VectorDetail::ScalarTraits<Scalar>::fromDouble(factor)) {}
+
+    constexpr Scalar getRawX() const { return operand.getRawX() * factor; }
+    constexpr Scalar getRawY() const { return operand.getRawY() * factor; }
+};
+
+
+// ========== OPERATORS ==========
+
+template<typename L, typename R>
+constexpr VecSum<L, R> operator+(const VecExpr<L>& left, const VecExpr<R>& right) {
+    return VecSum<L, R>(left.self(), right.self());
+}
+
+template<typename L, typename R>
+constexpr VecDifference<L, R> operator-(const VecExpr<L>& left, const VecExpr<R>& right) {
+    return VecDifference<L, R>(left.self(), right.self());
+}
+
+template<typename E>
+constexpr VecScaled<E> operator*(const VecExpr<E>& operand, double factor) {
+    return VecScaled<E>(operand.self(), factor);
+}
+
+template<typename E>
+constexpr VecScaled<E> operator*(double factor, const VecExpr<E>& operand) {
+    return VecScaled<E>(operand.self(), factor);
+}
+
+#endif // VECTOREXPR_HPP
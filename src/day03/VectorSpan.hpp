@@ -0,0 +1,60 @@
+#ifndef VECTORSPAN_HPP
+#define VECTORSPAN_HPP
+
+#include <cstddef>
+
+/**
+ * VectorSpan - Non-owning view over contiguous elements (C++17 stand-in
+ * for std::span)
+ *
+ * Just a pointer and a count: cheap to copy, never allocates, never
+ * frees. Built from a pointer + size or from any contiguous container
+ * with data() and size() (std::vector, std::array, another span):
+ *
+ *   std::vector<Vector2d> positions = ...;
+ *   VectorSpan<const Vector2d> view(positions);
+ *
+ * The viewed storage must outlive the span (same rule as std::span).
+ */
+template<typename V>
+class VectorSpan {
+private:
+    V* first;       // First element (nullptr when empty)
+    size_t count;   // Number of elements
+
+public:
+    // ========== CONSTRUCTORS ==========
+
+    constexpr VectorSpan() : first(nullptr), count(0) {}
+
+    constexpr VectorSpan(V* first, size_t count) : first(first), count(count) {}
+
+    /**
+     * View a whole contiguous container (a VectorSpan<T> converts to a
+     * VectorSpan<const T> through this constructor too)
+     */
+    template<typename Container>
+    constexpr VectorSpan(Container& container) : first(container.data()), count(container.size()) {}
+
+
+    // ========== ACCESS ==========
+
+    constexpr size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr V* data() const { return first; }
+
+    constexpr V& operator[](size_t index) const { return first[index]; }
+
+    constexpr V* begin() const { return first; }
+    constexpr V* end() const { return first + count; }
+
+    /**
+     * Elements [offset, offset + length)
+     * @pre offset + length <= size()
+     */
+    constexpr VectorSpan subspan(size_t offset, size_t length) const {
+        return VectorSpan(first + offset, length);
+    }
+};
+
+#endif // VECTORSPAN_HPP
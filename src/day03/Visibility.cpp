@@ -0,0 +1,182 @@
+#include "Visibility.hpp"
+#include <cmath>
+#include <cstdlib>
+
+// ========== LINE OF SIGHT ==========
+
+bool LineOfSight::isClear(const NavGrid& grid, double fromX, double fromY, double toX, double toY) {
+    // Cell coordinates: cell c covers [c - 0.5, c + 0.5[ around its centre,
+    // shift by 0.5 so that cell borders fall on integers
+    const double startX = fromX - grid.getOriginX() + 0.5;
+    const double startY = fromY - grid.getOriginY() + 0.5;
+    const double endX = toX - grid.getOriginX() + 0.5;
+    const double endY = toY - grid.getOriginY() + 0.5;
+
+    int cx = static_cast<int>(std::floor(startX));
+    int cy = static_cast<int>(std::floor(startY));
+    const int lastX = static_cast<int>(std::floor(endX));
+    const int lastY = static_cast<int>(std::floor(endY));
+
+    const double dx = endX - startX;
+    const double dy = endY - startY;
+    const int stepX = dx > 0.0 ? 1 : -1;
+    const int stepY = dy > 0.0 ? 1 : -1;
+
+    // t (0..1 along the segment) of the next vertical / horizontal border,
+    // and the t distance between two borders
+    const double deltaX = dx != 0.0 ? std::fabs(1.0 / dx) : INFINITY;
+    const double deltaY = dy != 0.0 ? std::fabs(1.0 / dy) : INFINITY;
+    double nextX = dx != 0.0 ? (stepX > 0 ? (cx + 1 - startX) : (startX - cx)) * deltaX : INFINITY;
+    double nextY = dy != 0.0 ? (stepY > 0 ? (cy + 1 - startY) : (startY - cy)) * deltaY : INFINITY;
+
+    // Every step crosses one border: exactly |lastX - cx| + |lastY - cy|
+    // steps (a bound even if rounding picks the other border on a tie);
+    // the last one enters the target's cell, which does not block
+    int steps = std::abs(lastX - cx) + std::abs(lastY - cy);
+    for (int i = 1; i < steps; i++) {
+        if (nextX < nextY) {
+            cx += stepX;
+            nextX += deltaX;
+        } else {
+            cy += stepY;
+            nextY += deltaY;
+        }
+        if (grid.inBounds(cx, cy) && grid.isBlocked(cx, cy)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// ========== VISIBILITY FIELD ==========
+
+VisibilityField::VisibilityField(int radius)
+    : grid(nullptr),
+      originCellX(0),
+      originCellY(0),
+      radius(radius),
+      gridVersion(0),
+      valid(false),
+      generation(0)
+{
+}
+
+/**
+ * Recursive shadowcasting
+ *
+ * Each of the 8 octants is mapped onto the same canonical one (rows
+ * going away from the viewer, columns from the diagonal to the axis)
+ * by the multipliers (xx, xy, yx, yy); castLight scans it.
+ */
+bool VisibilityField::build(const NavGrid& navGrid, double viewerX, double viewerY) {
+    int cx, cy;
+    if (!navGrid.worldToCell(viewerX, viewerY, cx, cy)) {
+        invalidate();
+        return false;
+    }
+    if (valid && grid == &navGrid && gridVersion == navGrid.getVersion()
+        && cx == originCellX && cy == originCellY) {
+        return true;  // Same viewer cell, same obstacles
+    }
+
+    if (!grid || grid->getCellCount() != navGrid.getCellCount() || generation == UINT32_MAX) {
+        seen.assign(navGrid.getCellCount(), 0);  // Only allocates if the grid grew
+        generation = 0;
+    }
+    grid = &navGrid;
+    gridVersion = navGrid.getVersion();
+    originCellX = cx;
+    originCellY = cy;
+    valid = true;
+    generation++;
+
+    seen[navGrid.index(cx, cy)] = generation;
+    static const int OCTANTS[8][4] = {
+        { 1, 0, 0, 1 }, { 0, 1, 1, 0 }, { 0, -1, 1, 0 }, { -1, 0, 0, 1 },
+        { -1, 0, 0, -1 }, { 0, -1, -1, 0 }, { 0, 1, -1, 0 }, { 1, 0, 0, -1 }
+    };
+    for (const int (&octant)[4] : OCTANTS) {
+        castLight(1, 1.0, 0.0, octant[0], octant[1], octant[2], octant[3]);
+    }
+    return true;
+}
+
+/**
+ * Scan rows 'row'..radius of one octant between two slopes
+ *
+ * A run of blocked cells narrows the light: the rows beyond it are
+ * scanned by a recursive call with the slopes still open before the
+ * run, and this scan goes on after it.
+ *
+ * A cell is seen if its CENTRE is lit (a corner peeking into the light
+ * is not enough), the rule LineOfSight::isClear applies between cell
+ * centres; a blocked cell still casts the shadow of its whole square.
+ */
+void VisibilityField::castLight(int row, double startSlope, double endSlope, int xx, int xy, int yx, int yy) {
+    if (startSlope < endSlope) {
+        return;
+    }
+    const int radiusSquared = radius * radius;
+    double nextStart = startSlope;
+    for (int distance = row; distance <= radius; distance++) {
+        bool blocked = false;
+        const int dy = -distance;
+        for (int dx = -distance; dx <= 0; dx++) {
+            const double leftSlope = (dx - 0.5) / (dy + 0.5);
+            const double rightSlope = (dx + 0.5) / (dy - 0.5);
+            if (startSlope < rightSlope) {
+                continue;
+            }
+            if (endSlope > leftSlope) {
+                break;
+            }
+
+            const int cellX = originCellX + dx * xx + dy * xy;
+            const int cellY = originCellY + dx * yx + dy * yy;
+            const bool inside = grid->inBounds(cellX, cellY);
+            const double centerSlope = static_cast<double>(dx) / dy;
+            if (inside && dx * dx + dy * dy <= radiusSquared
+                && centerSlope <= startSlope && centerSlope >= endSlope) {
+                seen[grid->index(cellX, cellY)] = generation;
+            }
+
+            const bool opaque = !inside || grid->isBlocked(cellX, cellY);
+            if (blocked) {
+                if (opaque) {
+                    nextStart = rightSlope;
+                    continue;
+                }
+                blocked = false;
+                startSlope = nextStart;
+            } else if (opaque && distance < radius) {
+                blocked = true;
+                castLight(distance + 1, startSlope, leftSlope, xx, xy, yx, yy);
+                nextStart = rightSlope;
+            }
+        }
+        if (blocked) {
+            break;
+        }
+    }
+}
+
+void VisibilityField::invalidate() {
+    valid = false;
+}
+
+
+// ========== QUERIES ==========
+
+bool VisibilityField::isOriginCell(double x, double y) const {
+    int cx, cy;
+    return valid && grid->worldToCell(x, y, cx, cy) && cx == originCellX && cy == originCellY;
+}
+
+bool VisibilityField::isVisible(double x, double y) const {
+    int cx, cy;
+    if (!valid || !grid->worldToCell(x, y, cx, cy)) {
+        return false;
+    }
+    return seen[grid->index(cx, cy)] == generation;
+}
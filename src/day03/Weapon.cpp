@@ -1,34 +1,26 @@
 #include "Weapon.hpp"
+#include "AreaOfEffect.hpp"
+#include <iostream>
 
-// ========== CONSTRUCTOR & DESTRUCTOR ==========
+// ========== CONSTRUCTOR ==========
 
-/**
- * Constructor - initializes weapon stats
- * 
- * Protected: Can only be called by subclass constructors
- */
-Weapon::Weapon(int range, int power) : range(range), power(power) {
-    // Initialize range and power using member initializer list
-    // Subclasses will call this to set their specific stats
-}
-
-/**
- * Virtual destructor
- * 
- * Even though we don't have dynamic memory here, virtual destructor
- * is essential for polymorphism. Without it:
- * 
- *   Weapon* w = new Sword();
- *   delete w;  // Without virtual: only ~Weapon() runs (BAD!)
- *              // With virtual: ~Sword() then ~Weapon() (GOOD!)
- */
-Weapon::~Weapon() {
-    // No manual cleanup needed, but must be virtual
+Weapon::Weapon(int id, const std::string& name, int range, int power, AttackStyle style,
+               AreaShape area, double areaSize)
+    : id(id), name(&name), range(range), power(power), style(style), area(area), areaSize(areaSize)
+{
 }
 
 
 // ========== ACCESSORS ==========
 
+int Weapon::getId() const {
+    return id;
+}
+
+const std::string& Weapon::getName() const {
+    return *name;
+}
+
 int Weapon::getRange() const {
     return range;
 }
@@ -37,10 +29,65 @@ int Weapon::getPower() const {
     return power;
 }
 
+AttackStyle Weapon::getStyle() const {
+    return style;
+}
+
+AreaShape Weapon::getArea() const {
+    return area;
+}
 
-// ========== PURE VIRTUAL METHODS ==========
+double Weapon::getAreaSize() const {
+    return areaSize;
+}
 
-// NOTE: We do NOT implement getName() and attack() here!
-// They are pure virtual (= 0), so subclasses MUST provide implementation.
-// This makes Weapon an abstract class - cannot be instantiated directly.
 
+// ========== COMBAT ==========
+
+/**
+ * Attack implementation (shared by every weapon)
+ * 
+ * 1. Style-specific announce (switch over the style)
+ * 2. Queue 'power' damage on the target; the Game logs the result
+ *    when it resolves the phase
+ * 3. Area weapons: one spatial query collects everyone else in the
+ *    area, each one gets the same hit queued (one batch, resolved with
+ *    the rest of the phase)
+ */
+void Weapon::attack(Character& attacker, Character& target, AreaOfEffect* areaOfEffect) const {
+    switch (style) {
+        case AttackStyle::SHOT:
+            std::cout << "🏹 " << *name << " shoots arrow!" << std::endl;
+            break;
+        case AttackStyle::THRUST:
+            std::cout << "🗡️  " << *name << " thrust!" << std::endl;
+            break;
+        case AttackStyle::SLASH:
+            std::cout << "⚔️  " << *name << " slash!" << std::endl;
+            break;
+    }
+    
+    attacker.dealDamage(target, power, CombatBuffer::Source::WEAPON, id);
+    
+    if (area == AreaShape::SINGLE || !areaOfEffect) {
+        return;
+    }
+    const std::vector<Character*>& others = areaOfEffect->collect(attacker, target, *this);
+    if (others.empty()) {
+        return;
+    }
+    switch (area) {
+        case AreaShape::LINE:
+            std::cout << "    ➶ " << *name << " pierces " << others.size() << " more!" << std::endl;
+            break;
+        case AreaShape::ARC:
+            std::cout << "    ➰ " << *name << " sweeps " << others.size() << " more!" << std::endl;
+            break;
+        default:
+            std::cout << "    💥 " << *name << " blast catches " << others.size() << " more!" << std::endl;
+            break;
+    }
+    for (Character* other : others) {
+        attacker.dealDamage(*other, power, CombatBuffer::Source::WEAPON, id);
+    }
+}
@@ -2,48 +2,78 @@
 #define WEAPON_HPP
 
 #include "Character.hpp"
+#include <cstdint>
 #include <string>
 
+class AreaOfEffect;
+
+/**
+ * How a weapon attacks (decides the log line and, for SHOT, that the
+ * interactive attack fires a projectile)
+ */
+enum class AttackStyle : uint8_t {
+    SHOT,      // Ranged: arrows, bolts...
+    THRUST,    // Reach: spears, pikes...
+    SLASH      // Melee: swords, axes...
+};
+
 /**
- * Weapon - Interface/Abstract base class for all weapons
+ * What a hit covers besides the target (sizes in WeaponTable rows)
+ */
+enum class AreaShape : uint8_t {
+    SINGLE,    // The target only
+    LINE,      // Pierces: everyone within 'range' along the aim, size = half width
+    ARC,       // Sweeps: everyone within 'range' around the aim, size = half angle (degrees)
+    BLAST      // Explodes: everyone within 'size' of the target / impact point
+};
+
+/**
+ * Weapon - One row of the WeaponTable
  * 
- * This is an INTERFACE (mostly) - defines the contract for all weapons.
- * Cannot be instantiated directly (has pure virtual methods).
+ * Weapons are DATA, not classes: a weapon is an id, an interned name,
+ * range, power, an attack style and an area, loaded from weapons.cfg
+ * (see WeaponTable). Adding a weapon type is one more line in the file.
  * 
- * Design Pattern: Strategy Pattern
- * - Different weapons = different attack strategies
- * - Can be used polymorphically
- * - Allows runtime weapon switching
+ * No virtual functions:
+ * - getName() returns a reference to the name interned in the table
+ *   (no std::string built per call)
+ * - attack() is a switch over the style: one predictable branch,
+ *   instead of an indirect call through a vtable
  * 
- * NOTE: This is a "pragmatic interface" - it has protected data members
- * (range, power) for convenience. A "pure interface" would only have
- * pure virtual methods, but this is common in game development.
+ * Weapons are owned by their WeaponTable; everyone else holds const
+ * pointers or ids.
  */
 class Weapon {
-protected:
-    // Weapon statistics
-    int range;  // Attack range (distance units)
-    int power;  // Attack power (damage dealt)
+private:
+    int id;                    // Index in the table
+    const std::string* name;   // Interned in the table
+    int range;                 // Attack range (distance units)
+    int power;                 // Attack power (damage dealt)
+    AttackStyle style;
+    AreaShape area;
+    double areaSize;           // Meaning depends on the area (see AreaShape)
 
 public:
-    // ========== CONSTRUCTOR & DESTRUCTOR ==========
-    
-    /**
-     * Protected constructor - only subclasses can call this
-     * @param range Attack range
-     * @param power Attack power/damage
-     */
-    Weapon(int range, int power);
+    // ========== CONSTRUCTOR ==========
     
     /**
-     * Virtual destructor - CRITICAL for polymorphism!
-     * Ensures proper cleanup when deleting through base pointer
+     * Constructor (used by WeaponTable)
+     * @param name Must outlive the weapon (interned by the table)
      */
-    virtual ~Weapon();
+    Weapon(int id, const std::string& name, int range, int power, AttackStyle style,
+           AreaShape area = AreaShape::SINGLE, double areaSize = 0.0);
     
     
     // ========== ACCESSORS ==========
     
+    int getId() const;
+    
+    /**
+     * Get weapon's name (e.g., "Bow", "Sword")
+     * @return Reference to the interned name (no copy)
+     */
+    const std::string& getName() const;
+    
     /**
      * Get weapon's attack range
      * @return Range value
@@ -56,29 +86,28 @@ public:
      */
     int getPower() const;
     
+    AttackStyle getStyle() const;
+    AreaShape getArea() const;
+    double getAreaSize() const;
     
-    // ========== PURE VIRTUAL METHODS (INTERFACE) ==========
     
-    /**
-     * Get weapon's name/type
-     * @return Weapon name (e.g., "Bow", "Sword")
-     * 
-     * PURE VIRTUAL - each weapon must identify itself
-     */
-    virtual std::string getName() const = 0;
+    // ========== COMBAT ==========
     
     /**
      * Attack a character
+     * @param attacker Character holding the weapon
      * @param target Reference to the character being attacked
      * 
-     * PURE VIRTUAL - each weapon implements its own attack logic
+     * @param areaOfEffect Collects the other characters of the area
+     *        (nullptr = the target only, whatever the area)
      * 
-     * This is the core of the Strategy Pattern:
-     * - Same interface (attack a character)
-     * - Different implementations (bow vs sword damage application)
+     * Announces the attack and queues 'power' damage through the
+     * attacker (see Character::dealDamage), on the target first, then
+     * on everyone else in the area (nearest first). Same damage rule for
+     * every style; the style only picks the message (switch, no virtual
+     * call).
      */
-    virtual void attack(Character& target) = 0;
+    void attack(Character& attacker, Character& target, AreaOfEffect* areaOfEffect = nullptr) const;
 };
 
 #endif // WEAPON_HPP
-
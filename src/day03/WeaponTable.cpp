@@ -0,0 +1,166 @@
+#include "WeaponTable.hpp"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+// ========== CONSTRUCTOR ==========
+
+WeaponTable::WeaponTable()
+{
+}
+
+
+// ========== LOADING ==========
+
+int WeaponTable::add(const std::string& name, int range, int power, AttackStyle style,
+                     AreaShape area, double areaSize) {
+    int id = static_cast<int>(weapons.size());
+    names.push_back(name);
+    weapons.emplace_back(id, names.back(), range, power, style, area, areaSize);
+    return id;
+}
+
+void WeaponTable::clear() {
+    weapons.clear();
+    names.clear();
+}
+
+void WeaponTable::loadBuiltin() {
+    clear();
+    add("Bow", 4, 1, AttackStyle::SHOT, AreaShape::BLAST, 1.0);
+    add("Spear", 2, 2, AttackStyle::THRUST, AreaShape::LINE, 0.5);
+    add("Sword", 1, 4, AttackStyle::SLASH, AreaShape::ARC, 60.0);
+}
+
+bool WeaponTable::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    loadFromStream(file);
+    return true;
+}
+
+/**
+ * Parse every row first, then swap them in: a bad file leaves the
+ * table as it was
+ */
+void WeaponTable::loadFromStream(std::istream& input) {
+    WeaponTable parsed;
+    std::string line;
+    int lineNumber = 0;
+    
+    while (std::getline(input, line)) {
+        lineNumber++;
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name)) {
+            continue;  // Blank or comment-only line
+        }
+        
+        int range, power;
+        std::string styleText, areaText, extra;
+        AttackStyle style;
+        AreaShape area = AreaShape::SINGLE;
+        double areaSize = 0.0;
+        bool valid = (fields >> range >> power >> styleText)
+            && range >= 0 && power >= 0 && parseStyle(styleText, style);
+        if (valid && (fields >> areaText)) {
+            // Optional area: name and a positive size, nothing after
+            valid = parseArea(areaText, area) && (fields >> areaSize) && areaSize > 0.0;
+        }
+        if (!valid || (fields >> extra)) {
+            throw std::runtime_error("weapons: line " + std::to_string(lineNumber)
+                                     + ": expected 'name range power shot|thrust|slash [line|arc|blast size]'");
+        }
+        if (parsed.findByName(name) != NOT_FOUND) {
+            throw std::runtime_error("weapons: line " + std::to_string(lineNumber)
+                                     + ": duplicate weapon '" + name + "'");
+        }
+        parsed.add(name, range, power, style, area, areaSize);
+    }
+    
+    if (parsed.weapons.empty()) {
+        throw std::runtime_error("weapons: no weapon defined");
+    }
+    
+    // Deque swap keeps the element addresses: the parsed weapons still
+    // point to their (now our) names
+    weapons.swap(parsed.weapons);
+    names.swap(parsed.names);
+}
+
+const WeaponTable& WeaponTable::getBuiltin() {
+    static WeaponTable builtin;
+    static const bool loaded = (builtin.loadBuiltin(), true);
+    (void)loaded;
+    return builtin;
+}
+
+
+// ========== QUERIES ==========
+
+int WeaponTable::size() const {
+    return static_cast<int>(weapons.size());
+}
+
+const Weapon& WeaponTable::get(int id) const {
+    return weapons[id];
+}
+
+int WeaponTable::findByName(const std::string& name) const {
+    for (const Weapon& weapon : weapons) {
+        if (weapon.getName() == name) {
+            return weapon.getId();
+        }
+    }
+    return NOT_FOUND;
+}
+
+bool WeaponTable::parseStyle(const std::string& text, AttackStyle& style) {
+    if (text == "shot") {
+        style = AttackStyle::SHOT;
+    } else if (text == "thrust") {
+        style = AttackStyle::THRUST;
+    } else if (text == "slash") {
+        style = AttackStyle::SLASH;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* WeaponTable::getStyleName(AttackStyle style) {
+    switch (style) {
+        case AttackStyle::SHOT:   return "shot";
+        case AttackStyle::THRUST: return "thrust";
+        default:                  return "slash";
+    }
+}
+
+bool WeaponTable::parseArea(const std::string& text, AreaShape& area) {
+    if (text == "line") {
+        area = AreaShape::LINE;
+    } else if (text == "arc") {
+        area = AreaShape::ARC;
+    } else if (text == "blast") {
+        area = AreaShape::BLAST;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* WeaponTable::getAreaName(AreaShape area) {
+    switch (area) {
+        case AreaShape::LINE:  return "line";
+        case AreaShape::ARC:   return "arc";
+        case AreaShape::BLAST: return "blast";
+        default:               return "single";
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef WEAPONTABLE_HPP
+#define WEAPONTABLE_HPP
+
+#include "Weapon.hpp"
+#include <deque>
+#include <istream>
+#include <string>
+#include <vector>
+
+/**
+ * WeaponTable - Every weapon type of the game, as rows of data
+ * 
+ * Row i is the weapon with id i. A Player only keeps the id of the
+ * weapon in hand; switching weapon is (id + 1) % size().
+ * 
+ * Config file format (data/weapons.cfg), one weapon per line:
+ * 
+ *   # name   range  power  style   [area size]
+ *   Bow      4      1      shot    blast 1
+ *   Spear    2      2      thrust  line 0.5
+ *   Dagger   1      2      slash
+ * 
+ * The area is optional (default: the target only), see AreaShape.
+ * 
+ * Blank lines and '#' comments are ignored. Order of the rows = order
+ * of the weapon cycle.
+ * 
+ * Names are interned: stored once here (in a deque, so their address
+ * never moves), weapons point to them.
+ * 
+ * Not copyable: weapons point into this table's name storage.
+ */
+class WeaponTable {
+private:
+    std::vector<Weapon> weapons;   // Indexed by weapon id
+    std::deque<std::string> names; // Interned names (stable addresses)
+
+public:
+    static constexpr int NOT_FOUND = -1;
+
+    // ========== CONSTRUCTOR ==========
+    
+    /**
+     * Empty table (call loadFromFile or loadBuiltin)
+     */
+    WeaponTable();
+    
+    WeaponTable(const WeaponTable&) = delete;
+    WeaponTable& operator=(const WeaponTable&) = delete;
+    
+    
+    // ========== LOADING ==========
+    
+    /**
+     * Add a weapon type
+     * @return Its id (index of the new row)
+     */
+    int add(const std::string& name, int range, int power, AttackStyle style,
+            AreaShape area = AreaShape::SINGLE, double areaSize = 0.0);
+    
+    /**
+     * Remove every weapon (setup only: players hold ids into the table)
+     */
+    void clear();
+    
+    /**
+     * Replace the content with the original Bow / Spear / Sword set
+     * (explosive arrows, piercing spear, sweeping sword)
+     */
+    void loadBuiltin();
+    
+    /**
+     * Replace the content with the rows of a config file
+     * @return false if the file cannot be opened (table unchanged)
+     * @throws std::runtime_error on a malformed line or an empty table
+     */
+    bool loadFromFile(const std::string& path);
+    
+    /**
+     * Replace the content with the rows read from a stream
+     * @throws std::runtime_error on a malformed line or an empty table
+     */
+    void loadFromStream(std::istream& input);
+    
+    /**
+     * Shared built-in table (used when nobody provides one)
+     */
+    static const WeaponTable& getBuiltin();
+    
+    
+    // ========== QUERIES ==========
+    
+    int size() const;
+    
+    /**
+     * Row of a weapon id (no bounds check, ids come from this table)
+     */
+    const Weapon& get(int id) const;
+    
+    /**
+     * @return Id of the weapon with this name, NOT_FOUND otherwise
+     */
+    int findByName(const std::string& name) const;
+    
+    /**
+     * Parse "shot" / "thrust" / "slash"
+     * @return false for an unknown style
+     */
+    static bool parseStyle(const std::string& text, AttackStyle& style);
+    
+    static const char* getStyleName(AttackStyle style);
+    
+    /**
+     * Parse "line" / "arc" / "blast"
+     * @return false for an unknown area
+     */
+    static bool parseArea(const std::string& text, AreaShape& area);
+    
+    static const char* getAreaName(AreaShape area);
+};
+
+#endif // WEAPONTABLE_HPP
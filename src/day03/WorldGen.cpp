@@ -0,0 +1,357 @@
+#include "WorldGen.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const double PI = 3.14159265358979323846;
+    const double POISSON_FILL = 0.7;   // Bridson samples per spacing² (for the size hint)
+    const size_t BATCH_PER_WORKER = 4; // Regions per worker between two emissions
+
+    /**
+     * Camp kinds: one name per camp, health varies by +/- 20%
+     */
+    struct EnemyKind {
+        const char* name;
+        int health;
+        int damage;
+    };
+
+    const EnemyKind ENEMY_KINDS[] = {
+        { "Goblin", 25, 6 },
+        { "Orc", 35, 8 },
+        { "Troll", 40, 10 },
+        { "Skeleton", 20, 5 }
+    };
+    const size_t ENEMY_KIND_COUNT = sizeof(ENEMY_KINDS) / sizeof(ENEMY_KINDS[0]);
+
+    const char* const DECOR_NAMES[] = { "Ancient Tree", "Boulder", "Ruins" };
+    const size_t DECOR_NAME_COUNT = sizeof(DECOR_NAMES) / sizeof(DECOR_NAMES[0]);
+
+    /**
+     * Poisson-distributed count (Knuth: fine for small means)
+     */
+    int poisson(Rng& rng, double mean) {
+        double limit = std::exp(-mean);
+        double product = rng.uniform();
+        int count = 0;
+        while (product > limit) {
+            count++;
+            product *= rng.uniform();
+        }
+        return count;
+    }
+
+    /**
+     * Nearest 1/100 (divided last: 58.05, not 58.050000000000004)
+     */
+    double quantize(double value) {
+        return std::round(value * WorldGenerator::STEPS_PER_UNIT) / WorldGenerator::STEPS_PER_UNIT;
+    }
+}
+
+
+// ========== REGION BUFFERS ==========
+
+/**
+ * Output of one region (and the scratch space to build it), reused
+ * from batch to batch
+ */
+struct WorldGenerator::RegionContent {
+    struct Spawn {
+        double x;
+        double y;
+        uint16_t kind;    // Index in ENEMY_KINDS / DECOR_NAMES
+        int health;
+    };
+
+    std::vector<Spawn> decor;
+    std::vector<Spawn> enemies;
+    size_t camps = 0;
+
+    // Bridson scratch: background grid (sample index or -1) and active list
+    std::vector<int32_t> grid;
+    std::vector<uint32_t> active;
+    int gridWidth = 0;
+    int gridHeight = 0;
+    double gridX0 = 0.0;
+    double gridY0 = 0.0;
+    double cellSize = 1.0;
+
+    void clear() {
+        decor.clear();
+        enemies.clear();
+        camps = 0;
+    }
+
+    /**
+     * Is any decor closer than 'distance' to (x, y)?
+     */
+    bool nearDecor(double x, double y, double distance) const {
+        if (gridWidth == 0) {
+            return false;
+        }
+        int reach = static_cast<int>(std::ceil(distance / cellSize));
+        int cx = static_cast<int>(std::floor((x - gridX0) / cellSize));
+        int cy = static_cast<int>(std::floor((y - gridY0) / cellSize));
+        int minX = std::max(cx - reach, 0), maxX = std::min(cx + reach, gridWidth - 1);
+        int minY = std::max(cy - reach, 0), maxY = std::min(cy + reach, gridHeight - 1);
+        double limit = distance * distance;
+        for (int gy = minY; gy <= maxY; gy++) {
+            for (int gx = minX; gx <= maxX; gx++) {
+                int32_t index = grid[static_cast<size_t>(gy) * gridWidth + gx];
+                if (index < 0) {
+                    continue;
+                }
+                double dx = decor[index].x - x;
+                double dy = decor[index].y - y;
+                if (dx * dx + dy * dy < limit) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * Parallel part of a batch: regions [first, first + count) into
+ * contents[0, count)
+ */
+struct WorldGenerator::BatchTask {
+    const WorldGenerator* generator;
+    RegionContent* contents;
+    size_t first;
+
+    static void run(void* context, size_t, size_t begin, size_t end) {
+        BatchTask* task = static_cast<BatchTask*>(context);
+        for (size_t i = begin; i < end; i++) {
+            task->generator->generateRegion(task->first + i, task->contents[i]);
+        }
+    }
+};
+
+
+// ========== CONSTRUCTOR ==========
+
+WorldGenerator::WorldGenerator(const WorldGenConfig& config)
+    : config(config), regionsX(0), regionsY(0)
+{
+    if (!(config.width > 0.0) || !(config.height > 0.0) || !(config.regionSize > 0.0)) {
+        throw std::invalid_argument("worldgen: width, height and regionSize must be positive");
+    }
+    if (!(config.decorSpacing >= 0.0) || !(config.campDensity >= 0.0) || !(config.campRadius >= 0.0)
+        || !(config.safeRadius >= 0.0) || config.enemiesPerCamp < 0) {
+        throw std::invalid_argument("worldgen: spacing, densities and radii cannot be negative");
+    }
+    if (config.decorSpacing > 0.0 && config.decorSpacing * STEPS_PER_UNIT < 10.0) {
+        throw std::invalid_argument("worldgen: decorSpacing is too small");
+    }
+    if (config.width > 1e6 || config.height > 1e6) {
+        throw std::invalid_argument("worldgen: map larger than 1e6 units");
+    }
+    regionsX = static_cast<int>(std::ceil(config.width / config.regionSize));
+    regionsY = static_cast<int>(std::ceil(config.height / config.regionSize));
+}
+
+
+// ========== ACCESSORS ==========
+
+const WorldGenConfig& WorldGenerator::getConfig() const {
+    return config;
+}
+
+size_t WorldGenerator::getRegionCount() const {
+    return static_cast<size_t>(regionsX) * regionsY;
+}
+
+
+// ========== GENERATION ==========
+
+/**
+ * Generate batches of regions (in parallel if asked), then emit each
+ * batch in region order: the sink always sees the same sequence
+ */
+WorldGenStats WorldGenerator::generate(ScenarioSink& sink, VectorBulk::Execution execution) const {
+    WorldGenStats stats;
+    stats.regions = getRegionCount();
+
+    size_t workers = 1;
+    if (execution == VectorBulk::Execution::PARALLEL) {
+        workers = std::thread::hardware_concurrency();  // 0 if unknown
+        workers = std::max<size_t>(1, std::min(workers, VectorBulk::MAX_WORKERS));
+    }
+    size_t batchSize = std::min(stats.regions, workers * BATCH_PER_WORKER);
+    std::vector<RegionContent> contents(batchSize);
+
+    // Header: size hint, rules, player
+    double area = config.width * config.height;
+    double expected = area * config.campDensity / 10000.0 * config.enemiesPerCamp;
+    if (config.decorSpacing > 0.0) {
+        expected += area * POISSON_FILL / (config.decorSpacing * config.decorSpacing);
+    }
+    sink.onReserve(static_cast<size_t>(expected) + 1);
+    if (config.maxTurns > 0) {
+        sink.onRule(ScenarioRule::MAX_TURNS, config.maxTurns);
+    }
+    sink.onPlayer("Hero", quantize(config.width / 2), quantize(config.height / 2), config.playerHealth);
+
+    std::string name;
+    for (size_t first = 0; first < stats.regions; first += batchSize) {
+        size_t count = std::min(batchSize, stats.regions - first);
+        BatchTask task{ this, contents.data(), first };
+        size_t chunks = std::min(workers, count);
+        if (chunks <= 1) {
+            BatchTask::run(&task, 0, 0, count);
+        } else {
+            VectorBulk::runChunks(count, chunks, BatchTask::run, &task);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const RegionContent& region = contents[i];
+            for (const RegionContent::Spawn& spawn : region.decor) {
+                name = DECOR_NAMES[spawn.kind];
+                sink.onDecor(name, spawn.x, spawn.y);
+            }
+            for (const RegionContent::Spawn& spawn : region.enemies) {
+                const EnemyKind& kind = ENEMY_KINDS[spawn.kind];
+                name = kind.name;
+                sink.onEnemy(name, spawn.x, spawn.y, spawn.health, kind.damage);
+            }
+            stats.decor += region.decor.size();
+            stats.enemies += region.enemies.size();
+            stats.camps += region.camps;
+        }
+    }
+    return stats;
+}
+
+void WorldGenerator::generateRegion(size_t region, RegionContent& out) const {
+    out.clear();
+    double x0 = (region % regionsX) * config.regionSize;
+    double y0 = (region / regionsX) * config.regionSize;
+    double x1 = std::min(x0 + config.regionSize, config.width);
+    double y1 = std::min(y0 + config.regionSize, config.height);
+
+    Rng rng = Rng::forStream(config.seed, region);
+    out.gridWidth = 0;
+    if (config.decorSpacing > 0.0) {
+        placeDecor(x0, y0, x1, y1, out, rng);
+    }
+    if (config.campDensity > 0.0 && config.enemiesPerCamp > 0) {
+        placeCamps(x0, y0, x1, y1, out, rng);
+    }
+}
+
+/**
+ * Bridson's Poisson-disc sampling inside the region, minus a
+ * spacing / 2 border
+ *
+ * Background grid with cells of spacing / sqrt(2): at most one sample
+ * per cell, and a candidate only has to look at the 5x5 cells around
+ * it. Each active sample tries DECOR_ATTEMPTS candidates in the ring
+ * [spacing, 2 * spacing) before it retires.
+ */
+void WorldGenerator::placeDecor(double x0, double y0, double x1, double y1,
+                                RegionContent& out, Rng& rng) const {
+    const double spacing = config.decorSpacing;
+    const double minX = x0 + spacing / 2, maxX = x1 - spacing / 2;
+    const double minY = y0 + spacing / 2, maxY = y1 - spacing / 2;
+    if (minX >= maxX || minY >= maxY) {
+        return;  // Region smaller than the spacing
+    }
+
+    out.cellSize = spacing / std::sqrt(2.0);
+    out.gridX0 = minX;
+    out.gridY0 = minY;
+    out.gridWidth = static_cast<int>(std::ceil((maxX - minX) / out.cellSize)) + 1;
+    out.gridHeight = static_cast<int>(std::ceil((maxY - minY) / out.cellSize)) + 1;
+    out.grid.assign(static_cast<size_t>(out.gridWidth) * out.gridHeight, -1);
+    out.active.clear();
+
+    auto tryAdd = [&](double x, double y) {
+        x = quantize(x);
+        y = quantize(y);
+        if (x < minX || x > maxX || y < minY || y > maxY || out.nearDecor(x, y, spacing)) {
+            return false;
+        }
+        int cx = static_cast<int>(std::floor((x - minX) / out.cellSize));
+        int cy = static_cast<int>(std::floor((y - minY) / out.cellSize));
+        uint32_t index = static_cast<uint32_t>(out.decor.size());
+        out.grid[static_cast<size_t>(cy) * out.gridWidth + cx] = static_cast<int32_t>(index);
+        out.decor.push_back({ x, y, static_cast<uint16_t>(rng.below(DECOR_NAME_COUNT)), 0 });
+        out.active.push_back(index);
+        return true;
+    };
+
+    tryAdd(rng.uniform(minX, maxX), rng.uniform(minY, maxY));
+    while (!out.active.empty()) {
+        size_t slot = rng.below(out.active.size());
+        const RegionContent::Spawn origin = out.decor[out.active[slot]];
+        bool added = false;
+        for (int attempt = 0; attempt < DECOR_ATTEMPTS && !added; attempt++) {
+            double angle = 2.0 * PI * rng.uniform();
+            double radius = spacing * (1.0 + rng.uniform());
+            added = tryAdd(origin.x + radius * std::cos(angle), origin.y + radius * std::sin(angle));
+        }
+        if (!added) {
+            out.active[slot] = out.active.back();  // Retire (order does not matter)
+            out.active.pop_back();
+        }
+    }
+}
+
+/**
+ * Camps: a Poisson number of centres in the region, each with one
+ * kind of enemy spread around it
+ */
+void WorldGenerator::placeCamps(double x0, double y0, double x1, double y1,
+                                RegionContent& out, Rng& rng) const {
+    const double radius = config.campRadius;
+    const double playerX = config.width / 2, playerY = config.height / 2;
+    auto nearPlayer = [&](double x, double y) {
+        double dx = x - playerX, dy = y - playerY;
+        return dx * dx + dy * dy < config.safeRadius * config.safeRadius;
+    };
+    double area = (x1 - x0) * (y1 - y0);
+    int camps = poisson(rng, config.campDensity * area / 10000.0);
+
+    for (int c = 0; c < camps; c++) {
+        // Centre: far enough from the border for the whole camp to stay inside
+        double centerX = (x1 - x0 > 2 * radius) ? rng.uniform(x0 + radius, x1 - radius) : (x0 + x1) / 2;
+        double centerY = (y1 - y0 > 2 * radius) ? rng.uniform(y0 + radius, y1 - radius) : (y0 + y1) / 2;
+        size_t kindIndex = rng.below(ENEMY_KIND_COUNT);
+        int members = 1 + static_cast<int>(rng.uniform() * (config.enemiesPerCamp * 2 - 1));
+        if (nearPlayer(centerX, centerY)) {
+            continue;
+        }
+        out.camps++;
+
+        const EnemyKind& kind = ENEMY_KINDS[kindIndex];
+        for (int m = 0; m < members; m++) {
+            double healthScale = rng.uniform(0.8, 1.2);
+            for (int attempt = 0; attempt < PLACEMENT_ATTEMPTS; attempt++) {
+                double dx = rng.normal() * radius / 2;
+                double dy = rng.normal() * radius / 2;
+                double length = std::sqrt(dx * dx + dy * dy);
+                if (length > radius) {
+                    dx *= radius / length;
+                    dy *= radius / length;
+                }
+                double x = quantize(std::min(std::max(centerX + dx, x0), x1));
+                double y = quantize(std::min(std::max(centerY + dy, y0), y1));
+                // Members spread up to campRadius: check each one, not only the centre
+                if (out.nearDecor(x, y, ENEMY_CLEARANCE) || nearPlayer(x, y)) {
+                    continue;
+                }
+                int health = std::max(1, static_cast<int>(std::lround(kind.health * healthScale)));
+                out.enemies.push_back({ x, y, static_cast<uint16_t>(kindIndex), health });
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef WORLDGEN_HPP
+#define WORLDGEN_HPP
+
+#include "Random.hpp"
+#include "Scenario.hpp"
+#include "VectorBulk.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * WorldGen - Procedural worlds from a seed
+ *
+ * The map [0, width) x [0, height) is cut into square REGIONS of
+ * regionSize units. Each region is generated on its own, from its own
+ * random stream (Rng::forStream(seed, region index)), so:
+ * - the same seed gives the same world, whatever the thread count
+ * - regions can be generated in parallel (Execution::PARALLEL)
+ *
+ * Content of a region:
+ * - Decor: Poisson-disc sampling (Bridson): no two decor objects closer
+ *   than decorSpacing. Samples stay decorSpacing / 2 away from the
+ *   region border, so the rule also holds across regions (at the cost
+ *   of a thin empty band along region borders).
+ * - Enemy camps: about campDensity camps per 100x100 units. A camp is
+ *   one kind of enemy (goblins, orcs...) gathered around a centre
+ *   (normal spread, at most campRadius). Enemies never spawn on top of
+ *   decor, nor within safeRadius of the player.
+ *
+ * The player stands in the middle of the map. The output is a stream
+ * of scenario statements (ScenarioSink): straight into the Game (its
+ * WorldBuilder), into a GameManager, or into a scenario file
+ * (TextScenarioWriter / BinaryScenarioWriter, see campus_worldgen).
+ * Regions are emitted in index order, in batches: memory stays bounded
+ * by one batch, not by the world size.
+ *
+ * Coordinates are rounded to 1/100 unit, so the text form is short and
+ * exact.
+ */
+struct WorldGenConfig {
+    uint64_t seed = 1;
+    double width = 256.0;          // Map size (units)
+    double height = 256.0;
+    double regionSize = 64.0;      // Generation unit (and parallel task)
+    double decorSpacing = 4.0;     // Minimum distance between decor, 0 = no decor
+    double campDensity = 4.0;      // Camps per 100x100 units, 0 = no enemy
+    int enemiesPerCamp = 6;        // Average camp size
+    double campRadius = 5.0;       // Camp spread around its centre
+    double safeRadius = 12.0;      // No camp centre nor enemy this close to the player
+    int playerHealth = 100;
+    int maxTurns = 0;              // Written as a rule when > 0
+};
+
+/**
+ * What generate() produced
+ */
+struct WorldGenStats {
+    size_t regions = 0;
+    size_t decor = 0;
+    size_t camps = 0;
+    size_t enemies = 0;
+};
+
+class WorldGenerator {
+public:
+    static constexpr int DECOR_ATTEMPTS = 30;       // Bridson's k: candidates per active sample
+    static constexpr double ENEMY_CLEARANCE = 1.0;  // Minimum enemy - decor distance
+    static constexpr int PLACEMENT_ATTEMPTS = 8;    // Tries per enemy before giving up
+    static constexpr double STEPS_PER_UNIT = 100.0; // Coordinates rounded to 1/100
+
+private:
+    WorldGenConfig config;
+    int regionsX;
+    int regionsY;
+
+public:
+    /**
+     * @throws std::invalid_argument on a non-positive size, a negative
+     *         density or spacing...
+     */
+    explicit WorldGenerator(const WorldGenConfig& config);
+
+    const WorldGenConfig& getConfig() const;
+    size_t getRegionCount() const;
+
+    /**
+     * Emit the whole world into sink: size hint, rules, player, then
+     * every region (decor, then enemies)
+     */
+    WorldGenStats generate(ScenarioSink& sink,
+                           VectorBulk::Execution execution = VectorBulk::Execution::SEQUENTIAL) const;
+
+private:
+    struct RegionContent;
+    struct BatchTask;
+
+    void generateRegion(size_t region, RegionContent& out) const;
+    void placeDecor(double x0, double y0, double x1, double y1, RegionContent& out, Rng& rng) const;
+    void placeCamps(double x0, double y0, double x1, double y1, RegionContent& out, Rng& rng) const;
+};
+
+#endif // WORLDGEN_HPP
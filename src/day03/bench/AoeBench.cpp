@@ -0,0 +1,156 @@
+#include "AoeBench.hpp"
+#include "BenchUtils.hpp"
+#include "../AreaOfEffect.hpp"
+#include "../SpatialGrid.hpp"
+#include "../CombatBuffer.hpp"
+#include "../WeaponTable.hpp"
+#include "../GameManager.hpp"
+#include "../Enemy.hpp"
+#include "../Random.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    const int CROWD_SIDE = 128;        // 128 x 128 = 16384 enemies
+    const double CROWD_SPACING = 0.8;
+    const int SWINGS = 200;            // Per weapon
+    const int TOUGH = 1000000;         // Health: nobody dies during the bench
+
+    struct Swing {
+        double fromX, fromY;
+        double toX, toY;
+    };
+
+    /**
+     * Order-independent summary of a hit list
+     */
+    struct HitSet {
+        size_t count = 0;
+        uintptr_t mix = 0;
+
+        void add(const Character* character) {
+            count++;
+            mix ^= reinterpret_cast<uintptr_t>(character) * 0x9E3779B97F4A7C15ULL;
+        }
+        bool operator==(const HitSet& other) const { return count == other.count && mix == other.mix; }
+    };
+
+    HitSet naiveCollect(const GameManager& manager, const AreaOfEffect::Area& area) {
+        HitSet set;
+        for (size_t i = 0; i < manager.size(); i++) {
+            const Character* character = dynamic_cast<const Character*>(manager.getObject(i));
+            if (character && character->isAlive()
+                && AreaOfEffect::covers(area, character->getX(), character->getY(),
+                                        character->getCollisionShape().boundingRadius())) {
+                set.add(character);
+            }
+        }
+        return set;
+    }
+}
+
+void runAoeBench() {
+    GameManager manager;
+    manager.reserve(CROWD_SIDE * CROWD_SIDE);
+    for (int row = 0; row < CROWD_SIDE; row++) {
+        for (int col = 0; col < CROWD_SIDE; col++) {
+            manager.createObject<Enemy>(col * CROWD_SPACING, row * CROWD_SPACING, "Goblin", TOUGH, nullptr, 6);
+        }
+    }
+
+    char title[64];
+    std::snprintf(title, sizeof(title), "AREA OF EFFECT (%zu enemies)", manager.size());
+    BenchUtils::printHeader(title);
+
+    // Same broad phase as Game::indexCharacters
+    SpatialGrid grid;
+    grid.reserve(manager.size());
+    BenchUtils::Timer indexTimer;
+    for (size_t i = 0; i < manager.size(); i++) {
+        const Character* character = static_cast<const Character*>(manager.getObject(i));
+        const CollisionShape& shape = character->getCollisionShape();
+        grid.insert(manager.getObject(i), character->getX(), character->getY(),
+                    shape.boundingRadius(), shape.layer, shape.mask);
+    }
+    grid.build();
+    double index = indexTimer.elapsedMicros();
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(%zu buckets)", grid.getBucketCount());
+    BenchUtils::printResult("index the crowd", index, extra);
+
+    AreaOfEffect areaOfEffect;
+    areaOfEffect.setIndex(&grid);
+    areaOfEffect.reserve(manager.size());
+    CombatBuffer combat;
+    combat.reserve(manager.size());
+
+    // Swings from inside the crowd, in every direction
+    const double side = (CROWD_SIDE - 1) * CROWD_SPACING;
+    Rng rng(17);
+    std::vector<Swing> swings(SWINGS);
+    for (Swing& swing : swings) {
+        swing.fromX = rng.uniform(0.25 * side, 0.75 * side);
+        swing.fromY = rng.uniform(0.25 * side, 0.75 * side);
+        swing.toX = swing.fromX + rng.uniform(-4.0, 4.0);
+        swing.toY = swing.fromY + rng.uniform(-4.0, 4.0);
+    }
+
+    WeaponTable weapons;
+    weapons.add("Pike", 24, 2, AttackStyle::THRUST, AreaShape::LINE, 1.0);
+    weapons.add("Greatsword", 12, 4, AttackStyle::SLASH, AreaShape::ARC, 60.0);
+    weapons.add("Firebomb", 6, 1, AttackStyle::SHOT, AreaShape::BLAST, 9.0);
+
+    for (int id = 0; id < weapons.size(); id++) {
+        const Weapon& weapon = weapons.get(id);
+        std::vector<HitSet> expected(SWINGS);
+        BenchUtils::Timer naiveTimer;
+        for (int i = 0; i < SWINGS; i++) {
+            const Swing& swing = swings[i];
+            expected[i] = naiveCollect(manager, AreaOfEffect::forWeapon(weapon, swing.fromX, swing.fromY,
+                                                                        swing.toX, swing.toY));
+        }
+        double naive = naiveTimer.elapsedMicros() / SWINGS;
+
+        size_t hits = 0;
+        bool same = true;
+        double query = 0.0;
+        double resolve = 0.0;
+        for (int i = 0; i < SWINGS; i++) {
+            const Swing& swing = swings[i];
+            BenchUtils::Timer queryTimer;
+            const std::vector<Character*>& caught = areaOfEffect.collect(
+                AreaOfEffect::forWeapon(weapon, swing.fromX, swing.fromY, swing.toX, swing.toY), nullptr, nullptr);
+            query += queryTimer.elapsedMicros();
+
+            HitSet found;
+            for (const Character* character : caught) {
+                found.add(character);
+            }
+            same = same && found == expected[i];
+            hits += caught.size();
+
+            BenchUtils::Timer resolveTimer;
+            for (Character* character : caught) {
+                combat.queue(nullptr, *character, weapon.getPower(), CombatBuffer::Source::WEAPON, id);
+            }
+            BenchUtils::doNotOptimize(combat.resolve().size());
+            resolve += resolveTimer.elapsedMicros();
+        }
+        query /= SWINGS;
+        resolve /= SWINGS;
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s %s, every object", weapon.getName().c_str(),
+                      WeaponTable::getAreaName(weapon.getArea()));
+        std::snprintf(extra, sizeof(extra), "(%.0f hits per swing)", static_cast<double>(hits) / SWINGS);
+        BenchUtils::printResult(label, naive, extra);
+        std::snprintf(label, sizeof(label), "%s %s, grid query", weapon.getName().c_str(),
+                      WeaponTable::getAreaName(weapon.getArea()));
+        std::snprintf(extra, sizeof(extra), "(x%.0f, %s)", naive / query, same ? "same hits" : "MISMATCH");
+        BenchUtils::printResult(label, query, extra);
+        std::snprintf(extra, sizeof(extra), "(one batch per swing)");
+        BenchUtils::printResult("  queue + resolve the hits", resolve, extra);
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef AOEBENCH_HPP
+#define AOEBENCH_HPP
+
+/**
+ * Area of effect benchmark
+ *
+ * A crowd of 16k enemies, swings with oversized line / arc / blast
+ * weapons that catch hundreds of them each:
+ * - every object of the manager tested against the area (what a hit
+ *   without an index costs) vs one SpatialGrid query (AreaOfEffect),
+ *   both must find the same characters
+ * - indexing the crowd, and queueing + resolving a whole swing's hits
+ *   in one CombatBuffer batch
+ */
+void runAoeBench();
+
+#endif // AOEBENCH_HPP
@@ -0,0 +1,57 @@
+#ifndef BENCHUTILS_HPP
+#define BENCHUTILS_HPP
+
+#include <chrono>
+#include <cstdio>
+
+/**
+ * BenchUtils - Tiny helpers shared by the campus_bench benchmarks
+ *
+ * No framework: each benchmark times a loop with steady_clock and
+ * prints one aligned line per measurement.
+ */
+namespace BenchUtils {
+
+    /**
+     * Stopwatch started at construction
+     */
+    class Timer {
+    private:
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        Timer() : start(std::chrono::steady_clock::now()) {}
+
+        double elapsedMicros() const {
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            return elapsed.count();
+        }
+    };
+
+    /**
+     * Print a section title
+     */
+    inline void printHeader(const char* title) {
+        std::printf("\n========== %s ==========\n", title);
+    }
+
+    /**
+     * Print one result line
+     * @param label What was measured
+     * @param micros Average time per operation (microseconds)
+     * @param extra Free text after the timing (may be empty)
+     */
+    inline void printResult(const char* label, double micros, const char* extra) {
+        std::printf("  %-28s %12.2f us  %s\n", label, micros, extra);
+    }
+
+    /**
+     * Keep the optimizer from removing a computation whose result is unused
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+}
+
+#endif // BENCHUTILS_HPP
@@ -0,0 +1,151 @@
+#include "BulkBench.hpp"
+#include "BenchUtils.hpp"
+#include "../VectorBulk.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    const int REPEATS = 20;
+
+    typedef VectorBulk::Execution Execution;
+
+    void printCheck(const char* label, double micros, double referenceMicros, bool same) {
+        char extra[64];
+        std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", referenceMicros / micros, same ? "same results" : "MISMATCH");
+        BenchUtils::printResult(label, micros, extra);
+    }
+
+    void benchCount(size_t count) {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> pos(-1000.0, 1000.0);
+        std::vector<Vector2d> points;
+        points.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            points.emplace_back(pos(rng), pos(rng));
+        }
+        const Vector2d origin(12.5, -40.25);
+        const Vector2d offset(0.5, -0.25);
+        VectorSpan<const Vector2d> view(points);
+
+        char title[64];
+        std::snprintf(title, sizeof(title), "BULK (%zu positions, %s)", count, POSITION_TYPE_NAME);
+        BenchUtils::printHeader(title);
+
+        // ---- Distances ----
+        std::vector<double> reference(count), bulk(count);
+        BenchUtils::Timer scalarTimer;
+        for (int r = 0; r < REPEATS; r++) {
+            for (size_t i = 0; i < count; i++) {
+                reference[i] = points[i].distance(origin);
+            }
+            BenchUtils::doNotOptimize(reference);
+        }
+        double scalarMicros = scalarTimer.elapsedMicros() / REPEATS;
+        BenchUtils::printResult("distances scalar", scalarMicros, "");
+
+        const Execution modes[] = { Execution::SEQUENTIAL, Execution::PARALLEL };
+        const char* distanceLabels[] = { "distances bulk", "distances bulk parallel" };
+        for (int m = 0; m < 2; m++) {
+            BenchUtils::Timer timer;
+            for (int r = 0; r < REPEATS; r++) {
+                VectorBulk::distancesTo(view, origin, VectorSpan<double>(bulk), modes[m]);
+                BenchUtils::doNotOptimize(bulk);
+            }
+            printCheck(distanceLabels[m], timer.elapsedMicros() / REPEATS, scalarMicros, bulk == reference);
+        }
+
+        // ---- Nearest ----
+        size_t expected = 0;
+        scalarTimer = BenchUtils::Timer();
+        for (int r = 0; r < REPEATS; r++) {
+            expected = 0;
+            double best = points[0].distanceSquared(origin);
+            for (size_t i = 1; i < count; i++) {
+                double d = points[i].distanceSquared(origin);
+                if (d < best) {
+                    best = d;
+                    expected = i;
+                }
+            }
+            BenchUtils::doNotOptimize(expected);
+        }
+        scalarMicros = scalarTimer.elapsedMicros() / REPEATS;
+        BenchUtils::printResult("nearest scalar", scalarMicros, "");
+
+        const char* nearestLabels[] = { "nearest bulk", "nearest bulk parallel" };
+        for (int m = 0; m < 2; m++) {
+            size_t found = VectorBulk::NOT_FOUND;
+            BenchUtils::Timer timer;
+            for (int r = 0; r < REPEATS; r++) {
+                found = VectorBulk::nearestOf(view, origin, modes[m]);
+                BenchUtils::doNotOptimize(found);
+            }
+            printCheck(nearestLabels[m], timer.elapsedMicros() / REPEATS, scalarMicros, found == expected);
+        }
+
+        // ---- Bounding box ----
+        double lowX = 0.0, lowY = 0.0, highX = 0.0, highY = 0.0;
+        scalarTimer = BenchUtils::Timer();
+        for (int r = 0; r < REPEATS; r++) {
+            lowX = highX = points[0].getX();
+            lowY = highY = points[0].getY();
+            for (size_t i = 1; i < count; i++) {
+                lowX = std::min(lowX, points[i].getX());
+                lowY = std::min(lowY, points[i].getY());
+                highX = std::max(highX, points[i].getX());
+                highY = std::max(highY, points[i].getY());
+            }
+            BenchUtils::doNotOptimize(lowX);
+        }
+        scalarMicros = scalarTimer.elapsedMicros() / REPEATS;
+        BenchUtils::printResult("bounding box scalar", scalarMicros, "");
+
+        const char* boxLabels[] = { "bounding box bulk", "bounding box bulk parallel" };
+        for (int m = 0; m < 2; m++) {
+            Vector2d low, high;
+            BenchUtils::Timer timer;
+            for (int r = 0; r < REPEATS; r++) {
+                VectorBulk::boundingBox(view, low, high, modes[m]);
+                BenchUtils::doNotOptimize(low);
+            }
+            bool same = low.getX() == lowX && low.getY() == lowY && high.getX() == highX && high.getY() == highY;
+            printCheck(boxLabels[m], timer.elapsedMicros() / REPEATS, scalarMicros, same);
+        }
+
+        // ---- Translate (there and back, positions end unchanged) ----
+        const Vector2d back(-0.5, 0.25);
+        scalarTimer = BenchUtils::Timer();
+        for (int r = 0; r < REPEATS; r++) {
+            for (Vector2d& p : points) {
+                p.setX(p.getX() + (r % 2 == 0 ? offset.getX() : back.getX()));
+                p.setY(p.getY() + (r % 2 == 0 ? offset.getY() : back.getY()));
+            }
+            BenchUtils::doNotOptimize(points);
+        }
+        scalarMicros = scalarTimer.elapsedMicros() / REPEATS;
+        BenchUtils::printResult("translate scalar (setters)", scalarMicros, "");
+
+        const char* translateLabels[] = { "translate bulk", "translate bulk parallel" };
+        for (int m = 0; m < 2; m++) {
+            std::vector<Vector2d> moved = points;
+            BenchUtils::Timer timer;
+            for (int r = 0; r < REPEATS; r++) {
+                VectorBulk::translateAll(VectorSpan<Vector2d>(moved), r % 2 == 0 ? offset : back, modes[m]);
+                BenchUtils::doNotOptimize(moved);
+            }
+            double micros = timer.elapsedMicros() / REPEATS;
+            bool same = true;
+            for (size_t i = 0; i < count && same; i++) {
+                same = moved[i].getRawX() == points[i].getRawX() && moved[i].getRawY() == points[i].getRawY();
+            }
+            printCheck(translateLabels[m], micros, scalarMicros, same);
+        }
+    }
+}
+
+void runBulkBench() {
+    benchCount(4096);
+    benchCount(1 << 20);
+}
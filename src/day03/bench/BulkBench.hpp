@@ -0,0 +1,14 @@
+#ifndef BULKBENCH_HPP
+#define BULKBENCH_HPP
+
+/**
+ * Bulk operations benchmark
+ *
+ * Times VectorBulk (translate, distances, nearest, bounding box) on
+ * large position arrays, sequential and parallel, against the scalar
+ * path (one Vector2d member call per position), and checks that every
+ * version gives the same results.
+ */
+void runBulkBench();
+
+#endif // BULKBENCH_HPP
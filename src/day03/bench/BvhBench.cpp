@@ -0,0 +1,166 @@
+#include "BvhBench.hpp"
+#include "BenchUtils.hpp"
+#include "../StaticBvh.hpp"
+#include "../WorldGen.hpp"
+#include "../GameManager.hpp"
+#include "../Player.hpp"
+#include "../Decor.hpp"
+#include "../Geometry.hpp"
+#include "../Random.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    const int PROBES = 2000;
+    const double PROBE_SPREAD = 0.6;   // Around a decor: about half the probes are blocked
+    const double RAY_LENGTH = 24.0;
+
+    /**
+     * Decor only (no camps), ~60k objects
+     */
+    WorldGenConfig benchConfig() {
+        WorldGenConfig config;
+        config.seed = 7;
+        config.width = 1024.0;
+        config.height = 1024.0;
+        config.decorSpacing = 4.0;
+        config.campDensity = 0.0;
+        return config;
+    }
+
+    /**
+     * Decor straight into the manager
+     */
+    class DecorSink : public ScenarioSink {
+    public:
+        GameManager& manager;
+        Player* player = nullptr;
+
+        explicit DecorSink(GameManager& manager) : manager(manager) {}
+
+        void onReserve(size_t entities) override { manager.reserve(entities); }
+        void onRule(ScenarioRule, double) override {}
+        void onWeapon(const std::string&, int, int, AttackStyle) override {}
+        void onPlayer(const std::string& name, double x, double y, int health) override {
+            player = manager.createObject<Player>(x, y, name, health);
+        }
+        void onEnemy(const std::string&, double, double, int, int) override {}
+        void onDecor(const std::string& name, double x, double y) override {
+            Decor* decor = manager.createObject<Decor>(x, y, name);
+            if (name == "Ruins") {
+                // Box footprint, to exercise the box paths too
+                decor->setCollisionShape(CollisionShape::box(0.6f, 0.4f, CollisionLayer::STATIC, CollisionLayer::CHARACTER));
+            }
+        }
+    };
+
+    /**
+     * Nearest shape crossed by the segment, every shape tested
+     */
+    GameObject* linearRaycast(const std::vector<StaticBvh::Primitive>& shapes,
+                              double x, double y, double moveX, double moveY) {
+        GameObject* best = nullptr;
+        double bestT = 1.0;
+        for (const StaticBvh::Primitive& primitive : shapes) {
+            double t;
+            bool touched = primitive.shape.kind == CollisionShape::Kind::CIRCLE
+                ? Geometry::sweepCircle(x, y, moveX, moveY, primitive.x, primitive.y, primitive.shape.halfWidth, t)
+                : Geometry::sweepBox(x, y, moveX, moveY, primitive.x - primitive.shape.halfWidth,
+                                     primitive.y - primitive.shape.halfHeight, primitive.x + primitive.shape.halfWidth,
+                                     primitive.y + primitive.shape.halfHeight, t);
+            if (touched && (!best || t < bestT)) {
+                best = primitive.object;
+                bestT = t;
+            }
+        }
+        return best;
+    }
+}
+
+void runBvhBench() {
+    GameManager manager;
+    DecorSink sink(manager);
+    WorldGenerator(benchConfig()).generate(sink, VectorBulk::Execution::SEQUENTIAL);
+
+    StaticBvh bvh;
+    BenchUtils::Timer buildTimer;
+    bvh.build(manager);
+    double build = buildTimer.elapsedMicros();
+
+    char title[64];
+    std::snprintf(title, sizeof(title), "STATIC BVH (%zu shapes)", bvh.size());
+    BenchUtils::printHeader(title);
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(%zu nodes, depth %d)", bvh.getNodeCount(), bvh.getDepth());
+    BenchUtils::printResult("SAH build", build, extra);
+
+    // Probes next to random decor, rays from random decor
+    std::vector<StaticBvh::Primitive> shapes;
+    bvh.query(-1e9, -1e9, 1e9, 1e9, [&](const StaticBvh::Primitive& primitive) { shapes.push_back(primitive); });
+    Rng rng(11);
+    std::vector<double> probeX(PROBES), probeY(PROBES), moveX(PROBES), moveY(PROBES);
+    for (int i = 0; i < PROBES; i++) {
+        const StaticBvh::Primitive& near = shapes[rng.below(shapes.size())];
+        probeX[i] = near.x + rng.uniform(-PROBE_SPREAD, PROBE_SPREAD);
+        probeY[i] = near.y + rng.uniform(-PROBE_SPREAD, PROBE_SPREAD);
+        double angle = rng.uniform(0.0, 6.283185307179586);
+        moveX[i] = RAY_LENGTH * std::cos(angle);
+        moveY[i] = RAY_LENGTH * std::sin(angle);
+    }
+
+    // Movement tests: same blockers with and without the index
+    std::vector<GameObject*> linearBlockers(PROBES), bvhBlockers(PROBES);
+    BenchUtils::Timer linearTimer;
+    for (int i = 0; i < PROBES; i++) {
+        linearBlockers[i] = manager.getBlockingObject(sink.player, probeX[i], probeY[i]);
+    }
+    double linear = linearTimer.elapsedMicros() / PROBES;
+
+    manager.setStaticGeometry(&bvh);
+    BenchUtils::Timer bvhTimer;
+    for (int i = 0; i < PROBES; i++) {
+        bvhBlockers[i] = manager.getBlockingObject(sink.player, probeX[i], probeY[i]);
+    }
+    double indexed = bvhTimer.elapsedMicros() / PROBES;
+
+    int blocked = 0;
+    bool same = true;
+    for (int i = 0; i < PROBES; i++) {
+        blocked += linearBlockers[i] != nullptr;
+        same = same && linearBlockers[i] == bvhBlockers[i];
+    }
+    std::snprintf(extra, sizeof(extra), "(%d / %d blocked)", blocked, PROBES);
+    BenchUtils::printResult("move test, linear scan", linear, extra);
+    std::snprintf(extra, sizeof(extra), "(x%.0f, %s)", linear / indexed, same ? "same blockers" : "MISMATCH");
+    BenchUtils::printResult("move test, static BVH", indexed, extra);
+
+    // Segment casts (radius 0: line of sight)
+    std::vector<GameObject*> linearHits(PROBES), bvhHits(PROBES);
+    BenchUtils::Timer linearRayTimer;
+    for (int i = 0; i < PROBES; i++) {
+        linearHits[i] = linearRaycast(shapes, probeX[i], probeY[i], moveX[i], moveY[i]);
+    }
+    double linearRay = linearRayTimer.elapsedMicros() / PROBES;
+
+    StaticBvh::Hit hit;
+    BenchUtils::Timer bvhRayTimer;
+    for (int i = 0; i < PROBES; i++) {
+        bvh.raycast(probeX[i], probeY[i], moveX[i], moveY[i], 0.0, CollisionLayer::CHARACTER,
+                    CollisionLayer::ALL, hit);
+        bvhHits[i] = hit.object;
+    }
+    double indexedRay = bvhRayTimer.elapsedMicros() / PROBES;
+
+    int hits = 0;
+    same = true;
+    for (int i = 0; i < PROBES; i++) {
+        hits += linearHits[i] != nullptr;
+        same = same && linearHits[i] == bvhHits[i];
+    }
+    std::snprintf(extra, sizeof(extra), "(%d / %d hit)", hits, PROBES);
+    BenchUtils::printResult("raycast, linear sweep", linearRay, extra);
+    std::snprintf(extra, sizeof(extra), "(x%.0f, %s)", linearRay / indexedRay, same ? "same hits" : "MISMATCH");
+    BenchUtils::printResult("raycast, static BVH", indexedRay, extra);
+}
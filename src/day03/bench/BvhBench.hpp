@@ -0,0 +1,15 @@
+#ifndef BVHBENCH_HPP
+#define BVHBENCH_HPP
+
+/**
+ * Static geometry benchmark
+ *
+ * A generated world of decor (circles and boxes), queried by:
+ * - movement tests (GameManager::getBlockingObject): linear scan of
+ *   every object vs the static BVH
+ * - segment casts: linear sweep of every shape vs StaticBvh::raycast
+ * Both sides must report the same objects.
+ */
+void runBvhBench();
+
+#endif // BVHBENCH_HPP
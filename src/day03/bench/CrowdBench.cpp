@@ -0,0 +1,138 @@
+#include "CrowdBench.hpp"
+#include "BenchUtils.hpp"
+#include "../CrowdAvoidance.hpp"
+#include "../CollisionResolver.hpp"
+#include "../GameManager.hpp"
+#include "../Enemy.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    const int CROWD_SIDE = 128;       // 128 x 128 = 16384 enemies
+    const double CROWD_SPACING = 0.8;
+    const double CROWD_OFFSET = 4.0;  // Crowd corner, goal at the origin
+    const int TURNS = 20;
+    const double WEIGHT = 0.5;        // Enemy::AVOIDANCE_WEIGHT
+
+    struct CrowdRun {
+        double micros;     // Per turn
+        size_t stuck;      // Moves that did not move
+    };
+
+    void placeCrowd(GameManager& manager, std::vector<Enemy*>& crowd) {
+        manager.reserve(CROWD_SIDE * CROWD_SIDE);
+        for (int row = 0; row < CROWD_SIDE; row++) {
+            for (int col = 0; col < CROWD_SIDE; col++) {
+                crowd.push_back(manager.createObject<Enemy>(CROWD_OFFSET + col * CROWD_SPACING,
+                                                            CROWD_OFFSET + row * CROWD_SPACING,
+                                                            "Goblin", 25, nullptr, 6));
+            }
+        }
+    }
+
+    /**
+     * One unit towards the origin, bent by the push like Enemy::moveTowardsTarget
+     */
+    bool step(const Enemy& enemy, double pushX, double pushY, double& x, double& y) {
+        double distance = std::hypot(enemy.getX(), enemy.getY());
+        if (distance < 1.0) {
+            return false;  // Arrived (in attack range)
+        }
+        double dirX = -enemy.getX() / distance + WEIGHT * pushX;
+        double dirY = -enemy.getY() / distance + WEIGHT * pushY;
+        double length = std::hypot(dirX, dirY);
+        x = enemy.getX() + dirX / length;
+        y = enemy.getY() + dirY / length;
+        return true;
+    }
+
+    CrowdRun runTurns(bool separate) {
+        GameManager manager;
+        std::vector<Enemy*> crowd;
+        placeCrowd(manager, crowd);
+        CrowdAvoidance avoidance;
+        avoidance.reserve(crowd.size());
+        CollisionResolver resolver;
+        resolver.reserve(crowd.size());
+
+        CrowdRun run{ 0.0, 0 };
+        BenchUtils::Timer timer;
+        for (int turn = 0; turn < TURNS; turn++) {
+            if (separate) {
+                avoidance.clear();
+                for (Enemy* enemy : crowd) {
+                    avoidance.add(enemy, enemy->getX(), enemy->getY());
+                }
+                avoidance.compute(VectorBulk::Execution::PARALLEL);
+            }
+            resolver.begin(manager);
+            for (size_t i = 0; i < crowd.size(); i++) {
+                Enemy* enemy = crowd[i];
+                double x, y;
+                if (!step(*enemy, separate ? avoidance.getPushX(i) : 0.0,
+                          separate ? avoidance.getPushY(i) : 0.0, x, y)) {
+                    continue;
+                }
+                CollisionResolver::Result move = resolver.resolve(enemy, enemy->getX(), enemy->getY(), x, y);
+                if (move.x == enemy->getX() && move.y == enemy->getY()) {
+                    run.stuck++;
+                    continue;
+                }
+                resolver.commit(enemy->getX(), enemy->getY(), move.x, move.y);
+                enemy->setX(move.x);
+                enemy->setY(move.y);
+            }
+        }
+        run.micros = timer.elapsedMicros() / TURNS;
+        return run;
+    }
+
+    double timeSeparation(CrowdAvoidance& avoidance, VectorBulk::Execution execution) {
+        BenchUtils::Timer timer;
+        avoidance.compute(execution);
+        return timer.elapsedMicros();
+    }
+}
+
+void runCrowdBench() {
+    char title[64];
+    std::snprintf(title, sizeof(title), "CROWD AVOIDANCE (%d enemies)", CROWD_SIDE * CROWD_SIDE);
+    BenchUtils::printHeader(title);
+
+    // Separation pass on a packed crowd (every agent has neighbours)
+    GameManager manager;
+    std::vector<Enemy*> crowd;
+    placeCrowd(manager, crowd);
+    CrowdAvoidance avoidance;
+    avoidance.reserve(crowd.size());
+    for (Enemy* enemy : crowd) {
+        avoidance.add(enemy, enemy->getX(), enemy->getY());
+    }
+    double sequential = timeSeparation(avoidance, VectorBulk::Execution::SEQUENTIAL);
+    std::vector<double> pushes;
+    pushes.reserve(crowd.size() * 2);
+    for (size_t i = 0; i < avoidance.size(); i++) {
+        pushes.push_back(avoidance.getPushX(i));
+        pushes.push_back(avoidance.getPushY(i));
+    }
+    double parallel = timeSeparation(avoidance, VectorBulk::Execution::PARALLEL);
+    bool same = true;
+    for (size_t i = 0; i < avoidance.size(); i++) {
+        same = same && pushes[2 * i] == avoidance.getPushX(i) && pushes[2 * i + 1] == avoidance.getPushY(i);
+    }
+
+    char extra[96];
+    BenchUtils::printResult("separation, 1 thread", sequential, "");
+    std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", sequential / parallel, same ? "same pushes" : "MISMATCH");
+    BenchUtils::printResult("separation, chunk-parallel", parallel, extra);
+
+    // Whole turns
+    CrowdRun sliding = runTurns(false);
+    CrowdRun separated = runTurns(true);
+    std::snprintf(extra, sizeof(extra), "(%zu stuck moves in %d turns)", sliding.stuck, TURNS);
+    BenchUtils::printResult("turn, slide only", sliding.micros, extra);
+    std::snprintf(extra, sizeof(extra), "(%zu stuck moves in %d turns)", separated.stuck, TURNS);
+    BenchUtils::printResult("turn, separation + slide", separated.micros, extra);
+}
@@ -0,0 +1,15 @@
+#ifndef CROWDBENCH_HPP
+#define CROWDBENCH_HPP
+
+/**
+ * Crowd avoidance benchmark
+ *
+ * A crowd of more than 10k enemies converging on one point:
+ * - separation pass alone, on one thread and chunk-parallel (both must
+ *   give the same pushes)
+ * - whole turns (separation + sliding moves) against sliding moves
+ *   alone: time per turn and moves that made no progress
+ */
+void runCrowdBench();
+
+#endif // CROWDBENCH_HPP
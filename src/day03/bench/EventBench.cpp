@@ -0,0 +1,108 @@
+#include "EventBench.hpp"
+#include "BenchUtils.hpp"
+#include "../EventBus.hpp"
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    const size_t EVENTS = 1 << 16;   // Per run (split between producers)
+    const int REPEATS = 20;
+
+    /**
+     * Reference: the obvious locked queue
+     */
+    class LockedQueue {
+    private:
+        std::mutex mutex;
+        std::vector<DamagedEvent> events;
+
+    public:
+        explicit LockedQueue(size_t capacity) { events.reserve(capacity); }
+
+        void publish(const DamagedEvent& event) {
+            std::lock_guard<std::mutex> lock(mutex);
+            events.push_back(event);
+        }
+
+        long long drain() {
+            std::lock_guard<std::mutex> lock(mutex);
+            long long total = 0;
+            for (const DamagedEvent& event : events) {
+                total += event.damage;
+            }
+            events.clear();
+            return total;
+        }
+    };
+
+    void onDamaged(void* context, const DamagedEvent& event) {
+        *static_cast<long long*>(context) += event.damage;
+    }
+
+    /**
+     * Run 'producers' threads, each publishing its share of EVENTS
+     */
+    template<typename Publish>
+    void produce(int producers, Publish publish) {
+        std::vector<std::thread> threads;
+        size_t share = EVENTS / producers;
+        for (int p = 1; p < producers; p++) {
+            threads.emplace_back([=]() {
+                for (size_t i = 0; i < share; i++) {
+                    publish(DamagedEvent{ nullptr, nullptr, 1, 2, 1 });
+                }
+            });
+        }
+        for (size_t i = 0; i < share; i++) {
+            publish(DamagedEvent{ nullptr, nullptr, 1, 2, 1 });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void printCheck(const char* label, double micros, double referenceMicros, long long delivered) {
+        char extra[80];
+        std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", referenceMicros / micros,
+                      delivered == static_cast<long long>(EVENTS) * REPEATS ? "all delivered" : "LOST EVENTS");
+        BenchUtils::printResult(label, micros, extra);
+    }
+
+    void benchProducers(int producers) {
+        LockedQueue locked(EVENTS);
+        long long lockedTotal = 0;
+        BenchUtils::Timer lockedTimer;
+        for (int r = 0; r < REPEATS; r++) {
+            produce(producers, [&locked](const DamagedEvent& event) { locked.publish(event); });
+            lockedTotal += locked.drain();
+        }
+        double lockedMicros = lockedTimer.elapsedMicros() / REPEATS;
+
+        EventBus bus;
+        bus.reserve(EVENTS);
+        long long busTotal = 0;
+        bus.subscribe<DamagedEvent>(&onDamaged, &busTotal);
+        BenchUtils::Timer busTimer;
+        for (int r = 0; r < REPEATS; r++) {
+            produce(producers, [&bus](const DamagedEvent& event) { bus.publish(event); });
+            bus.drain();
+        }
+        double busMicros = busTimer.elapsedMicros() / REPEATS;
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "mutex queue, %d producer(s)", producers);
+        printCheck(label, lockedMicros, lockedMicros, lockedTotal);
+        std::snprintf(label, sizeof(label), "lock-free bus, %d producer(s)", producers);
+        printCheck(label, busMicros, lockedMicros, busTotal);
+    }
+}
+
+void runEventBench() {
+    char title[64];
+    std::snprintf(title, sizeof(title), "EVENT BUS (%zu events per turn)", EVENTS);
+    BenchUtils::printHeader(title);
+    benchProducers(1);
+    benchProducers(4);
+}
@@ -0,0 +1,15 @@
+#ifndef EVENTBENCH_HPP
+#define EVENTBENCH_HPP
+
+/**
+ * Event bus benchmark
+ *
+ * One turn's worth of DamagedEvents published then drained to one
+ * subscriber:
+ * - lock-free MpscQueue (EventBus) vs a std::mutex + std::vector queue
+ * - 1 producer thread, then 4 producers publishing at the same time
+ * Every run must deliver every event (sum of damage checked).
+ */
+void runEventBench();
+
+#endif // EVENTBENCH_HPP
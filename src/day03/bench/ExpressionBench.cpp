@@ -0,0 +1,238 @@
+#include "ExpressionBench.hpp"
+#include "BenchUtils.hpp"
+#include "../Vector2d.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    const size_t BODIES = 4096;
+    const int STEPS = 200;
+    const int ROUNDS = 15;
+    const double STEER_GAIN = 0.05;
+    const double DT = 1.0 / 60.0;
+    const double PUSH_RADIUS = 40.0;
+
+    /**
+     * Eager vector: every operator returns a new vector (the previous
+     * BasicVector2d operators), so a + b * k builds two temporaries,
+     * each one checked as the originals were
+     */
+    template<typename T>
+    struct EagerVector {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        T x, y;
+
+        EagerVector() : x(Traits::fromDouble(0.0)), y(Traits::fromDouble(0.0)) {}
+        EagerVector(T x, T y) : x(x), y(y) {
+            CheckedCoordinates::check(Traits::isValid(x) && Traits::isValid(y),
+                                      "Vector2d arithmetic result must be finite (not NaN or infinity)");
+        }
+
+        EagerVector operator+(const EagerVector& other) const { return EagerVector(x + other.x, y + other.y); }
+        EagerVector operator-(const EagerVector& other) const { return EagerVector(x - other.x, y - other.y); }
+        EagerVector operator*(double factor) const {
+            T f = Traits::fromDouble(factor);
+            return EagerVector(x * f, y * f);
+        }
+    };
+
+    template<typename T>
+    struct Bodies {
+        std::vector<EagerVector<T>> eagerPos, eagerVel;
+        std::vector<BasicVector2d<T>> exprPos, exprVel;
+    };
+
+    template<typename T>
+    Bodies<T> makeBodies() {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<double> pos(-100.0, 100.0);
+        std::uniform_real_distribution<double> vel(-5.0, 5.0);
+        Bodies<T> bodies;
+        for (size_t i = 0; i < BODIES; i++) {
+            double px = pos(rng), py = pos(rng), vx = vel(rng), vy = vel(rng);
+            bodies.eagerPos.emplace_back(Traits::fromDouble(px), Traits::fromDouble(py));
+            bodies.eagerVel.emplace_back(Traits::fromDouble(vx), Traits::fromDouble(vy));
+            bodies.exprPos.emplace_back(px, py);
+            bodies.exprVel.emplace_back(vx, vy);
+        }
+        return bodies;
+    }
+
+    template<typename T>
+    size_t countMismatches(const Bodies<T>& bodies) {
+        size_t mismatches = 0;
+        for (size_t i = 0; i < BODIES; i++) {
+            if (!(bodies.eagerPos[i].x == bodies.exprPos[i].getRawX())
+                || !(bodies.eagerPos[i].y == bodies.exprPos[i].getRawY())) {
+                mismatches++;
+            }
+        }
+        return mismatches;
+    }
+
+    /**
+     * Best time per step of two loops, run in alternating rounds of
+     * STEPS steps (the order flips every round, so that neither one
+     * profits from warm caches or clocks). Each step function ends with
+     * doNotOptimize, so steps cannot be fused.
+     */
+    template<typename EagerStep, typename ExprStep>
+    void timePair(EagerStep eagerStep, ExprStep exprStep, double& eagerMicros, double& exprMicros) {
+        eagerMicros = 1e300;
+        exprMicros = 1e300;
+        for (int round = 0; round < ROUNDS; round++) {
+            for (int turn = 0; turn < 2; turn++) {
+                const bool eager = (turn == 0) == (round % 2 == 0);
+                BenchUtils::Timer timer;
+                for (int step = 0; step < STEPS; step++) {
+                    if (eager) {
+                        eagerStep();
+                    } else {
+                        exprStep();
+                    }
+                }
+                double micros = timer.elapsedMicros() / STEPS;
+                double& best = eager ? eagerMicros : exprMicros;
+                best = std::min(best, micros);
+            }
+        }
+    }
+
+    void printPair(const char* eagerLabel, double eagerMicros,
+                   const char* exprLabel, double exprMicros, size_t mismatches) {
+        BenchUtils::printResult(eagerLabel, eagerMicros, "");
+        char extra[96];
+        std::snprintf(extra, sizeof(extra), "(x%.2f, %zu mismatches)", eagerMicros / exprMicros, mismatches);
+        BenchUtils::printResult(exprLabel, exprMicros, extra);
+    }
+
+    /**
+     * pos = pos + (target - pos) * gain
+     */
+    template<typename T>
+    void benchSteering(const char* type) {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        Bodies<T> bodies = makeBodies<T>();
+        EagerVector<T> eagerTarget(Traits::fromDouble(12.5), Traits::fromDouble(-7.25));
+        BasicVector2d<T> exprTarget(12.5, -7.25);
+
+        double eagerMicros, exprMicros;
+        timePair([&]() {
+                     for (EagerVector<T>& pos : bodies.eagerPos) {
+                         pos = pos + (eagerTarget - pos) * STEER_GAIN;
+                     }
+                     BenchUtils::doNotOptimize(bodies.eagerPos);
+                 },
+                 [&]() {
+                     for (BasicVector2d<T>& pos : bodies.exprPos) {
+                         pos += (exprTarget - pos) * STEER_GAIN;
+                     }
+                     BenchUtils::doNotOptimize(bodies.exprPos);
+                 },
+                 eagerMicros, exprMicros);
+
+        char eagerLabel[48], exprLabel[48];
+        std::snprintf(eagerLabel, sizeof(eagerLabel), "steering eager %s", type);
+        std::snprintf(exprLabel, sizeof(exprLabel), "steering expression %s", type);
+        printPair(eagerLabel, eagerMicros, exprLabel, exprMicros, countMismatches(bodies));
+    }
+
+    /**
+     * pos = pos + vel * dt + acc * (dt² / 2), then vel = vel + acc * dt
+     */
+    template<typename T>
+    void benchIntegration(const char* type) {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        Bodies<T> bodies = makeBodies<T>();
+        EagerVector<T> eagerGravity(Traits::fromDouble(0.0), Traits::fromDouble(-9.81));
+        BasicVector2d<T> exprGravity(0.0, -9.81);
+        const double halfDtSquared = 0.5 * DT * DT;
+
+        double eagerMicros, exprMicros;
+        timePair([&]() {
+                     for (size_t i = 0; i < BODIES; i++) {
+                         EagerVector<T>& pos = bodies.eagerPos[i];
+                         EagerVector<T>& vel = bodies.eagerVel[i];
+                         pos = pos + vel * DT + eagerGravity * halfDtSquared;
+                         vel = vel + eagerGravity * DT;
+                     }
+                     BenchUtils::doNotOptimize(bodies.eagerPos);
+                 },
+                 [&]() {
+                     for (size_t i = 0; i < BODIES; i++) {
+                         BasicVector2d<T>& pos = bodies.exprPos[i];
+                         BasicVector2d<T>& vel = bodies.exprVel[i];
+                         pos = pos + vel * DT + exprGravity * halfDtSquared;
+                         vel += exprGravity * DT;
+                     }
+                     BenchUtils::doNotOptimize(bodies.exprPos);
+                 },
+                 eagerMicros, exprMicros);
+
+        char eagerLabel[48], exprLabel[48];
+        std::snprintf(eagerLabel, sizeof(eagerLabel), "integration eager %s", type);
+        std::snprintf(exprLabel, sizeof(exprLabel), "integration expression %s", type);
+        printPair(eagerLabel, eagerMicros, exprLabel, exprMicros, countMismatches(bodies));
+    }
+
+    /**
+     * Bodies inside a circle are pushed out along (pos - center):
+     * pos = center + (pos - center) * (radius / dist)
+     */
+    template<typename T>
+    void benchPushOut(const char* type) {
+        typedef VectorDetail::ScalarTraits<T> Traits;
+        Bodies<T> bodies = makeBodies<T>();
+        EagerVector<T> eagerCenter(Traits::fromDouble(3.0), Traits::fromDouble(4.0));
+        BasicVector2d<T> exprCenter(3.0, 4.0);
+
+        // Push factors computed once, so both loops only time the vector math
+        std::vector<double> factors(BODIES, 1.0);
+        for (size_t i = 0; i < BODIES; i++) {
+            double dist = bodies.exprPos[i].distance(exprCenter);
+            if (dist > 0.0001 && dist < PUSH_RADIUS) {
+                factors[i] = PUSH_RADIUS / dist;
+            }
+        }
+
+        std::vector<EagerVector<T>> eagerOut(BODIES);
+        std::vector<BasicVector2d<T>> exprOut(BODIES);
+        double eagerMicros, exprMicros;
+        timePair([&]() {
+                     for (size_t i = 0; i < BODIES; i++) {
+                         eagerOut[i] = eagerCenter + (bodies.eagerPos[i] - eagerCenter) * factors[i];
+                     }
+                     BenchUtils::doNotOptimize(eagerOut);
+                 },
+                 [&]() {
+                     for (size_t i = 0; i < BODIES; i++) {
+                         exprOut[i] = exprCenter + (bodies.exprPos[i] - exprCenter) * factors[i];
+                     }
+                     BenchUtils::doNotOptimize(exprOut);
+                 },
+                 eagerMicros, exprMicros);
+
+        bodies.eagerPos.swap(eagerOut);
+        bodies.exprPos.swap(exprOut);
+        char eagerLabel[48], exprLabel[48];
+        std::snprintf(eagerLabel, sizeof(eagerLabel), "push-out eager %s", type);
+        std::snprintf(exprLabel, sizeof(exprLabel), "push-out expression %s", type);
+        printPair(eagerLabel, eagerMicros, exprLabel, exprMicros, countMismatches(bodies));
+    }
+}
+
+void runExpressionBench() {
+    char title[64];
+    std::snprintf(title, sizeof(title), "EXPRESSIONS (%zu bodies, per step)", BODIES);
+    BenchUtils::printHeader(title);
+
+    benchSteering<double>("double");
+    benchSteering<Fixed32x32>("fixed");
+    benchIntegration<double>("double");
+    benchIntegration<Fixed32x32>("fixed");
+    benchPushOut<double>("double");
+    benchPushOut<Fixed32x32>("fixed");
+}
@@ -0,0 +1,15 @@
+#ifndef EXPRESSIONBENCH_HPP
+#define EXPRESSIONBENCH_HPP
+
+/**
+ * Expression template benchmark
+ *
+ * Runs the same compound vector formulas (steering step, projectile
+ * integration, collision push-out) with eager operators (one temporary
+ * vector per operator, the previous Vector2d style) and with the
+ * expression templates of VectorExpr.hpp, in double and in fixed 32.32,
+ * and checks that both give bit-identical positions.
+ */
+void runExpressionBench();
+
+#endif // EXPRESSIONBENCH_HPP
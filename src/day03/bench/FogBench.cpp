@@ -0,0 +1,121 @@
+#include "FogBench.hpp"
+#include "BenchUtils.hpp"
+#include "../FogOfWar.hpp"
+#include "../Visibility.hpp"
+#include "../NavGrid.hpp"
+#include "../Random.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    const int MAP_SIZE = 4096;
+    const int STEPS = 400;
+    const double OBSTACLE_CHANCE = 0.05;
+
+    /**
+     * Byte-per-cell reference: full clear, then the view box
+     */
+    void updateBytes(const VisibilityField& field, int width, int height,
+                     std::vector<unsigned char>& visible, std::vector<unsigned char>& explored) {
+        std::fill(visible.begin(), visible.end(), 0);
+        const int radius = field.getRadius();
+        const int minX = std::max(0, field.getOriginCellX() - radius);
+        const int minY = std::max(0, field.getOriginCellY() - radius);
+        const int maxX = std::min(width - 1, field.getOriginCellX() + radius);
+        const int maxY = std::min(height - 1, field.getOriginCellY() + radius);
+        for (int cy = minY; cy <= maxY; cy++) {
+            for (int cx = minX; cx <= maxX; cx++) {
+                if (field.isCellVisible(cx, cy)) {
+                    size_t i = static_cast<size_t>(cy) * width + cx;
+                    visible[i] = 1;
+                    explored[i] = 1;
+                }
+            }
+        }
+    }
+}
+
+void runFogBench() {
+    NavGrid grid(0, 0, MAP_SIZE, MAP_SIZE);
+    Rng rng(11);
+    for (int cy = 0; cy < MAP_SIZE; cy++) {
+        for (int cx = 0; cx < MAP_SIZE; cx++) {
+            if (rng.chance(OBSTACLE_CHANCE)) {
+                grid.setBlocked(cx, cy, true);
+            }
+        }
+    }
+
+    char title[64];
+    std::snprintf(title, sizeof(title), "FOG OF WAR (%dx%d cells, %d steps)", MAP_SIZE, MAP_SIZE, STEPS);
+    BenchUtils::printHeader(title);
+
+    // Walk: one cell per step, turning every 50 steps
+    std::vector<int> pathX(STEPS), pathY(STEPS);
+    int x = MAP_SIZE / 2, y = MAP_SIZE / 2;
+    int stepX = 1, stepY = 0;
+    for (int i = 0; i < STEPS; i++) {
+        if (i % 50 == 49) {
+            int turn = stepX;
+            stepX = -stepY;
+            stepY = turn;
+        }
+        x += stepX;
+        y += stepY;
+        grid.setBlocked(x, y, false);  // The walker stands on free cells
+        pathX[i] = x;
+        pathY[i] = y;
+    }
+
+    VisibilityField field;
+    const size_t cells = static_cast<size_t>(MAP_SIZE) * MAP_SIZE;
+
+    std::vector<unsigned char> visibleBytes(cells, 0), exploredBytes(cells, 0);
+    double fieldTime = 0.0;
+    BenchUtils::Timer byteTimer;
+    for (int i = 0; i < STEPS; i++) {
+        BenchUtils::Timer buildTimer;
+        field.build(grid, pathX[i], pathY[i]);
+        fieldTime += buildTimer.elapsedMicros();
+        updateBytes(field, MAP_SIZE, MAP_SIZE, visibleBytes, exploredBytes);
+    }
+    double bytes = (byteTimer.elapsedMicros() - fieldTime) / STEPS;
+
+    field.invalidate();
+    FogOfWar fog;
+    fog.reset(grid);
+    size_t written = 0;
+    fieldTime = 0.0;
+    BenchUtils::Timer fogTimer;
+    for (int i = 0; i < STEPS; i++) {
+        BenchUtils::Timer buildTimer;
+        field.build(grid, pathX[i], pathY[i]);
+        fieldTime += buildTimer.elapsedMicros();
+        fog.update(field);
+        written += fog.getChangedWords();
+    }
+    double bits = (fogTimer.elapsedMicros() - fieldTime) / STEPS;
+
+    size_t exploredBytesCount = 0;
+    bool same = true;
+    for (int cy = 0; cy < MAP_SIZE; cy++) {
+        for (int cx = 0; cx < MAP_SIZE; cx++) {
+            size_t i = static_cast<size_t>(cy) * MAP_SIZE + cx;
+            exploredBytesCount += exploredBytes[i];
+            same = same && (visibleBytes[i] != 0) == fog.isCellVisible(cx, cy)
+                        && (exploredBytes[i] != 0) == fog.isCellExplored(cx, cy);
+        }
+    }
+
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(radius %d)", field.getRadius());
+    BenchUtils::printResult("field of view, per step", fieldTime / STEPS, extra);
+    std::snprintf(extra, sizeof(extra), "(%zu KB, %zu explored)", 2 * cells / 1024, exploredBytesCount);
+    BenchUtils::printResult("byte planes, full clear", bytes, extra);
+    std::snprintf(extra, sizeof(extra), "(%zu KB, %.0f / %zu words written, x%.0f, %s)",
+                  fog.getMemoryBytes() / 1024, static_cast<double>(written) / STEPS, fog.getWordCount(),
+                  bytes / bits, same ? "same cells" : "MISMATCH");
+    BenchUtils::printResult("bit planes, changed words", bits, extra);
+}
@@ -0,0 +1,18 @@
+#ifndef FOGBENCH_HPP
+#define FOGBENCH_HPP
+
+/**
+ * Fog of war benchmark
+ *
+ * A viewer walks across a 4096 x 4096 grid with scattered obstacles;
+ * after each step the field of view is rebuilt and the fog updated:
+ * - byte planes: one byte per cell, the visible plane cleared and
+ *   refilled every step (what a plain tile array costs)
+ * - FogOfWar: bit planes, only the words of the old and new view boxes
+ *   rebuilt, only the changed ones written
+ * Reports the words written per step, the memory of each layout, and
+ * whether both end with the same visible and explored cells.
+ */
+void runFogBench();
+
+#endif // FOGBENCH_HPP
@@ -0,0 +1,175 @@
+#include "PathfindingBench.hpp"
+#include "BenchUtils.hpp"
+#include "../NavGrid.hpp"
+#include "../Pathfinder.hpp"
+#include "../JumpPointSearch.hpp"
+#include "../HierarchicalPathfinder.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+    const double OBSTACLE_DENSITY = 0.20;   // Random scattered obstacles
+    const int WALL_COUNT_PER_1K = 40;       // Long walls per 1000 cells of side
+    const unsigned int SEED = 42;
+
+    /**
+     * Fill a grid with random obstacles and a few long walls (with gaps)
+     */
+    void generateMap(NavGrid& grid, std::mt19937& rng) {
+        const int width = grid.getWidth();
+        const int height = grid.getHeight();
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                if (chance(rng) < OBSTACLE_DENSITY) {
+                    grid.setBlocked(x, y, true);
+                }
+            }
+        }
+
+        std::uniform_int_distribution<int> posX(0, width - 1);
+        std::uniform_int_distribution<int> posY(0, height - 1);
+        std::uniform_int_distribution<int> lengthDist(width / 8, width / 2);
+        int walls = WALL_COUNT_PER_1K * width / 1000 + 1;
+        for (int i = 0; i < walls; i++) {
+            int x = posX(rng), y = posY(rng), length = lengthDist(rng);
+            bool horizontal = (i % 2) == 0;
+            for (int t = 0; t < length; t++) {
+                if (t % 37 == 0) continue;  // Gaps so walls can be crossed
+                if (horizontal) grid.setBlocked(x + t, y, true);
+                else grid.setBlocked(x, y + t, true);
+            }
+        }
+    }
+
+    int pathCost(const NavGrid& grid, const int* cells, int length) {
+        int cost = 0;
+        for (int i = 1; i < length; i++) {
+            int dx = std::abs(cells[i] % grid.getWidth() - cells[i - 1] % grid.getWidth());
+            int dy = std::abs(cells[i] / grid.getWidth() - cells[i - 1] / grid.getWidth());
+            cost += (dx != 0 && dy != 0) ? 14 : 10;
+        }
+        return cost;
+    }
+
+    void benchMapSize(int size, int queryCount) {
+        std::mt19937 rng(SEED);
+        NavGrid grid(0, 0, size, size);
+        generateMap(grid, rng);
+
+        // Start/goal pairs on walkable cells, far enough for HPA* to matter
+        std::uniform_int_distribution<int> pos(0, size - 1);
+        std::vector<int> starts, goals;
+        while (static_cast<int>(starts.size()) < queryCount) {
+            int sx = pos(rng), sy = pos(rng), gx = pos(rng), gy = pos(rng);
+            if (grid.isBlocked(sx, sy) || grid.isBlocked(gx, gy)
+                || std::abs(sx - gx) + std::abs(sy - gy) < size / 2) {
+                continue;
+            }
+            starts.push_back(grid.index(sx, sy));
+            goals.push_back(grid.index(gx, gy));
+        }
+
+        char title[64];
+        std::snprintf(title, sizeof(title), "PATHFINDING %dx%d (%d queries)", size, size, queryCount);
+        BenchUtils::printHeader(title);
+
+        // ---- Plain A* ----
+        Pathfinder astar(grid);
+        std::vector<int> optimalCost(queryCount, -1);
+        double astarMicros = 0.0;
+        size_t astarExpanded = 0;
+        for (int i = 0; i < queryCount; i++) {
+            astar.clearCache();
+            size_t before = astar.getStats().nodesExpanded;
+            int length = 0;
+            BenchUtils::Timer timer;
+            const int* path = astar.findPath(starts[i], goals[i], length);
+            astarMicros += timer.elapsedMicros();
+            astarExpanded += astar.getStats().nodesExpanded - before;
+            if (path) optimalCost[i] = pathCost(grid, path, length);
+        }
+        char extra[96];
+        std::snprintf(extra, sizeof(extra), "(%zu nodes/query)", astarExpanded / queryCount);
+        BenchUtils::printResult("A*", astarMicros / queryCount, extra);
+
+        // ---- JPS ----
+        JumpPointSearch jps(grid);
+        std::vector<int> cells;
+        double jpsMicros = 0.0;
+        size_t jpsExpanded = 0;
+        int jpsMismatches = 0;
+        for (int i = 0; i < queryCount; i++) {
+            BenchUtils::Timer timer;
+            bool found = jps.findPath(starts[i], goals[i], cells);
+            jpsMicros += timer.elapsedMicros();
+            jpsExpanded += jps.getLastExpanded();
+            int cost = found ? pathCost(grid, cells.data(), static_cast<int>(cells.size())) : -1;
+            if (cost != optimalCost[i]) jpsMismatches++;
+        }
+        std::snprintf(extra, sizeof(extra), "(%zu jump points/query, %d cost mismatches)",
+                      jpsExpanded / queryCount, jpsMismatches);
+        BenchUtils::printResult("JPS", jpsMicros / queryCount, extra);
+
+        // ---- HPA* ----
+        HierarchicalPathfinder hpa(grid);
+        hpa.build();
+        std::snprintf(extra, sizeof(extra), "(%zu nodes, %zu edges)", hpa.getNodeCount(), hpa.getEdgeCount());
+        BenchUtils::printResult("HPA* build", hpa.getBuildMicros(), extra);
+
+        // Cold: the first queries connect the clusters they reach
+        double abstractMicros = 0.0;
+        for (int i = 0; i < queryCount; i++) {
+            hpa.findAbstractPath(starts[i], goals[i], cells);
+            abstractMicros += hpa.getLastQueryMicros();
+        }
+        std::snprintf(extra, sizeof(extra), "(%zu of %d clusters connected)", hpa.getConnectedClusterCount(),
+                      ((size + HierarchicalPathfinder::CLUSTER_SIZE - 1) / HierarchicalPathfinder::CLUSTER_SIZE)
+                      * ((size + HierarchicalPathfinder::CLUSTER_SIZE - 1) / HierarchicalPathfinder::CLUSTER_SIZE));
+        BenchUtils::printResult("HPA* abstract path (cold)", abstractMicros / queryCount, extra);
+
+        abstractMicros = 0.0;
+        size_t abstractExpanded = 0;
+        for (int i = 0; i < queryCount; i++) {
+            hpa.findAbstractPath(starts[i], goals[i], cells);
+            abstractMicros += hpa.getLastQueryMicros();
+            abstractExpanded += hpa.getLastExpanded();
+        }
+        std::snprintf(extra, sizeof(extra), "(%zu nodes/query)", abstractExpanded / queryCount);
+        BenchUtils::printResult("HPA* abstract path (warm)", abstractMicros / queryCount, extra);
+
+        double refinedMicros = 0.0;
+        double costRatio = 0.0;
+        int compared = 0;
+        int missing = 0;
+        for (int i = 0; i < queryCount; i++) {
+            bool found = hpa.findPath(starts[i], goals[i], cells);
+            refinedMicros += hpa.getLastQueryMicros();
+            if (found != (optimalCost[i] >= 0)) {
+                missing++;
+            } else if (found && optimalCost[i] > 0) {
+                costRatio += static_cast<double>(pathCost(grid, cells.data(), static_cast<int>(cells.size())))
+                           / optimalCost[i];
+                compared++;
+            }
+        }
+        std::snprintf(extra, sizeof(extra), "(cost x%.3f vs A*, %d reachability mismatches)",
+                      compared > 0 ? costRatio / compared : 0.0, missing);
+        BenchUtils::printResult("HPA* full path", refinedMicros / queryCount, extra);
+
+        // ---- Local update ----
+        BenchUtils::Timer updateTimer;
+        int x = size / 2, y = size / 2;
+        grid.setBlocked(x, y, !grid.isBlocked(x, y));
+        hpa.onCellChanged(x, y);
+        BenchUtils::printResult("HPA* local update", updateTimer.elapsedMicros(), "(one cell toggled)");
+    }
+}
+
+void runPathfindingBench() {
+    benchMapSize(512, 20);
+    benchMapSize(2048, 8);
+}
@@ -0,0 +1,19 @@
+#ifndef PATHFINDINGBENCH_HPP
+#define PATHFINDINGBENCH_HPP
+
+/**
+ * Pathfinding benchmark
+ *
+ * Generates large random maps (512x512 and 2048x2048, seeded) and
+ * compares, on the same start/goal pairs:
+ * - plain A* (Pathfinder, cache cleared before each query)
+ * - Jump Point Search
+ * - HPA* abstract path only
+ * - HPA* full path (abstract + refinement)
+ *
+ * Also reports the HPA* build time and the average path cost ratio
+ * against the optimal A* cost.
+ */
+void runPathfindingBench();
+
+#endif // PATHFINDINGBENCH_HPP
@@ -0,0 +1,151 @@
+#include "PrecisionBench.hpp"
+#include "BenchUtils.hpp"
+#include "../Vector2d.hpp"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    const size_t COLLISION_OBJECTS = 2000;
+    const double COLLISION_RADIUS = 0.5;
+    const size_t STEERING_MOVERS = 4096;
+    const int STEERING_STEPS = 100;
+    const double STEP_LENGTH = 0.1;
+
+    struct Point {
+        long double x, y;
+    };
+
+    std::vector<Point> makePoints(size_t count, double center, double spread, unsigned int seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> pos(center - spread, center + spread);
+        std::vector<Point> points(count);
+        for (Point& p : points) {
+            // Values rounded to float so every precision starts from the same input
+            p.x = static_cast<float>(pos(rng));
+            p.y = static_cast<float>(pos(rng));
+        }
+        return points;
+    }
+
+    /**
+     * All-pairs collision count; also returns the worst distance error
+     */
+    template<typename T>
+    void benchCollision(const char* label, const std::vector<Point>& points, size_t expectedHits) {
+        std::vector<BasicVector2d<T>> objects;
+        objects.reserve(points.size());
+        for (const Point& p : points) {
+            objects.emplace_back(static_cast<double>(p.x), static_cast<double>(p.y));
+        }
+
+        BenchUtils::Timer timer;
+        size_t hits = 0;
+        for (size_t i = 0; i < objects.size(); i++) {
+            for (size_t j = i + 1; j < objects.size(); j++) {
+                if (objects[i].distance(objects[j]) < COLLISION_RADIUS * 2.0) {
+                    hits++;
+                }
+            }
+        }
+        double micros = timer.elapsedMicros();
+
+        double worstError = 0.0;
+        for (size_t i = 0; i + 1 < objects.size(); i++) {
+            long double dx = points[i + 1].x - points[i].x;
+            long double dy = points[i + 1].y - points[i].y;
+            long double exact = std::sqrt(dx * dx + dy * dy);
+            double error = std::fabs(static_cast<double>(objects[i].distance(objects[i + 1]) - exact));
+            worstError = std::max(worstError, error);
+        }
+
+        char extra[96];
+        std::snprintf(extra, sizeof(extra), "(hits %zu / %zu, max dist error %.2e)", hits, expectedHits, worstError);
+        BenchUtils::printResult(label, micros, extra);
+    }
+
+    /**
+     * Movers take STEERING_STEPS steps towards a target; error = final
+     * position against the same walk done in long double
+     */
+    template<typename T>
+    void benchSteering(const char* label, const std::vector<Point>& points, const Point& target) {
+        std::vector<BasicVector2d<T>> movers;
+        movers.reserve(points.size());
+        for (const Point& p : points) {
+            movers.emplace_back(static_cast<double>(p.x), static_cast<double>(p.y));
+        }
+        BasicVector2d<T> goal(static_cast<double>(target.x), static_cast<double>(target.y));
+
+        BenchUtils::Timer timer;
+        for (int step = 0; step < STEERING_STEPS; step++) {
+            for (BasicVector2d<T>& mover : movers) {
+                BasicVector2d<T> delta = goal - mover;
+                double dist = mover.distance(goal);
+                if (dist > STEP_LENGTH) {
+                    double scale = STEP_LENGTH / dist;
+                    mover = mover + BasicVector2d<T>(delta.getX() * scale, delta.getY() * scale);
+                }
+            }
+        }
+        double micros = timer.elapsedMicros();
+
+        double worstError = 0.0;
+        for (size_t i = 0; i < points.size(); i++) {
+            long double x = points[i].x, y = points[i].y;
+            for (int step = 0; step < STEERING_STEPS; step++) {
+                long double dx = target.x - x, dy = target.y - y;
+                long double dist = std::sqrt(dx * dx + dy * dy);
+                if (dist > STEP_LENGTH) {
+                    x += dx * (STEP_LENGTH / dist);
+                    y += dy * (STEP_LENGTH / dist);
+                }
+            }
+            double error = std::hypot(static_cast<double>(movers[i].getX() - x),
+                                      static_cast<double>(movers[i].getY() - y));
+            worstError = std::max(worstError, error);
+        }
+
+        char extra[64];
+        std::snprintf(extra, sizeof(extra), "(max position error %.2e)", worstError);
+        BenchUtils::printResult(label, micros, extra);
+    }
+
+    size_t exactHits(const std::vector<Point>& points) {
+        size_t hits = 0;
+        for (size_t i = 0; i < points.size(); i++) {
+            for (size_t j = i + 1; j < points.size(); j++) {
+                long double dx = points[j].x - points[i].x;
+                long double dy = points[j].y - points[i].y;
+                if (std::sqrt(dx * dx + dy * dy) < COLLISION_RADIUS * 2.0) hits++;
+            }
+        }
+        return hits;
+    }
+
+    void benchAround(double center) {
+        char title[64];
+        std::snprintf(title, sizeof(title), "PRECISION around (%.0f, %.0f)", center, center);
+        BenchUtils::printHeader(title);
+
+        std::vector<Point> points = makePoints(COLLISION_OBJECTS, center, 30.0, 11);
+        size_t expected = exactHits(points);
+        benchCollision<float>("collision float", points, expected);
+        benchCollision<double>("collision double", points, expected);
+        benchCollision<Fixed32x32>("collision fixed 32.32", points, expected);
+
+        std::vector<Point> movers = makePoints(STEERING_MOVERS, center, 30.0, 12);
+        Point target = { static_cast<long double>(center), static_cast<long double>(center) };
+        benchSteering<float>("steering float", movers, target);
+        benchSteering<double>("steering double", movers, target);
+        benchSteering<Fixed32x32>("steering fixed 32.32", movers, target);
+    }
+}
+
+void runPrecisionBench() {
+    std::printf("\nPosition type of this build: %s (%zu bytes per position)\n",
+                POSITION_TYPE_NAME, sizeof(Vector2d));
+    benchAround(0.0);
+    benchAround(100000.0);
+}
@@ -0,0 +1,16 @@
+#ifndef PRECISIONBENCH_HPP
+#define PRECISIONBENCH_HPP
+
+/**
+ * Position precision benchmark
+ *
+ * Runs the same workloads on BasicVector2d<float>, <double> and
+ * <Fixed32x32>:
+ * - Collision: all-pairs distance test against a radius
+ * - Steering: movers walking step by step towards a target
+ * and reports time (throughput) and error against a long double
+ * reference (accuracy), near the origin and far from it.
+ */
+void runPrecisionBench();
+
+#endif // PRECISIONBENCH_HPP
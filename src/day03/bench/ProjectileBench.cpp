@@ -0,0 +1,229 @@
+#include "ProjectileBench.hpp"
+#include "BenchUtils.hpp"
+#include "../Decor.hpp"
+#include "../Geometry.hpp"
+#include "../ProjectileSystem.hpp"
+#include "../SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    const double WORLD_SIZE = 1000.0;
+    const double CHARACTER_RADIUS = 0.5;
+    const double ARROW_RADIUS = 0.1;
+    const int REPEATS = 10;
+
+    struct Arrow {
+        double x, y, moveX, moveY;
+    };
+
+    /**
+     * Index of the first character hit by each arrow (-1 = none)
+     */
+    long long bruteForce(const std::vector<Arrow>& arrows, const std::vector<std::unique_ptr<Decor>>& characters,
+                         std::vector<const GameObject*>& hits) {
+        long long tests = 0;
+        for (size_t a = 0; a < arrows.size(); a++) {
+            const Arrow& arrow = arrows[a];
+            const GameObject* first = nullptr;
+            double firstTime = 1.0;
+            for (const auto& character : characters) {
+                double t;
+                tests++;
+                if (Geometry::sweepCircle(arrow.x, arrow.y, arrow.moveX, arrow.moveY,
+                                          character->getX(), character->getY(),
+                                          CHARACTER_RADIUS + ARROW_RADIUS, t)
+                    && (!first || t < firstTime)) {
+                    first = character.get();
+                    firstTime = t;
+                }
+            }
+            hits[a] = first;
+        }
+        return tests;
+    }
+
+    long long withGrid(const std::vector<Arrow>& arrows, const std::vector<std::unique_ptr<Decor>>& characters,
+                       SpatialGrid& grid, std::vector<const GameObject*>& hits) {
+        grid.clear();
+        for (const auto& character : characters) {
+            grid.insert(character.get(), character->getX(), character->getY(), CHARACTER_RADIUS);
+        }
+        grid.build();
+
+        long long tests = 0;
+        for (size_t a = 0; a < arrows.size(); a++) {
+            const Arrow& arrow = arrows[a];
+            const GameObject* first = nullptr;
+            double firstTime = 1.0;
+            double endX = arrow.x + arrow.moveX, endY = arrow.y + arrow.moveY;
+            grid.query(std::min(arrow.x, endX) - ARROW_RADIUS, std::min(arrow.y, endY) - ARROW_RADIUS,
+                       std::max(arrow.x, endX) + ARROW_RADIUS, std::max(arrow.y, endY) + ARROW_RADIUS,
+                       [&](const SpatialGrid::Entry& entry) {
+                           double t;
+                           tests++;
+                           if (Geometry::sweepCircle(arrow.x, arrow.y, arrow.moveX, arrow.moveY,
+                                                     entry.x, entry.y, entry.radius + ARROW_RADIUS, t)
+                               && (!first || t < firstTime)) {
+                               first = entry.object;
+                               firstTime = t;
+                           }
+                       });
+            hits[a] = first;
+        }
+        return tests;
+    }
+
+    void benchCount(size_t characterCount, size_t arrowCount, double speed) {
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<double> pos(0.0, WORLD_SIZE);
+        std::uniform_real_distribution<double> angle(0.0, 6.283185307179586);
+
+        std::vector<std::unique_ptr<Decor>> characters;
+        for (size_t i = 0; i < characterCount; i++) {
+            characters.push_back(std::unique_ptr<Decor>(new Decor(pos(rng), pos(rng), "Target")));
+        }
+        std::vector<Arrow> arrows(arrowCount);
+        for (Arrow& arrow : arrows) {
+            double a = angle(rng);
+            arrow = Arrow{ pos(rng), pos(rng), std::cos(a) * speed, std::sin(a) * speed };
+        }
+
+        char title[80];
+        std::snprintf(title, sizeof(title), "PROJECTILES (%zu arrows, %zu characters, speed %.0f)",
+                      arrowCount, characterCount, speed);
+        BenchUtils::printHeader(title);
+
+        std::vector<const GameObject*> bruteHits(arrowCount), gridHits(arrowCount);
+        long long bruteTests = 0, gridTests = 0;
+
+        // Reference, run once (quadratic)
+        BenchUtils::Timer bruteTimer;
+        bruteTests = bruteForce(arrows, characters, bruteHits);
+        double bruteMicros = bruteTimer.elapsedMicros();
+
+        SpatialGrid grid;
+        grid.reserve(characterCount);
+        BenchUtils::Timer gridTimer;
+        for (int r = 0; r < REPEATS; r++) {
+            gridTests = withGrid(arrows, characters, grid, gridHits);
+        }
+        double gridMicros = gridTimer.elapsedMicros() / REPEATS;
+
+        size_t hitCount = 0, mismatches = 0, tunneled = 0;
+        for (size_t a = 0; a < arrowCount; a++) {
+            if (bruteHits[a]) {
+                hitCount++;
+                // Would a test at the end position alone have seen it?
+                double dx = arrows[a].x + arrows[a].moveX - bruteHits[a]->getX();
+                double dy = arrows[a].y + arrows[a].moveY - bruteHits[a]->getY();
+                double reach = CHARACTER_RADIUS + ARROW_RADIUS;
+                if (dx * dx + dy * dy > reach * reach) {
+                    tunneled++;
+                }
+            }
+            if (bruteHits[a] != gridHits[a]) {
+                mismatches++;
+            }
+        }
+
+        char extra[96];
+        std::snprintf(extra, sizeof(extra), "(%lld tests)", bruteTests);
+        BenchUtils::printResult("brute force swept", bruteMicros, extra);
+        std::snprintf(extra, sizeof(extra), "(%lld tests, x%.1f, %zu mismatches)",
+                      gridTests, bruteMicros / gridMicros, mismatches);
+        BenchUtils::printResult("spatial grid swept", gridMicros, extra);
+        std::printf("  %zu hits, %zu of them missed by an end-position test (tunneling)\n", hitCount, tunneled);
+    }
+
+    /**
+     * Full ProjectileSystem turn: fly every arrow (grid already built),
+     * then refill the slots freed by hits and drops (free list reuse)
+     */
+    void benchSystem(size_t characterCount, size_t projectileCount) {
+        std::mt19937 rng(23);
+        std::uniform_real_distribution<double> pos(0.0, WORLD_SIZE);
+        std::vector<std::unique_ptr<Decor>> characters;
+        for (size_t i = 0; i < characterCount; i++) {
+            characters.push_back(std::unique_ptr<Decor>(new Decor(pos(rng), pos(rng), "Target")));
+        }
+        SpatialGrid grid;
+        grid.reserve(characterCount);
+        for (const auto& character : characters) {
+            grid.insert(character.get(), character->getX(), character->getY(), CHARACTER_RADIUS);
+        }
+        grid.build();
+
+        char title[80];
+        std::snprintf(title, sizeof(title), "PROJECTILE SYSTEM (%zu in flight, %zu characters)",
+                      projectileCount, characterCount);
+        BenchUtils::printHeader(title);
+
+        ProjectileSystem system;
+        system.reserve(projectileCount);
+        auto refill = [&]() {
+            while (system.getLiveCount() < projectileCount) {
+                system.spawn(ProjectileSystem::Kind::ARROW, pos(rng), pos(rng), pos(rng), pos(rng),
+                             2.0, 8.0, 1, nullptr);
+            }
+        };
+        refill();
+
+        size_t impacts = 0;
+        double updateMicros = 0.0, spawnMicros = 0.0;
+        for (int turn = 0; turn < REPEATS; turn++) {
+            BenchUtils::Timer updateTimer;
+            impacts += system.update(grid).size();
+            updateMicros += updateTimer.elapsedMicros();
+            BenchUtils::Timer refillTimer;
+            refill();
+            spawnMicros += refillTimer.elapsedMicros();
+        }
+
+        char extra[96];
+        std::snprintf(extra, sizeof(extra), "(%zu hits or drops per turn)", impacts / REPEATS);
+        BenchUtils::printResult("update (one turn)", updateMicros / REPEATS, extra);
+        std::snprintf(extra, sizeof(extra), "(%zu slots for %zu projectiles)", system.getSlotCount(), projectileCount);
+        BenchUtils::printResult("respawn freed slots", spawnMicros / REPEATS, extra);
+
+        // Same turn with 3x as much decor in the grid: STATIC entries are
+        // outside ProjectileSystem::HIT_MASK, rejected before any sweep
+        std::vector<std::unique_ptr<Decor>> scenery;
+        for (size_t i = 0; i < characterCount * 3; i++) {
+            scenery.push_back(std::unique_ptr<Decor>(new Decor(pos(rng), pos(rng), "Rock")));
+        }
+        grid.clear();
+        grid.reserve(characterCount * 4);
+        for (const auto& character : characters) {
+            grid.insert(character.get(), character->getX(), character->getY(), CHARACTER_RADIUS,
+                        CollisionLayer::CHARACTER, CollisionLayer::ALL);
+        }
+        for (const auto& rock : scenery) {
+            const CollisionShape& shape = rock->getCollisionShape();
+            grid.insert(rock.get(), rock->getX(), rock->getY(), shape.boundingRadius(), shape.layer, shape.mask);
+        }
+        grid.build();
+        size_t mixedImpacts = 0;
+        double mixedMicros = 0.0;
+        for (int turn = 0; turn < REPEATS; turn++) {
+            BenchUtils::Timer updateTimer;
+            mixedImpacts += system.update(grid).size();
+            mixedMicros += updateTimer.elapsedMicros();
+            refill();
+        }
+        std::snprintf(extra, sizeof(extra), "(%zu grid entries, %zu hits or drops per turn)",
+                      grid.size(), mixedImpacts / REPEATS);
+        BenchUtils::printResult("update, decor layer filtered", mixedMicros / REPEATS, extra);
+    }
+}
+
+void runProjectileBench() {
+    benchCount(2000, 5000, 2.0);
+    benchCount(2000, 5000, 20.0);
+    benchCount(20000, 20000, 2.0);
+    benchSystem(2000, 100000);
+}
@@ -0,0 +1,20 @@
+#ifndef PROJECTILEBENCH_HPP
+#define PROJECTILEBENCH_HPP
+
+/**
+ * Projectile collision benchmark
+ *
+ * Thousands of arrows flying one turn through a field of characters:
+ * - brute force: swept test of every arrow against every character
+ * - SpatialGrid: rebuild the grid, swept test against nearby characters
+ * Both must find the same hits. Also counts the hits an end-position
+ * test would miss (tunneling) at high speed.
+ *
+ * Then times one ProjectileSystem turn with 100k projectiles in flight
+ * (bullet-hell scale) and the free-list respawn of the spent slots,
+ * and the same turn with 3x as much decor in the grid (rejected by
+ * collision layer before the swept test: only the bucket scan grows).
+ */
+void runProjectileBench();
+
+#endif // PROJECTILEBENCH_HPP
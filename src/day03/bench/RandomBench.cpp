@@ -0,0 +1,132 @@
+#include "RandomBench.hpp"
+#include "BenchUtils.hpp"
+#include "../Random.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <vector>
+
+namespace {
+    const size_t COUNT = 1 << 24;
+    const size_t BLOCKS = 16;        // Jumped streams (fixed: does not depend on the thread count)
+    const uint64_t SEED = 43;
+
+    double sum(const std::vector<double>& values) {
+        double total = 0.0;
+        for (double value : values) {
+            total += value;
+        }
+        return total;
+    }
+
+    /**
+     * Block b of the output comes from the base stream jumped b times
+     */
+    struct JumpedFill {
+        double* out;
+        size_t blockSize;
+
+        static void run(void* context, size_t, size_t begin, size_t end) {
+            JumpedFill* fill = static_cast<JumpedFill*>(context);
+            for (size_t block = begin; block < end; block++) {
+                Rng rng(SEED);
+                for (size_t j = 0; j < block; j++) {
+                    rng.jump();
+                }
+                rng.fillUniform(fill->out + block * fill->blockSize, fill->blockSize);
+            }
+        }
+    };
+}
+
+void runRandomBench() {
+    BenchUtils::printHeader("RANDOM (2^24 uniform doubles)");
+    std::vector<double> values(COUNT);
+    std::vector<double> other(COUNT);
+    char extra[96];
+
+    {
+        std::mutex mutex;
+        std::srand(static_cast<unsigned>(SEED));
+        BenchUtils::Timer timer;
+        for (size_t i = 0; i < COUNT; i++) {
+            std::lock_guard<std::mutex> lock(mutex);
+            values[i] = std::rand() / (RAND_MAX + 1.0);
+        }
+        double micros = timer.elapsedMicros();
+        std::snprintf(extra, sizeof(extra), "(mean %.4f)", sum(values) / COUNT);
+        BenchUtils::printResult("rand() + mutex", micros, extra);
+    }
+
+    {
+        std::mt19937_64 engine(SEED);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        BenchUtils::Timer timer;
+        for (size_t i = 0; i < COUNT; i++) {
+            values[i] = distribution(engine);
+        }
+        double micros = timer.elapsedMicros();
+        std::snprintf(extra, sizeof(extra), "(mean %.4f)", sum(values) / COUNT);
+        BenchUtils::printResult("mt19937_64", micros, extra);
+    }
+
+    double single;
+    {
+        Rng rng(SEED);
+        BenchUtils::Timer timer;
+        for (size_t i = 0; i < COUNT; i++) {
+            values[i] = rng.uniform();
+        }
+        single = timer.elapsedMicros();
+        std::snprintf(extra, sizeof(extra), "(mean %.4f)", sum(values) / COUNT);
+        BenchUtils::printResult("Rng::uniform", single, extra);
+    }
+
+    {
+        Rng rng(SEED);
+        BenchUtils::Timer timer;
+        rng.fillUniform(other.data(), COUNT);
+        double micros = timer.elapsedMicros();
+        std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", single / micros,
+                      values == other ? "same numbers" : "MISMATCH");
+        BenchUtils::printResult("Rng::fillUniform", micros, extra);
+    }
+
+    {
+        JumpedFill fill{ values.data(), COUNT / BLOCKS };
+        BenchUtils::Timer serialTimer;
+        JumpedFill::run(&fill, 0, 0, BLOCKS);
+        double serial = serialTimer.elapsedMicros();
+
+        JumpedFill parallelFill{ other.data(), COUNT / BLOCKS };
+        size_t chunks = VectorBulk::chunkCount(COUNT, VectorBulk::Execution::PARALLEL);
+        if (chunks > BLOCKS) {
+            chunks = BLOCKS;
+        }
+        BenchUtils::Timer parallelTimer;
+        VectorBulk::runChunks(BLOCKS, chunks, JumpedFill::run, &parallelFill);
+        double parallel = parallelTimer.elapsedMicros();
+
+        std::snprintf(extra, sizeof(extra), "(%zu streams)", BLOCKS);
+        BenchUtils::printResult("jumped streams, serial", serial, extra);
+        std::snprintf(extra, sizeof(extra), "(%zu threads, %s)", chunks,
+                      values == other ? "same numbers" : "MISMATCH");
+        BenchUtils::printResult("jumped streams, parallel", parallel, extra);
+    }
+
+    {
+        BenchUtils::Timer serialTimer;
+        CounterRng::fillUniform(SEED, 0, 0, values.data(), COUNT, VectorBulk::Execution::SEQUENTIAL);
+        double serial = serialTimer.elapsedMicros();
+        BenchUtils::Timer parallelTimer;
+        CounterRng::fillUniform(SEED, 0, 0, other.data(), COUNT, VectorBulk::Execution::PARALLEL);
+        double parallel = parallelTimer.elapsedMicros();
+
+        std::snprintf(extra, sizeof(extra), "(mean %.4f)", sum(values) / COUNT);
+        BenchUtils::printResult("Philox fill, serial", serial, extra);
+        std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", serial / parallel,
+                      values == other ? "same numbers" : "MISMATCH");
+        BenchUtils::printResult("Philox fill, parallel", parallel, extra);
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef RANDOMBENCH_HPP
+#define RANDOMBENCH_HPP
+
+/**
+ * Random number benchmark
+ *
+ * 2^24 uniform doubles in [0, 1), produced by:
+ * - rand() behind a mutex (what the engine does NOT want)
+ * - std::mt19937_64 + std::uniform_real_distribution
+ * - Rng (xoshiro256**): one call at a time, then fillUniform
+ * - Rng split into jumped streams, one per block of work, run on
+ *   worker threads: must equal the same blocks run serially
+ * - CounterRng (Philox) fill, sequential then parallel: must be equal
+ */
+void runRandomBench();
+
+#endif // RANDOMBENCH_HPP
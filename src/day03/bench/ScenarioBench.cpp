@@ -0,0 +1,157 @@
+#include "ScenarioBench.hpp"
+#include "BenchUtils.hpp"
+#include "../Scenario.hpp"
+#include "../GameManager.hpp"
+#include "../Player.hpp"
+#include "../Enemy.hpp"
+#include "../Decor.hpp"
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    const size_t ENTITIES = 1000000;
+    const double MAP_SIZE = 2000.0;
+
+    /**
+     * Parse only: fold every statement into a checksum
+     */
+    class ChecksumSink : public ScenarioSink {
+    public:
+        double checksum = 0.0;
+        size_t statements = 0;
+
+        void onRule(ScenarioRule rule, double value) override { add(static_cast<int>(rule) + value); }
+        void onWeapon(const std::string& name, int range, int power, AttackStyle) override {
+            add(static_cast<double>(name.size() + range + power));
+        }
+        void onPlayer(const std::string& name, double x, double y, int health) override {
+            add(static_cast<double>(name.size()) + x + y + health);
+        }
+        void onEnemy(const std::string& name, double x, double y, int health, int damage) override {
+            add(static_cast<double>(name.size()) + x + y + health + damage);
+        }
+        void onDecor(const std::string& name, double x, double y) override {
+            add(static_cast<double>(name.size()) + x + y);
+        }
+
+    private:
+        void add(double value) {
+            checksum += value;
+            statements++;
+        }
+    };
+
+    /**
+     * Parse and build: same object creation as the Game's builder
+     * (without the services and the log)
+     */
+    class ManagerSink : public ScenarioSink {
+    public:
+        GameManager& manager;
+        Player* player = nullptr;
+
+        explicit ManagerSink(GameManager& manager) : manager(manager) {}
+
+        void onReserve(size_t entities) override { manager.reserve(entities); }
+        void onRule(ScenarioRule, double) override {}
+        void onWeapon(const std::string&, int, int, AttackStyle) override {}
+        void onPlayer(const std::string& name, double x, double y, int health) override {
+            player = manager.createObject<Player>(x, y, name, health);
+        }
+        void onEnemy(const std::string& name, double x, double y, int health, int damage) override {
+            manager.createObject<Enemy>(x, y, name, health, player, damage);
+        }
+        void onDecor(const std::string& name, double x, double y) override {
+            manager.createObject<Decor>(x, y, name);
+        }
+    };
+
+    /**
+     * Text of a big map: 3/4 enemies, 1/4 decor, coordinates on a
+     * 1/100 grid (exact in text)
+     */
+    std::string generateMap() {
+        std::mt19937 rng(41);
+        std::uniform_int_distribution<int> coordinate(0, static_cast<int>(MAP_SIZE * 100));
+        const char* enemyNames[] = { "Goblin", "Orc", "Troll", "Skeleton" };
+        const char* decorNames[] = { "\"Ancient Tree\"", "Boulder", "Ruins" };
+
+        std::string text;
+        text.reserve(ENTITIES * 32);
+        char line[128];
+        std::snprintf(line, sizeof(line), "entities %zu\nrule max_turns 200\nplayer Hero 1000 1000 100\n", ENTITIES + 1);
+        text += line;
+        for (size_t i = 0; i < ENTITIES; i++) {
+            double x = coordinate(rng) / 100.0;
+            double y = coordinate(rng) / 100.0;
+            if (i % 4 != 3) {
+                std::snprintf(line, sizeof(line), "enemy %s %.2f %.2f %d %d\n",
+                              enemyNames[i % 4], x, y, 20 + static_cast<int>(i % 30), 5 + static_cast<int>(i % 6));
+            } else {
+                std::snprintf(line, sizeof(line), "decor %s %.2f %.2f\n", decorNames[i % 3], x, y);
+            }
+            text += line;
+        }
+        return text;
+    }
+
+    template<typename Read>
+    double timeParse(const std::string& data, Read read, ChecksumSink& sink) {
+        std::istringstream in(data);
+        BenchUtils::Timer timer;
+        read(in, sink);
+        return timer.elapsedMicros();
+    }
+
+    template<typename Read>
+    double timeBuild(const std::string& data, Read read, size_t& objects) {
+        GameManager manager;
+        std::istringstream in(data);
+        BenchUtils::Timer timer;
+        ManagerSink sink(manager);
+        read(in, sink);
+        double micros = timer.elapsedMicros();
+        objects = manager.size();
+        return micros;
+    }
+}
+
+void runScenarioBench() {
+    char title[64];
+    std::snprintf(title, sizeof(title), "SCENARIO (%zu entities)", ENTITIES);
+    BenchUtils::printHeader(title);
+
+    std::string text = generateMap();
+    std::ostringstream compiled;
+    BenchUtils::Timer compileTimer;
+    {
+        std::istringstream in(text);
+        Scenario::compile(in, compiled);
+    }
+    double compileMicros = compileTimer.elapsedMicros();
+    std::string binary = compiled.str();
+
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(text %.1f MB, binary %.1f MB)",
+                  text.size() / 1e6, binary.size() / 1e6);
+    BenchUtils::printResult("compile text -> binary", compileMicros, extra);
+
+    ChecksumSink textSink, binarySink;
+    double textParse = timeParse(text, Scenario::readText, textSink);
+    double binaryParse = timeParse(binary, Scenario::readBinary, binarySink);
+    bool same = textSink.statements == binarySink.statements && textSink.checksum == binarySink.checksum;
+    std::snprintf(extra, sizeof(extra), "(%zu statements)", textSink.statements);
+    BenchUtils::printResult("parse text", textParse, extra);
+    std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", textParse / binaryParse, same ? "same world" : "MISMATCH");
+    BenchUtils::printResult("parse binary", binaryParse, extra);
+
+    size_t textObjects = 0, binaryObjects = 0;
+    double textBuild = timeBuild(text, Scenario::readText, textObjects);
+    double binaryBuild = timeBuild(binary, Scenario::readBinary, binaryObjects);
+    std::snprintf(extra, sizeof(extra), "(%zu objects)", textObjects);
+    BenchUtils::printResult("load text + create", textBuild, extra);
+    std::snprintf(extra, sizeof(extra), "(%zu objects)", binaryObjects);
+    BenchUtils::printResult("load binary + create", binaryBuild, extra);
+}
@@ -0,0 +1,16 @@
+#ifndef SCENARIOBENCH_HPP
+#define SCENARIOBENCH_HPP
+
+/**
+ * Scenario loading benchmark
+ *
+ * A generated map with 10^6 entities (enemies and decor around one
+ * player), loaded from memory:
+ * - text form: parse only, then parse + create every object in a
+ *   GameManager
+ * - compiled binary form: same two measurements
+ * Both forms must describe the same world (checksum of the statements).
+ */
+void runScenarioBench();
+
+#endif // SCENARIOBENCH_HPP
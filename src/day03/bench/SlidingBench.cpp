@@ -0,0 +1,127 @@
+#include "SlidingBench.hpp"
+#include "BenchUtils.hpp"
+#include "../CollisionResolver.hpp"
+#include "../GameManager.hpp"
+#include "../Enemy.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    const int CROWD_SIDE = 48;        // 48 x 48 = 2304 enemies
+    const double CROWD_SPACING = 0.8;
+    const double CROWD_OFFSET = 4.0;  // Crowd corner, goal at the origin
+    const int TURNS = 40;            // Long enough for the crowd to pile up
+    const double STEP = 1.0;          // Enemy::moveSpeed
+
+    struct CrowdRun {
+        double micros;     // Per turn
+        size_t stuck;      // Moves that did not move
+        double distance;   // Average distance to the goal at the end
+    };
+
+    void placeCrowd(GameManager& manager, std::vector<Enemy*>& crowd) {
+        for (int row = 0; row < CROWD_SIDE; row++) {
+            for (int col = 0; col < CROWD_SIDE; col++) {
+                crowd.push_back(manager.createObject<Enemy>(CROWD_OFFSET + col * CROWD_SPACING,
+                                                            CROWD_OFFSET + row * CROWD_SPACING,
+                                                            "Goblin", 25, nullptr, 6));
+            }
+        }
+    }
+
+    /**
+     * Straight step towards the origin (shortened on arrival)
+     * @return false if already there
+     */
+    bool stepTowardsGoal(const Enemy& enemy, double& x, double& y) {
+        double distance = std::hypot(enemy.getX(), enemy.getY());
+        if (distance == 0.0) {
+            return false;
+        }
+        double step = distance < STEP ? distance : STEP;
+        x = enemy.getX() - enemy.getX() / distance * step;
+        y = enemy.getY() - enemy.getY() / distance * step;
+        return true;
+    }
+
+    double averageDistance(const std::vector<Enemy*>& crowd) {
+        double total = 0.0;
+        for (const Enemy* enemy : crowd) {
+            total += std::hypot(enemy->getX(), enemy->getY());
+        }
+        return total / crowd.size();
+    }
+
+    CrowdRun runBlocking() {
+        GameManager manager;
+        std::vector<Enemy*> crowd;
+        placeCrowd(manager, crowd);
+        CrowdRun run{ 0.0, 0, 0.0 };
+        BenchUtils::Timer timer;
+        for (int turn = 0; turn < TURNS; turn++) {
+            for (Enemy* enemy : crowd) {
+                double x, y;
+                if (!stepTowardsGoal(*enemy, x, y)) {
+                    continue;
+                }
+                if (manager.canMoveTo(enemy, x, y)) {
+                    enemy->setX(x);
+                    enemy->setY(y);
+                } else {
+                    run.stuck++;
+                }
+            }
+        }
+        run.micros = timer.elapsedMicros() / TURNS;
+        run.distance = averageDistance(crowd);
+        return run;
+    }
+
+    CrowdRun runSliding() {
+        GameManager manager;
+        std::vector<Enemy*> crowd;
+        placeCrowd(manager, crowd);
+        CollisionResolver resolver;
+        resolver.reserve(manager.size());
+        CrowdRun run{ 0.0, 0, 0.0 };
+        BenchUtils::Timer timer;
+        for (int turn = 0; turn < TURNS; turn++) {
+            resolver.begin(manager);
+            for (Enemy* enemy : crowd) {
+                double x, y;
+                if (!stepTowardsGoal(*enemy, x, y)) {
+                    continue;
+                }
+                CollisionResolver::Result move = resolver.resolve(enemy, enemy->getX(), enemy->getY(), x, y);
+                if (move.x == enemy->getX() && move.y == enemy->getY()) {
+                    run.stuck++;
+                    continue;
+                }
+                resolver.commit(enemy->getX(), enemy->getY(), move.x, move.y);
+                enemy->setX(move.x);
+                enemy->setY(move.y);
+            }
+        }
+        run.micros = timer.elapsedMicros() / TURNS;
+        run.distance = averageDistance(crowd);
+        return run;
+    }
+}
+
+void runSlidingBench() {
+    char title[64];
+    std::snprintf(title, sizeof(title), "COLLISION RESPONSE (%d enemies, %d turns)", CROWD_SIDE * CROWD_SIDE, TURNS);
+    BenchUtils::printHeader(title);
+
+    CrowdRun blocking = runBlocking();
+    CrowdRun sliding = runSliding();
+
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(%zu stuck moves, %.1f from goal)", blocking.stuck, blocking.distance);
+    BenchUtils::printResult("turn, scan + block", blocking.micros, extra);
+    std::snprintf(extra, sizeof(extra), "(%zu stuck moves, %.1f from goal, x%.0f)",
+                  sliding.stuck, sliding.distance, blocking.micros / sliding.micros);
+    BenchUtils::printResult("turn, grid + slide", sliding.micros, extra);
+}
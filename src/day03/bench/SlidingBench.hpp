@@ -0,0 +1,16 @@
+#ifndef SLIDINGBENCH_HPP
+#define SLIDINGBENCH_HPP
+
+/**
+ * Collision response benchmark
+ *
+ * A crowd of enemies walking towards one point for a few turns:
+ * - old rule: GameManager::canMoveTo (scan of every object), a blocked
+ *   move is dropped
+ * - CollisionResolver: broad phase grid, blocked moves slide
+ * Reports the time per turn, the moves that made no progress and how
+ * close the crowd got to the goal.
+ */
+void runSlidingBench();
+
+#endif // SLIDINGBENCH_HPP
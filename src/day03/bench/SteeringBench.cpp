@@ -0,0 +1,99 @@
+#include "SteeringBench.hpp"
+#include "BenchUtils.hpp"
+#include "../SteeringBatch.hpp"
+#include "../Vector2d.hpp"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    const int REPEATS = 200;
+
+    /**
+     * Old Enemy::update math: distance() then a second sqrt to normalize
+     */
+    double perEnemyReference(const std::vector<Vector2d>& movers, const Vector2d& target) {
+        double checksum = 0.0;
+        for (const Vector2d& mover : movers) {
+            double dist = mover.distance(target);
+            double dx = target.getX() - mover.getX();
+            double dy = target.getY() - mover.getY();
+            double length = std::sqrt(dx * dx + dy * dy);
+            if (dist > 1.0 && length > 0.0001) {
+                checksum += dx / length + dy / length;
+            }
+        }
+        return checksum;
+    }
+
+    void benchCount(size_t count) {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> pos(-500.0, 500.0);
+
+        SteeringBatch batch;
+        batch.reserve(count);
+        std::vector<Vector2d> movers;
+        movers.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            double x = pos(rng), y = pos(rng);
+            batch.add(x, y, 1.0);
+            movers.emplace_back(x, y);
+        }
+        const double targetX = 3.25, targetY = -1.5;
+
+        char title[64];
+        std::snprintf(title, sizeof(title), "STEERING (%zu movers)", count);
+        BenchUtils::printHeader(title);
+
+        // ---- Per-enemy reference ----
+        Vector2d target(targetX, targetY);
+        BenchUtils::Timer referenceTimer;
+        for (int r = 0; r < REPEATS; r++) {
+            double checksum = perEnemyReference(movers, target);
+            BenchUtils::doNotOptimize(checksum);
+        }
+        double referenceMicros = referenceTimer.elapsedMicros() / REPEATS;
+        BenchUtils::printResult("per-enemy (2 sqrt)", referenceMicros, "");
+
+        // ---- Batch kernels ----
+        std::vector<double> expectedX(count), expectedY(count);
+        batch.computeWith(SteeringBatch::Backend::SCALAR, targetX, targetY);
+        for (size_t i = 0; i < count; i++) {
+            expectedX[i] = batch.getDirX(i);
+            expectedY[i] = batch.getDirY(i);
+        }
+
+        const SteeringBatch::Backend backends[] = {
+            SteeringBatch::Backend::SCALAR, SteeringBatch::Backend::SSE2, SteeringBatch::Backend::AVX2
+        };
+        for (SteeringBatch::Backend backend : backends) {
+            BenchUtils::Timer timer;
+            for (int r = 0; r < REPEATS; r++) {
+                batch.computeWith(backend, targetX, targetY);
+                BenchUtils::doNotOptimize(batch.getDirX(0));
+            }
+            double micros = timer.elapsedMicros() / REPEATS;
+
+            size_t mismatches = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (batch.getDirX(i) != expectedX[i] || batch.getDirY(i) != expectedY[i]) {
+                    mismatches++;
+                }
+            }
+
+            char label[48];
+            std::snprintf(label, sizeof(label), "batch %s", SteeringBatch::getBackendName(backend));
+            char extra[64];
+            std::snprintf(extra, sizeof(extra), "(x%.2f, %zu mismatches)", referenceMicros / micros, mismatches);
+            BenchUtils::printResult(label, micros, extra);
+        }
+    }
+}
+
+void runSteeringBench() {
+    std::printf("\nBest backend on this CPU: %s\n",
+                SteeringBatch::getBackendName(SteeringBatch::getBestBackend()));
+    benchCount(1024);
+    benchCount(65536);
+}
@@ -0,0 +1,13 @@
+#ifndef STEERINGBENCH_HPP
+#define STEERINGBENCH_HPP
+
+/**
+ * Steering benchmark
+ *
+ * Times the SteeringBatch kernels (scalar, SSE2, AVX2) on batches of
+ * random movers, checks that every backend gives bit-identical
+ * results, and compares with the old per-enemy path (two sqrt, getters).
+ */
+void runSteeringBench();
+
+#endif // STEERINGBENCH_HPP
@@ -0,0 +1,156 @@
+#include "VisibilityBench.hpp"
+#include "BenchUtils.hpp"
+#include "../Visibility.hpp"
+#include "../NavGrid.hpp"
+#include "../WorldGen.hpp"
+#include "../GameManager.hpp"
+#include "../Decor.hpp"
+#include "../Geometry.hpp"
+#include "../Random.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    const int VIEWERS = 10000;
+    const int NAIVE_VIEWERS = 500;     // The naive check is too slow for all of them
+    const double VIEW_RANGE = 20.0;    // Enemies within this distance of the player
+
+    WorldGenConfig benchConfig() {
+        WorldGenConfig config;
+        config.seed = 3;
+        config.width = 512.0;
+        config.height = 512.0;
+        config.decorSpacing = 2.5;     // Dense forest: most long rays are blocked
+        config.campDensity = 0.0;
+        return config;
+    }
+
+    class DecorSink : public ScenarioSink {
+    public:
+        GameManager& manager;
+        std::vector<const GameObject*> decor;
+
+        explicit DecorSink(GameManager& manager) : manager(manager) {}
+
+        void onReserve(size_t entities) override { manager.reserve(entities); decor.reserve(entities); }
+        void onRule(ScenarioRule, double) override {}
+        void onWeapon(const std::string&, int, int, AttackStyle) override {}
+        void onPlayer(const std::string&, double, double, int) override {}
+        void onEnemy(const std::string&, double, double, int, int) override {}
+        void onDecor(const std::string& name, double x, double y) override {
+            decor.push_back(manager.createObject<Decor>(x, y, name));
+        }
+    };
+
+    /**
+     * Segment against every decor, each one blocking its whole cell
+     * (same rule as the grid; end cells do not block)
+     */
+    bool naiveClear(const NavGrid& grid, const std::vector<const GameObject*>& decor,
+                    double fromX, double fromY, double toX, double toY) {
+        int fromCellX, fromCellY, toCellX, toCellY;
+        grid.worldToCell(fromX, fromY, fromCellX, fromCellY);
+        grid.worldToCell(toX, toY, toCellX, toCellY);
+        for (const GameObject* object : decor) {
+            int cx, cy;
+            grid.worldToCell(object->getX(), object->getY(), cx, cy);
+            if ((cx == fromCellX && cy == fromCellY) || (cx == toCellX && cy == toCellY)) {
+                continue;
+            }
+            double t;
+            double centerX = grid.cellCenterX(cx);
+            double centerY = grid.cellCenterY(cy);
+            if (Geometry::sweepBox(fromX, fromY, toX - fromX, toY - fromY,
+                                   centerX - 0.5, centerY - 0.5, centerX + 0.5, centerY + 0.5, t)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+void runVisibilityBench() {
+    GameManager manager;
+    DecorSink sink(manager);
+    WorldGenerator(benchConfig()).generate(sink, VectorBulk::Execution::SEQUENTIAL);
+    NavGrid grid;
+    grid.buildFrom(manager, 0);
+
+    char title[64];
+    std::snprintf(title, sizeof(title), "LINE OF SIGHT (%zu decor, %d enemies)", sink.decor.size(), VIEWERS);
+    BenchUtils::printHeader(title);
+
+    // Player at the centre (moved off a decor cell), enemies around
+    double playerX = 256.0, playerY = 256.0;
+    int playerCellX, playerCellY;
+    while (grid.worldToCell(playerX, playerY, playerCellX, playerCellY) && grid.isBlocked(playerCellX, playerCellY)) {
+        playerX += 1.0;
+    }
+    Rng rng(5);
+    std::vector<double> enemyX(VIEWERS), enemyY(VIEWERS);
+    for (int i = 0; i < VIEWERS; i++) {
+        double angle = rng.uniform(0.0, 6.283185307179586);
+        double distance = VIEW_RANGE * std::sqrt(rng.uniform());
+        enemyX[i] = playerX + distance * std::cos(angle);
+        enemyY[i] = playerY + distance * std::sin(angle);
+    }
+
+    // Naive: O(decor) per enemy
+    int naiveVisible = 0;
+    bool naiveMatches = true;
+    BenchUtils::Timer naiveTimer;
+    for (int i = 0; i < NAIVE_VIEWERS; i++) {
+        bool clear = naiveClear(grid, sink.decor, playerX, playerY, enemyX[i], enemyY[i]);
+        naiveVisible += clear;
+        naiveMatches = naiveMatches && clear == LineOfSight::isClear(grid, playerX, playerY, enemyX[i], enemyY[i]);
+    }
+    double naive = naiveTimer.elapsedMicros() / NAIVE_VIEWERS;
+
+    // DDA per enemy
+    std::vector<unsigned char> ddaVisible(VIEWERS);
+    BenchUtils::Timer ddaTimer;
+    for (int i = 0; i < VIEWERS; i++) {
+        ddaVisible[i] = LineOfSight::isClear(grid, playerX, playerY, enemyX[i], enemyY[i]);
+    }
+    double dda = ddaTimer.elapsedMicros() / VIEWERS;
+
+    // One field, then lookups
+    VisibilityField field(static_cast<int>(VIEW_RANGE) + 1);
+    BenchUtils::Timer buildTimer;
+    field.build(grid, playerX, playerY);
+    double build = buildTimer.elapsedMicros();
+    std::vector<unsigned char> fieldVisible(VIEWERS);
+    BenchUtils::Timer lookupTimer;
+    for (int i = 0; i < VIEWERS; i++) {
+        fieldVisible[i] = field.isVisible(enemyX[i], enemyY[i]);
+    }
+    double lookup = lookupTimer.elapsedMicros() / VIEWERS;
+
+    // The field answers per cell: compare with DDA between cell centres
+    // (what it models) and between the exact positions
+    int fieldCount = 0, ddaCount = 0, agreeCells = 0, agreeExact = 0;
+    for (int i = 0; i < VIEWERS; i++) {
+        int cx, cy;
+        grid.worldToCell(enemyX[i], enemyY[i], cx, cy);
+        bool centres = LineOfSight::isClear(grid, grid.cellCenterX(playerCellX), grid.cellCenterY(playerCellY),
+                                            grid.cellCenterX(cx), grid.cellCenterY(cy));
+        fieldCount += fieldVisible[i];
+        ddaCount += ddaVisible[i];
+        agreeCells += fieldVisible[i] == centres;
+        agreeExact += fieldVisible[i] == ddaVisible[i];
+    }
+
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(%d / %d visible, %s DDA)", naiveVisible, NAIVE_VIEWERS,
+                  naiveMatches ? "same as" : "MISMATCH with");
+    BenchUtils::printResult("per enemy, every decor", naive, extra);
+    std::snprintf(extra, sizeof(extra), "(%d / %d visible, x%.0f)", ddaCount, VIEWERS, naive / dda);
+    BenchUtils::printResult("per enemy, grid DDA", dda, extra);
+    std::snprintf(extra, sizeof(extra), "(radius %d)", field.getRadius());
+    BenchUtils::printResult("field of view, shadowcast", build, extra);
+    std::snprintf(extra, sizeof(extra), "(%d visible; as DDA: %.1f%% cell centres, %.1f%% positions)", fieldCount,
+                  100.0 * agreeCells / VIEWERS, 100.0 * agreeExact / VIEWERS);
+    BenchUtils::printResult("per enemy, field lookup", lookup, extra);
+}
@@ -0,0 +1,18 @@
+#ifndef VISIBILITYBENCH_HPP
+#define VISIBILITYBENCH_HPP
+
+/**
+ * Line of sight benchmark
+ *
+ * Thousands of enemies around the player in a dense generated forest:
+ * - naive: segment against every decor (what a per-enemy check without
+ *   a grid costs)
+ * - grid DDA (LineOfSight::isClear) per enemy
+ * - one shadowcast VisibilityField per turn, then an O(1) lookup per
+ *   enemy
+ * Reports how often DDA and the field agree (they differ only at
+ * grazing corners).
+ */
+void runVisibilityBench();
+
+#endif // VISIBILITYBENCH_HPP
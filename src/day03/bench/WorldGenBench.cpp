@@ -0,0 +1,129 @@
+#include "WorldGenBench.hpp"
+#include "BenchUtils.hpp"
+#include "../WorldGen.hpp"
+#include "../GameManager.hpp"
+#include "../Player.hpp"
+#include "../Enemy.hpp"
+#include "../Decor.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+    /**
+     * About 10^6 entities: ~730k decor, ~200k enemies
+     */
+    WorldGenConfig benchConfig() {
+        WorldGenConfig config;
+        config.seed = 42;
+        config.width = 4096.0;
+        config.height = 4096.0;
+        config.decorSpacing = 4.0;
+        config.campDensity = 20.0;
+        return config;
+    }
+
+    /**
+     * Order-sensitive hash of every statement: equal only if both runs
+     * emitted the same statements in the same order
+     */
+    class HashSink : public ScenarioSink {
+    public:
+        uint64_t hash = 14695981039346656037ULL;
+        size_t statements = 0;
+
+        void onRule(ScenarioRule rule, double value) override { mix(static_cast<uint64_t>(rule)); mix(value); }
+        void onWeapon(const std::string& name, int range, int power, AttackStyle) override {
+            mix(name.size());
+            mix(static_cast<uint64_t>(range * 1000 + power));
+        }
+        void onPlayer(const std::string& name, double x, double y, int health) override {
+            mix(name.size());
+            mix(x);
+            mix(y);
+            mix(static_cast<uint64_t>(health));
+        }
+        void onEnemy(const std::string& name, double x, double y, int health, int damage) override {
+            mix(name.size());
+            mix(x);
+            mix(y);
+            mix(static_cast<uint64_t>(health * 1000 + damage));
+        }
+        void onDecor(const std::string& name, double x, double y) override {
+            mix(name.size());
+            mix(x);
+            mix(y);
+        }
+
+    private:
+        void mix(uint64_t value) {
+            hash = (hash ^ value) * 1099511628211ULL;
+            statements++;
+        }
+        void mix(double value) {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            mix(bits);
+        }
+    };
+
+    /**
+     * Generate and build (same object creation as the Game's builder,
+     * without the services and the log)
+     */
+    class ManagerSink : public ScenarioSink {
+    public:
+        GameManager& manager;
+        Player* player = nullptr;
+
+        explicit ManagerSink(GameManager& manager) : manager(manager) {}
+
+        void onReserve(size_t entities) override { manager.reserve(entities); }
+        void onRule(ScenarioRule, double) override {}
+        void onWeapon(const std::string&, int, int, AttackStyle) override {}
+        void onPlayer(const std::string& name, double x, double y, int health) override {
+            player = manager.createObject<Player>(x, y, name, health);
+        }
+        void onEnemy(const std::string& name, double x, double y, int health, int damage) override {
+            manager.createObject<Enemy>(x, y, name, health, player, damage);
+        }
+        void onDecor(const std::string& name, double x, double y) override {
+            manager.createObject<Decor>(x, y, name);
+        }
+    };
+
+    double timeGenerate(const WorldGenerator& generator, VectorBulk::Execution execution,
+                        HashSink& sink, WorldGenStats& stats) {
+        BenchUtils::Timer timer;
+        stats = generator.generate(sink, execution);
+        return timer.elapsedMicros();
+    }
+}
+
+void runWorldGenBench() {
+    WorldGenerator generator(benchConfig());
+    char title[64];
+    std::snprintf(title, sizeof(title), "WORLD GENERATION (%zu regions)", generator.getRegionCount());
+    BenchUtils::printHeader(title);
+
+    HashSink sequentialSink, parallelSink;
+    WorldGenStats stats;
+    double sequential = timeGenerate(generator, VectorBulk::Execution::SEQUENTIAL, sequentialSink, stats);
+    double parallel = timeGenerate(generator, VectorBulk::Execution::PARALLEL, parallelSink, stats);
+    bool same = sequentialSink.hash == parallelSink.hash && sequentialSink.statements == parallelSink.statements;
+
+    char extra[96];
+    std::snprintf(extra, sizeof(extra), "(%zu decor, %zu enemies in %zu camps)",
+                  stats.decor, stats.enemies, stats.camps);
+    BenchUtils::printResult("generate, 1 thread", sequential, extra);
+    std::snprintf(extra, sizeof(extra), "(x%.2f, %s)", sequential / parallel, same ? "same world" : "MISMATCH");
+    BenchUtils::printResult("generate, region-parallel", parallel, extra);
+
+    GameManager manager;
+    BenchUtils::Timer timer;
+    ManagerSink sink(manager);
+    generator.generate(sink, VectorBulk::Execution::PARALLEL);
+    double build = timer.elapsedMicros();
+    std::snprintf(extra, sizeof(extra), "(%zu objects)", manager.size());
+    BenchUtils::printResult("generate + create", build, extra);
+}
@@ -0,0 +1,14 @@
+#ifndef WORLDGENBENCH_HPP
+#define WORLDGENBENCH_HPP
+
+/**
+ * Procedural world generation benchmark
+ *
+ * One large seeded world (about 10^6 entities):
+ * - generation only (statements folded into a checksum), on one thread
+ *   and region-parallel: both must give the same world
+ * - generation straight into a GameManager (every object created)
+ */
+void runWorldGenBench();
+
+#endif // WORLDGENBENCH_HPP
@@ -0,0 +1,115 @@
+#include "PathfindingBench.hpp"
+#include "SteeringBench.hpp"
+#include "PrecisionBench.hpp"
+#include "ExpressionBench.hpp"
+#include "BulkBench.hpp"
+#include "ProjectileBench.hpp"
+#include "EventBench.hpp"
+#include "ScenarioBench.hpp"
+#include "WorldGenBench.hpp"
+#include "RandomBench.hpp"
+#include "BvhBench.hpp"
+#include "SlidingBench.hpp"
+#include "CrowdBench.hpp"
+#include "VisibilityBench.hpp"
+#include "FogBench.hpp"
+#include "AoeBench.hpp"
+#include <cstring>
+#include <iostream>
+
+/**
+ * campus_bench - Performance benchmarks for the Campus Quest engine
+ *
+ * Usage: campus_bench [name]
+ * Without argument every benchmark runs. Names: pathfinding, steering, precision, expressions, bulk, projectiles, events, scenario, worldgen, random, bvh, sliding, crowd, visibility, fog, aoe
+ */
+int main(int argc, char* argv[]) {
+    const char* only = (argc > 1) ? argv[1] : nullptr;
+    bool ranSomething = false;
+
+    if (!only || std::strcmp(only, "pathfinding") == 0) {
+        runPathfindingBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "steering") == 0) {
+        runSteeringBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "precision") == 0) {
+        runPrecisionBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "expressions") == 0) {
+        runExpressionBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "bulk") == 0) {
+        runBulkBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "projectiles") == 0) {
+        runProjectileBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "events") == 0) {
+        runEventBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "scenario") == 0) {
+        runScenarioBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "worldgen") == 0) {
+        runWorldGenBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "random") == 0) {
+        runRandomBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "bvh") == 0) {
+        runBvhBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "sliding") == 0) {
+        runSlidingBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "crowd") == 0) {
+        runCrowdBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "visibility") == 0) {
+        runVisibilityBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "fog") == 0) {
+        runFogBench();
+        ranSomething = true;
+    }
+
+    if (!only || std::strcmp(only, "aoe") == 0) {
+        runAoeBench();
+        ranSomething = true;
+    }
+
+    if (!ranSomething) {
+        std::cerr << "Unknown benchmark: " << only << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <cstring>
+#include <fstream>
 #include "Game.hpp"
 
 /**
@@ -28,10 +30,49 @@
  * - Professional terminal game UI
  * 
  * From basic text to PROFESSIONAL GAME INTERFACE!
+ * 
+ * Usage: campus_quest [scenario]  (default: data/campus.scenario)
+ *        campus_quest --headless [scenario]  (no menu; exit code 1 if a
+ *                                             turn allocates, see ctest)
+ *        campus_quest --compile <text scenario> <compiled output>
+ */
+
+/**
+ * Text scenario -> compiled binary scenario (loads faster)
  */
+static int compileScenario(const char* inputPath, const char* outputPath) {
+    std::ifstream input(inputPath, std::ios::binary);
+    if (!input) {
+        std::cerr << "[ERROR] Cannot open " << inputPath << std::endl;
+        return 1;
+    }
+    std::ofstream output(outputPath, std::ios::binary);
+    if (!output) {
+        std::cerr << "[ERROR] Cannot create " << outputPath << std::endl;
+        return 1;
+    }
+    Scenario::compile(input, output);
+    std::cout << "Compiled " << inputPath << " -> " << outputPath << std::endl;
+    return 0;
+}
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
+        if (argc > 1 && std::strcmp(argv[1], "--compile") == 0) {
+            if (argc != 4) {
+                std::cerr << "Usage: " << argv[0] << " --compile <text scenario> <compiled output>" << std::endl;
+                return 1;
+            }
+            return compileScenario(argv[2], argv[3]);
+        }
+        
+        if (argc > 1 && std::strcmp(argv[1], "--headless") == 0) {
+            // Scripted run: same as menu choice 3, without the prompts
+            Game game(false, true, argc > 2 ? argv[2] : "");
+            game.run();
+            return 0;
+        }
+        
         std::cout << "╔════════════════════════════════════════════════╗" << std::endl;
         std::cout << "║      CAMPUS QUEST: ENHANCED EDITION! 🎨🎮       ║" << std::endl;
         std::cout << "╚════════════════════════════════════════════════╝" << std::endl;
@@ -40,6 +81,7 @@ int main() {
         std::cout << "Select game mode:" << std::endl;
         std::cout << "  [1] Interactive Mode (Player controlled) 🎮" << std::endl;
         std::cout << "  [2] Automated Mode (Watch AI play)" << std::endl;
+        std::cout << "  [3] Headless Mode (No output, allocation checks)" << std::endl;
         std::cout << "Choice: ";
         
         int modeChoice;
@@ -47,8 +89,12 @@ int main() {
         std::cin.ignore();
         
         bool interactive = (modeChoice == 1);
+        bool headless = (modeChoice == 3);
         
-        if (interactive) {
+        if (headless) {
+            std::cout << "\n✓ Headless mode selected!" << std::endl;
+            std::cout << "  The game runs silently until the end." << std::endl;
+        } else if (interactive) {
             std::cout << "\n✓ Interactive mode selected!" << std::endl;
             std::cout << "  You control the hero's every action!" << std::endl;
         } else {
@@ -60,7 +106,8 @@ int main() {
         std::cin.ignore();
         
         // Create game with chosen mode
-        Game game(interactive);
+        // Optional argument: scenario file (text or compiled)
+        Game game(interactive, headless, argc > 1 ? argv[1] : "");
         
         // Run the complete game
         game.run();
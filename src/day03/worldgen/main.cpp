@@ -0,0 +1,133 @@
+#include "../WorldGen.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/**
+ * campus_worldgen - Write a procedural world as a scenario file
+ *
+ * Usage: campus_worldgen <output> [options]
+ *   --seed N          random seed (default 1)
+ *   --size W [H]      map size in units (default 256 x 256)
+ *   --spacing S       minimum distance between decor (0 = none)
+ *   --camps D         enemy camps per 100x100 units (0 = none)
+ *   --camp-size N     average enemies per camp
+ *   --turns N         turn limit rule
+ *   --sequential      one thread (same output, only slower)
+ *
+ * An output ending in ".scenario" gets the text form, anything else
+ * the compiled form. Play it with: campus_quest <output>
+ */
+
+namespace {
+
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " <output> [--seed N] [--size W [H]] [--spacing S]"
+                  << " [--camps D] [--camp-size N] [--turns N] [--sequential]" << std::endl;
+    }
+
+    bool endsWith(const std::string& text, const char* suffix) {
+        size_t length = std::strlen(suffix);
+        return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+    }
+
+    /**
+     * Next argument as a number (false if missing or not a number)
+     */
+    bool takeNumber(int argc, char* argv[], int& index, double& value) {
+        if (index + 1 >= argc) {
+            return false;
+        }
+        char* end = nullptr;
+        double parsed = std::strtod(argv[index + 1], &end);
+        if (end == argv[index + 1] || *end != '\0') {
+            return false;  // 'value' untouched (optional arguments)
+        }
+        value = parsed;
+        index++;
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argv[1][0] == '-') {
+        printUsage(argv[0]);
+        return 1;
+    }
+    const std::string outputPath = argv[1];
+    WorldGenConfig config;
+    VectorBulk::Execution execution = VectorBulk::Execution::PARALLEL;
+
+    for (int i = 2; i < argc; i++) {
+        double value = 0.0;
+        bool valid = true;
+        if (std::strcmp(argv[i], "--seed") == 0) {
+            valid = i + 1 < argc;
+            if (valid) {
+                config.seed = std::strtoull(argv[++i], nullptr, 10);
+            }
+        } else if (std::strcmp(argv[i], "--size") == 0) {
+            valid = takeNumber(argc, argv, i, config.width);
+            config.height = config.width;
+            takeNumber(argc, argv, i, config.height);  // Optional height
+        } else if (std::strcmp(argv[i], "--spacing") == 0) {
+            valid = takeNumber(argc, argv, i, config.decorSpacing);
+        } else if (std::strcmp(argv[i], "--camps") == 0) {
+            valid = takeNumber(argc, argv, i, config.campDensity);
+        } else if (std::strcmp(argv[i], "--camp-size") == 0) {
+            valid = takeNumber(argc, argv, i, value);
+            config.enemiesPerCamp = static_cast<int>(value);
+        } else if (std::strcmp(argv[i], "--turns") == 0) {
+            valid = takeNumber(argc, argv, i, value);
+            config.maxTurns = static_cast<int>(value);
+        } else if (std::strcmp(argv[i], "--sequential") == 0) {
+            execution = VectorBulk::Execution::SEQUENTIAL;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            std::cerr << "Bad or incomplete option: " << argv[i] << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        WorldGenerator generator(config);
+        std::ofstream output(outputPath, std::ios::binary);
+        if (!output) {
+            std::cerr << "[ERROR] Cannot create " << outputPath << std::endl;
+            return 1;
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        WorldGenStats stats;
+        if (endsWith(outputPath, ".scenario")) {
+            output << "# Generated by campus_worldgen --seed " << config.seed << "\n";
+            TextScenarioWriter writer(output);
+            stats = generator.generate(writer, execution);
+        } else {
+            BinaryScenarioWriter writer(output);
+            stats = generator.generate(writer, execution);
+            writer.finish();
+        }
+        output.close();
+        if (!output) {
+            std::cerr << "[ERROR] Cannot write " << outputPath << std::endl;
+            return 1;
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "Generated " << outputPath << " (seed " << config.seed << ", "
+                  << config.width << "x" << config.height << ", " << stats.regions << " regions)" << std::endl;
+        std::cout << "  " << stats.decor << " decor, " << stats.camps << " camps, "
+                  << stats.enemies << " enemies in " << elapsed.count() << " ms" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "[ERROR] " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}